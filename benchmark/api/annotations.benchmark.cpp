@@ -0,0 +1,120 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/benchmark/util.hpp>
+#include <mbgl/annotation/annotation.hpp>
+#include <mbgl/map/map.hpp>
+#include <mbgl/gl/headless_backend.hpp>
+#include <mbgl/gl/offscreen_view.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/renderer/renderer.hpp>
+#include <mbgl/renderer/backend_scope.hpp>
+#include <mbgl/renderer/async_renderer_frontend.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/style/image.hpp>
+#include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/storage/network_status.hpp>
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+#include <random>
+
+using namespace mbgl;
+
+namespace {
+
+// Small square geofences, scattered over the whole world.
+class AnnotationBenchmark {
+public:
+    AnnotationBenchmark(std::size_t count) {
+        NetworkStatus::Set(NetworkStatus::Status::Offline);
+
+        map.getStyle().loadJSON(R"STYLE({ "version": 8, "sources": {}, "layers": [] })STYLE");
+        map.setLatLngZoom({ 40.726989, -73.992857 }, 4);
+
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<double> longitude(-180, 180);
+        std::uniform_real_distribution<double> latitude(-80, 80);
+        for (std::size_t i = 0; i < count; i++) {
+            ids.push_back(map.addAnnotation(geofence({ longitude(generator), latitude(generator) })));
+        }
+    }
+
+    static FillAnnotation geofence(const Point<double>& center) {
+        const double size = 0.25;
+        return FillAnnotation { Polygon<double> {{
+            { center.x - size, center.y - size },
+            { center.x + size, center.y - size },
+            { center.x + size, center.y + size },
+            { center.x - size, center.y + size },
+        }}, 0.5f, Color::red() };
+    }
+
+    util::RunLoop loop;
+    HeadlessBackend backend;
+    BackendScope scope { backend };
+    OffscreenView view { backend.getContext(), { 1000, 1000 } };
+    DefaultFileSource fileSource { "benchmark/fixtures/api/cache.db", "." };
+    ThreadPool threadPool { 4 };
+    AsyncRendererFrontend rendererFrontend { std::make_unique<Renderer>(backend, 1, fileSource, threadPool), view };
+    Map map { rendererFrontend, MapObserver::nullObserver(), view.getSize(), 1, fileSource, threadPool, MapMode::Still };
+    std::vector<AnnotationID> ids;
+};
+
+} // end namespace
+
+// Renders the initial view, which builds the annotation tiles from scratch.
+static void API_renderStill_shapeAnnotations(::benchmark::State& state) {
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        AnnotationBenchmark bench(state.range_x());
+        state.ResumeTiming();
+
+        mbgl::benchmark::render(bench.map, bench.view);
+    }
+}
+
+// Moves a single geofence before each frame, which rebuilds every visible annotation tile.
+static void API_renderStill_updateShapeAnnotation(::benchmark::State& state) {
+    AnnotationBenchmark bench(state.range_x());
+    mbgl::benchmark::render(bench.map, bench.view);
+
+    double offset = 0;
+    while (state.KeepRunning()) {
+        offset = offset > 10 ? 0 : offset + 0.5;
+        bench.map.updateAnnotation(bench.ids.front(), AnnotationBenchmark::geofence({ -74 + offset, 40.7 }));
+        mbgl::benchmark::render(bench.map, bench.view);
+    }
+}
+
+// Moves a fleet of 100 markers near the view in one batch before each frame. Annotation tiles
+// elsewhere keep their data.
+static void API_renderStill_updateSymbolAnnotations(::benchmark::State& state) {
+    AnnotationBenchmark bench(state.range_x());
+    bench.map.setLatLngZoom({ 40.726989, -73.992857 }, 8);
+    bench.map.addAnnotationImage(std::make_unique<style::Image>("default_marker",
+        decodeImage(util::read_file("benchmark/fixtures/api/default_marker.png")), 1.0));
+
+    std::vector<Annotation> fleet;
+    for (int i = 0; i < 100; i++) {
+        fleet.push_back(SymbolAnnotation { Point<double> { -74, 40.7 }, "default_marker" });
+    }
+    const AnnotationIDs ids = bench.map.addAnnotations(fleet);
+    mbgl::benchmark::render(bench.map, bench.view);
+
+    double offset = 0;
+    std::vector<std::pair<AnnotationID, Annotation>> updates;
+    while (state.KeepRunning()) {
+        offset = offset > 1 ? 0 : offset + 0.01;
+        updates.clear();
+        for (std::size_t i = 0; i < ids.size(); i++) {
+            updates.emplace_back(ids[i], SymbolAnnotation { Point<double> { -74 + offset, 40.7 + i * 0.001 }, "default_marker" });
+        }
+        bench.map.updateAnnotations(updates);
+        mbgl::benchmark::render(bench.map, bench.view);
+    }
+}
+
+BENCHMARK(API_renderStill_shapeAnnotations)->Arg(1000)->Arg(10000)->Arg(100000);
+BENCHMARK(API_renderStill_updateShapeAnnotation)->Arg(1000)->Arg(10000)->Arg(100000);
+BENCHMARK(API_renderStill_updateSymbolAnnotations)->Arg(1000)->Arg(10000);
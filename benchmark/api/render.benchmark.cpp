@@ -3,6 +3,7 @@
 #include <mbgl/benchmark/util.hpp>
 #include <mbgl/map/map.hpp>
 #include <mbgl/map/map_observer.hpp>
+#include <mbgl/gl/context.hpp>
 #include <mbgl/gl/headless_backend.hpp>
 #include <mbgl/gl/offscreen_view.hpp>
 #include <mbgl/util/default_thread_pool.hpp>
@@ -17,6 +18,8 @@
 #include <mbgl/util/io.hpp>
 #include <mbgl/util/run_loop.hpp>
 
+#include <string>
+
 using namespace mbgl;
 
 namespace {
@@ -43,6 +46,38 @@ static void prepare(Map& map, optional<std::string> json = {}) {
                                                            decodeImage(util::read_file("benchmark/fixtures/api/default_marker.png")), 1.0));
 }
  
+// Fills the view with copies of an opaque JPEG tile.
+static void prepareRaster(Map& map) {
+    map.getStyle().loadJSON(R"STYLE({
+        "version": 8,
+        "sources": {
+            "raster": {
+                "type": "raster",
+                "tiles": [ "asset://test/fixtures/image/tile.jpeg" ],
+                "tileSize": 256
+            }
+        },
+        "layers": [{ "id": "raster", "type": "raster", "source": "raster" }]
+    })STYLE");
+    map.setLatLngZoom({ 40.726989, -73.992857 }, 3);
+}
+
+static void renderRaster(::benchmark::State& state, RasterTextureFormat format) {
+    RenderBenchmark bench;
+    AsyncRendererFrontend frontend { std::make_unique<Renderer>(bench.backend, 1, bench.fileSource, bench.threadPool,
+                                                                GLContextMode::Unique, optional<std::string>(),
+                                                                optional<std::string>(), format), bench.view };
+    Map map { frontend, MapObserver::nullObserver(), bench.view.getSize(), 1, bench.fileSource, bench.threadPool, MapMode::Still };
+    prepareRaster(map);
+
+    while (state.KeepRunning()) {
+        mbgl::benchmark::render(map, bench.view);
+    }
+
+    // The textures of the raster tiles outweigh the offscreen view and other textures.
+    state.SetLabel("texture memory: " + std::to_string(bench.backend.getContext().getTextureMemory() / 1024) + " KiB");
+}
+
 } // end namespace
 
 static void API_renderStill_reuse_map(::benchmark::State& state) {
@@ -80,6 +115,21 @@ static void API_renderStill_recreate_map(::benchmark::State& state) {
     }
 }
 
+static void API_renderStill_raster_RGBA(::benchmark::State& state) {
+    renderRaster(state, RasterTextureFormat::RGBA);
+}
+
+static void API_renderStill_raster_RGB565(::benchmark::State& state) {
+    renderRaster(state, RasterTextureFormat::RGB565);
+}
+
+static void API_renderStill_raster_DXT1(::benchmark::State& state) {
+    renderRaster(state, RasterTextureFormat::DXT1);
+}
+
 BENCHMARK(API_renderStill_reuse_map);
 BENCHMARK(API_renderStill_reuse_map_switch_styles);
 BENCHMARK(API_renderStill_recreate_map);
+BENCHMARK(API_renderStill_raster_RGBA);
+BENCHMARK(API_renderStill_raster_RGB565);
+BENCHMARK(API_renderStill_raster_DXT1);
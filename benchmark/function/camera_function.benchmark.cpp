@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/style/function/camera_function.hpp>
+#include <mbgl/style/function/composite_function.hpp>
+
+using namespace mbgl;
+using namespace mbgl::style;
+
+namespace {
+
+// Stops spread evenly across the zoom range, like in styles that fine-tune a property for every
+// zoom level.
+template <class T>
+std::map<float, T> makeStops(const int count, T value) {
+    std::map<float, T> stops;
+    for (int i = 0; i < count; i++) {
+        stops.emplace(22.0f * i / count, value);
+    }
+    return stops;
+}
+
+// The zoom levels of a zoom animation, in steps of a frame.
+template <class Fn>
+void animateZoom(benchmark::State& state, Fn&& fn) {
+    while (state.KeepRunning()) {
+        for (float zoom = 0; zoom < 22; zoom += 0.05f) {
+            benchmark::DoNotOptimize(fn(zoom));
+        }
+    }
+}
+
+} // namespace
+
+static void Function_CameraExponential(benchmark::State& state) {
+    const CameraFunction<float> function(ExponentialStops<float>(makeStops(state.range_x(), 1.0f), 1.5f));
+    animateZoom(state, [&] (float zoom) { return function.evaluate(zoom); });
+}
+
+// The same stops as in Function_CameraExponential, evaluated by searching them.
+static void Function_ExponentialStops(benchmark::State& state) {
+    const ExponentialStops<float> stops(makeStops(state.range_x(), 1.0f), 1.5f);
+    animateZoom(state, [&] (float zoom) { return *stops.evaluate(zoom); });
+}
+
+static void Function_CameraInterval(benchmark::State& state) {
+    const CameraFunction<Color> function(IntervalStops<Color>(makeStops(state.range_x(), Color::red())));
+    animateZoom(state, [&] (float zoom) { return function.evaluate(zoom); });
+}
+
+static void Function_CompositeCoveringRanges(benchmark::State& state) {
+    std::map<float, std::map<float, float>> stops;
+    for (const auto& stop : makeStops(state.range_x(), 1.0f)) {
+        stops.emplace(stop.first, std::map<float, float> { { 0.0f, 1.0f }, { 10.0f, 2.0f } });
+    }
+    const CompositeFunction<float> function("property", CompositeExponentialStops<float>(stops));
+    animateZoom(state, [&] (float zoom) { return function.coveringRanges(zoom).coveringZoomRange; });
+}
+
+BENCHMARK(Function_CameraExponential)->Arg(2)->Arg(8)->Arg(32);
+BENCHMARK(Function_ExponentialStops)->Arg(2)->Arg(8)->Arg(32);
+BENCHMARK(Function_CameraInterval)->Arg(2)->Arg(8)->Arg(32);
+BENCHMARK(Function_CompositeCoveringRanges)->Arg(2)->Arg(8)->Arg(32);
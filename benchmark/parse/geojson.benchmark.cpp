@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/style/conversion/geojson.hpp>
+#include <mbgl/style/conversion/json.hpp>
+
+#include <cmath>
+#include <sstream>
+
+using namespace mbgl;
+
+namespace {
+
+// A feature collection of polygons with a few properties each, which is what large GeoJSON
+// uploads mostly look like.
+std::string largeGeoJSON(const int features) {
+    std::ostringstream json;
+    json.precision(9);
+    json << R"({"type":"FeatureCollection","features":[)";
+    for (int i = 0; i < features; i++) {
+        if (i > 0) {
+            json << ',';
+        }
+        json << R"({"type":"Feature","id":)" << i
+             << R"(,"properties":{"name":"Feature )" << i << R"(","height":)" << (i % 50) * 1.5
+             << R"(,"visible":true},"geometry":{"type":"Polygon","coordinates":[[)";
+        const double x = -180.0 + (i % 3600) * 0.1;
+        const double y = -80.0 + (i / 3600) * 0.1;
+        for (int j = 0; j < 32; j++) {
+            json << '[' << x + 0.05 * std::cos(j * M_PI / 16) << ',' << y + 0.05 * std::sin(j * M_PI / 16) << "],";
+        }
+        json << '[' << x + 0.05 << ',' << y << "]]]}}";
+    }
+    json << "]}";
+    return json.str();
+}
+
+} // namespace
+
+static void Parse_GeoJSON(benchmark::State& state) {
+    const std::string json = largeGeoJSON(state.range_x());
+
+    while (state.KeepRunning()) {
+        style::conversion::Error error;
+        auto geoJSON = style::conversion::convert<GeoJSON>(json, error);
+        benchmark::DoNotOptimize(geoJSON);
+    }
+
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+
+// Converts through a rapidjson document, like all GeoJSON used to be.
+static void Parse_GeoJSONDocument(benchmark::State& state) {
+    const std::string json = largeGeoJSON(state.range_x());
+
+    while (state.KeepRunning()) {
+        style::conversion::Error error;
+        auto geoJSON = style::conversion::convertJSON<GeoJSON>(json, error);
+        benchmark::DoNotOptimize(geoJSON);
+    }
+
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+
+BENCHMARK(Parse_GeoJSON)->Arg(100)->Arg(10000);
+BENCHMARK(Parse_GeoJSONDocument)->Arg(100)->Arg(10000);
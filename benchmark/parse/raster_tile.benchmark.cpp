@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/image_buffer_pool.hpp>
+#include <mbgl/util/io.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+void decode(benchmark::State& state, const std::string& path) {
+    const std::string data = util::read_file(path);
+
+    while (state.KeepRunning()) {
+        PremultipliedImage image = decodeImage(data);
+        benchmark::DoNotOptimize(image.data.get());
+    }
+}
+
+// Hands every decoded buffer back, as raster tiles do when they are evicted.
+void decodePooled(benchmark::State& state, const std::string& path) {
+    const std::string data = util::read_file(path);
+    ImageBufferPool pool;
+
+    while (state.KeepRunning()) {
+        PremultipliedImage image = decodeImage(data, pool);
+        benchmark::DoNotOptimize(image.data.get());
+        pool.release(std::move(image.data), image.bytes());
+    }
+}
+
+} // namespace
+
+static void Parse_RasterTile_PNG(benchmark::State& state) {
+    decode(state, "test/fixtures/image/tile.png");
+}
+
+static void Parse_RasterTile_PNG_Pooled(benchmark::State& state) {
+    decodePooled(state, "test/fixtures/image/tile.png");
+}
+
+static void Parse_RasterTile_PNGAlpha(benchmark::State& state) {
+    decode(state, "test/fixtures/resources/sprite.png");
+}
+
+static void Parse_RasterTile_PNGAlpha_Pooled(benchmark::State& state) {
+    decodePooled(state, "test/fixtures/resources/sprite.png");
+}
+
+static void Parse_RasterTile_JPEG(benchmark::State& state) {
+    decode(state, "test/fixtures/image/tile.jpeg");
+}
+
+static void Parse_RasterTile_JPEG_Pooled(benchmark::State& state) {
+    decodePooled(state, "test/fixtures/image/tile.jpeg");
+}
+
+BENCHMARK(Parse_RasterTile_PNG);
+BENCHMARK(Parse_RasterTile_PNG_Pooled);
+BENCHMARK(Parse_RasterTile_PNGAlpha);
+BENCHMARK(Parse_RasterTile_PNGAlpha_Pooled);
+BENCHMARK(Parse_RasterTile_JPEG);
+BENCHMARK(Parse_RasterTile_JPEG_Pooled);
+
+#if !defined(__ANDROID__) && !defined(__APPLE__) && !defined(QT_IMAGE_DECODERS)
+static void Parse_RasterTile_WebP(benchmark::State& state) {
+    decode(state, "test/fixtures/image/tile.webp");
+}
+
+static void Parse_RasterTile_WebP_Pooled(benchmark::State& state) {
+    decodePooled(state, "test/fixtures/image/tile.webp");
+}
+
+BENCHMARK(Parse_RasterTile_WebP);
+BENCHMARK(Parse_RasterTile_WebP_Pooled);
+#endif // !defined(__ANDROID__) && !defined(__APPLE__) && !defined(QT_IMAGE_DECODERS)
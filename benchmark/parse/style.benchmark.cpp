@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/style/parser.hpp>
+#include <mbgl/style/style_cache.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/rapidjson.hpp>
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+using namespace mbgl;
+
+namespace {
+
+// The benchmark style with its layers repeated, which makes for styles with thousands of layers.
+std::string largeStyle(const int copies) {
+    JSDocument document;
+    document.Parse<0>(util::read_file("benchmark/fixtures/api/style.json").c_str());
+
+    JSValue layers(rapidjson::kArrayType);
+    auto& allocator = document.GetAllocator();
+    for (int i = 0; i < copies; i++) {
+        const std::string suffix = "-" + std::to_string(i);
+        for (const auto& layer : document["layers"].GetArray()) {
+            JSValue copy(layer, allocator);
+            for (const char* key : { "id", "ref" }) {
+                if (copy.HasMember(key)) {
+                    const std::string value = copy[key].GetString() + suffix;
+                    copy[key].SetString(value.c_str(), value.size(), allocator);
+                }
+            }
+            layers.PushBack(copy, allocator);
+        }
+    }
+    document["layers"] = layers;
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    document.Accept(writer);
+    return { buffer.GetString(), buffer.GetSize() };
+}
+
+} // namespace
+
+static void Parse_Style(benchmark::State& state) {
+    const std::string json = largeStyle(state.range_x());
+
+    while (state.KeepRunning()) {
+        style::Parser parser;
+        parser.parse(json);
+        benchmark::DoNotOptimize(parser.layers.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+
+// Loads the style again with an unchanged ETag.
+static void Parse_StyleCached(benchmark::State& state) {
+    const std::string json = largeStyle(state.range_x());
+    auto& cache = style::StyleCache::getInstance();
+    cache.clear();
+
+    style::Parser warmup;
+    cache.parse(warmup, json, "mapbox://styles/benchmark", std::string("etag"));
+
+    while (state.KeepRunning()) {
+        style::Parser parser;
+        cache.parse(parser, json, "mapbox://styles/benchmark", std::string("etag"));
+        benchmark::DoNotOptimize(parser.layers.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * json.size());
+    cache.clear();
+}
+
+BENCHMARK(Parse_Style)->Arg(1)->Arg(4)->Arg(16);
+BENCHMARK(Parse_StyleCached)->Arg(1)->Arg(4)->Arg(16);
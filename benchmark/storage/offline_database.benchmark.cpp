@@ -0,0 +1,97 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/storage/offline_database.hpp>
+#include <mbgl/storage/offline_bulk.hpp>
+#include <mbgl/util/io.hpp>
+
+#include <cstdio>
+
+using namespace mbgl;
+
+namespace {
+
+const char* urlTemplate = "mapbox://tiles/mapbox.streets/{z}/{x}/{y}.vector.pbf";
+
+// A synthetic region of `count` tiles at z14 that all share the same real vector tile payload.
+std::vector<std::pair<Resource, Response>> syntheticTiles(std::size_t count) {
+    auto data = std::make_shared<std::string>(util::read_file("test/fixtures/api/assets/streets/10-163-395.vector.pbf"));
+
+    std::vector<std::pair<Resource, Response>> tiles;
+    tiles.reserve(count);
+    for (std::size_t i = 0; i < count; i++) {
+        Response response;
+        response.data = data;
+        tiles.emplace_back(Resource::tile(urlTemplate, 1.0, int32_t(i % 128), int32_t(i / 128), 14, Tileset::Scheme::XYZ),
+                           std::move(response));
+    }
+    return tiles;
+}
+
+OfflineRegion createRegion(OfflineDatabase& db) {
+    OfflineTilePyramidRegionDefinition definition { "", LatLngBounds::world(), 14, 14, 1.0 };
+    return db.createRegion(definition, OfflineRegionMetadata());
+}
+
+} // namespace
+
+static void Storage_OfflineDatabase_PutRegionResource(::benchmark::State& state) {
+    const auto tiles = syntheticTiles(state.range(0));
+
+    while (state.KeepRunning()) {
+        OfflineDatabase db(":memory:");
+        const OfflineRegion region = createRegion(db);
+        for (const auto& tile : tiles) {
+            db.putRegionResource(region.getID(), tile.first, tile.second);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void Storage_OfflineDatabase_PutRegionResources(::benchmark::State& state) {
+    const auto tiles = syntheticTiles(state.range(0));
+
+    while (state.KeepRunning()) {
+        OfflineDatabase db(":memory:");
+        const OfflineRegion region = createRegion(db);
+        std::vector<OfflineDatabase::PreparedResource> batch;
+        batch.reserve(tiles.size());
+        for (const auto& tile : tiles) {
+            batch.push_back(OfflineDatabase::prepareResource(tile.first, tile.second));
+        }
+        db.putRegionResources(region.getID(), batch);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void Storage_OfflineBulk_ExportImport(::benchmark::State& state) {
+    const auto tiles = syntheticTiles(state.range(0));
+    const std::string path = "test/fixtures/offline_database/benchmark.mbtiles";
+
+    OfflineDatabase source(":memory:");
+    const OfflineRegion sourceRegion = createRegion(source);
+    for (const auto& tile : tiles) {
+        source.putRegionResource(sourceRegion.getID(), tile.first, tile.second);
+    }
+
+    OfflineBulkOptions options;
+    options.urlTemplate = urlTemplate;
+    options.threadCount = state.range(1);
+
+    while (state.KeepRunning()) {
+        std::remove(path.c_str());
+        exportMBTiles(source, sourceRegion.getID(), path, options);
+
+        OfflineDatabase db(":memory:");
+        const OfflineRegion region = createRegion(db);
+        importMBTiles(db, region.getID(), path, options);
+    }
+    std::remove(path.c_str());
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(Storage_OfflineDatabase_PutRegionResource)->Arg(1024)->Arg(8192);
+BENCHMARK(Storage_OfflineDatabase_PutRegionResources)->Arg(1024)->Arg(8192);
+BENCHMARK(Storage_OfflineBulk_ExportImport)->Args({ 8192, 1 })->Args({ 8192, 4 });
@@ -0,0 +1,121 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/util/premultiply.hpp>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace mbgl;
+
+namespace {
+
+const std::size_t width = 512;
+const std::size_t height = 512;
+const std::size_t stride = width * 4;
+
+// Random colors with either random or opaque alpha. Premultiplied colors never exceed alpha.
+std::vector<uint8_t> pixels(bool opaque) {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<uint32_t> distribution(0, 255);
+
+    std::vector<uint8_t> data(stride * height);
+    for (std::size_t i = 0; i < data.size(); i += 4) {
+        const uint32_t a = opaque ? 255 : distribution(generator);
+        data[i + 0] = distribution(generator) * a / 255;
+        data[i + 1] = distribution(generator) * a / 255;
+        data[i + 2] = distribution(generator) * a / 255;
+        data[i + 3] = a;
+    }
+    return data;
+}
+
+// The per-channel loops the kernels replaced.
+void premultiplyReference(uint8_t* data, std::size_t count) {
+    for (std::size_t i = 0; i < count * 4; i += 4) {
+        const uint8_t a = data[i + 3];
+        data[i + 0] = (data[i + 0] * a + 127) / 255;
+        data[i + 1] = (data[i + 1] * a + 127) / 255;
+        data[i + 2] = (data[i + 2] * a + 127) / 255;
+    }
+}
+
+void unpremultiplyReference(uint8_t* data, std::size_t count) {
+    for (std::size_t i = 0; i < count * 4; i += 4) {
+        const uint8_t a = data[i + 3];
+        if (a) {
+            data[i + 0] = (255 * data[i + 0] + (a / 2)) / a;
+            data[i + 1] = (255 * data[i + 1] + (a / 2)) / a;
+            data[i + 2] = (255 * data[i + 2] + (a / 2)) / a;
+        }
+    }
+}
+
+void flipReference(uint8_t* data, std::size_t rowBytes, std::size_t rows) {
+    std::vector<uint8_t> tmp(rowBytes);
+    for (std::size_t i = 0, j = rows - 1; i < j; i++, j--) {
+        std::memcpy(tmp.data(), data + i * rowBytes, rowBytes);
+        std::memcpy(data + i * rowBytes, data + j * rowBytes, rowBytes);
+        std::memcpy(data + j * rowBytes, tmp.data(), rowBytes);
+    }
+}
+
+// Each iteration restores the source pixels first, since the kernels work in place.
+template <class Fn>
+void run(::benchmark::State& state, bool opaque, Fn&& fn) {
+    const std::vector<uint8_t> source = pixels(opaque);
+    std::vector<uint8_t> data(source.size());
+
+    while (state.KeepRunning()) {
+        std::memcpy(data.data(), source.data(), source.size());
+        fn(data.data());
+        benchmark::DoNotOptimize(data.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * source.size());
+}
+
+} // namespace
+
+static void Util_premultiply(::benchmark::State& state) {
+    run(state, false, [](uint8_t* data) { util::premultiply(data, width * height); });
+}
+
+static void Util_premultiplyReference(::benchmark::State& state) {
+    run(state, false, [](uint8_t* data) { premultiplyReference(data, width * height); });
+}
+
+static void Util_unpremultiply(::benchmark::State& state) {
+    run(state, false, [](uint8_t* data) { util::unpremultiply(data, width * height); });
+}
+
+static void Util_unpremultiplyReference(::benchmark::State& state) {
+    run(state, false, [](uint8_t* data) { unpremultiplyReference(data, width * height); });
+}
+
+static void Util_unpremultiplyOpaque(::benchmark::State& state) {
+    run(state, true, [](uint8_t* data) { util::unpremultiply(data, width * height); });
+}
+
+static void Util_unpremultiplyOpaqueReference(::benchmark::State& state) {
+    run(state, true, [](uint8_t* data) { unpremultiplyReference(data, width * height); });
+}
+
+static void Util_flipRows(::benchmark::State& state) {
+    run(state, true, [](uint8_t* data) { util::flipRows(data, stride, height); });
+}
+
+static void Util_flipRowsReference(::benchmark::State& state) {
+    run(state, true, [](uint8_t* data) { flipReference(data, stride, height); });
+}
+
+BENCHMARK(Util_premultiply);
+BENCHMARK(Util_premultiplyReference);
+
+BENCHMARK(Util_unpremultiply);
+BENCHMARK(Util_unpremultiplyReference);
+BENCHMARK(Util_unpremultiplyOpaque);
+BENCHMARK(Util_unpremultiplyOpaqueReference);
+
+BENCHMARK(Util_flipRows);
+BENCHMARK(Util_flipRowsReference);
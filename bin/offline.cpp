@@ -3,6 +3,8 @@
 #include <mbgl/util/string.hpp>
 
 #include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/storage/offline_bulk.hpp>
+#include <mbgl/storage/offline_database.hpp>
 
 #include <cstdlib>
 #include <iostream>
@@ -24,6 +26,9 @@ int main(int argc, char *argv[]) {
     double north = 37.2, west = -122.8, south = 38.1, east = -121.7; // Bay area
     double minZoom = 0.0, maxZoom = 15.0, pixelRatio = 1.0;
     std::string output = "offline.db";
+    std::string importPath, exportPath, urlTemplate;
+    int64_t regionID = 0;
+    std::size_t threads = 4;
 
     const char* tokenEnv = getenv("MAPBOX_ACCESS_TOKEN");
     std::string token = tokenEnv ? tokenEnv : std::string();
@@ -40,6 +45,11 @@ int main(int argc, char *argv[]) {
         ("pixelRatio", po::value(&pixelRatio)->value_name("number")->default_value(pixelRatio), "Pixel ratio")
         ("token,t", po::value(&token)->value_name("key")->default_value(token), "Mapbox access token")
         ("output,o", po::value(&output)->value_name("file")->default_value(output), "Output database file name")
+        ("import", po::value(&importPath)->value_name("path"), "Import tiles from an MBTiles file or {z}/{x}/{y} directory into a new region instead of downloading. MBTiles metadata overrides the bounds and zoom range")
+        ("export", po::value(&exportPath)->value_name("file"), "Export the tiles of an existing region to a new MBTiles file")
+        ("region", po::value(&regionID)->value_name("id"), "Region to export")
+        ("url-template", po::value(&urlTemplate)->value_name("URL"), "Tile URL template the imported or exported tiles are stored under")
+        ("threads", po::value(&threads)->value_name("number")->default_value(threads), "Number of compression threads used when importing")
     ;
 
     try {
@@ -53,6 +63,49 @@ int main(int argc, char *argv[]) {
 
     using namespace mbgl;
 
+    if (!importPath.empty() || !exportPath.empty()) {
+        if (urlTemplate.empty()) {
+            std::cerr << "Error: --url-template is required for import and export" << std::endl;
+            exit(1);
+        }
+
+        OfflineBulkOptions options;
+        options.urlTemplate = urlTemplate;
+        options.pixelRatio = pixelRatio;
+        options.threadCount = threads;
+
+        try {
+            OfflineDatabase database(output);
+            const auto start = util::now();
+            uint64_t count;
+
+            if (!importPath.empty()) {
+                const std::string extension = ".mbtiles";
+                const bool isMBTiles = importPath.size() > extension.size() &&
+                    importPath.compare(importPath.size() - extension.size(), extension.size(), extension) == 0;
+                OfflineTilePyramidRegionDefinition definition(style,
+                    LatLngBounds::hull(LatLng(north, west), LatLng(south, east)), minZoom, maxZoom, pixelRatio);
+                // MBTiles files describe the region they cover themselves.
+                const OfflineRegion region = database.createRegion(
+                    isMBTiles ? readMBTilesRegion(importPath, definition) : definition, OfflineRegionMetadata());
+                count = isMBTiles
+                    ? importMBTiles(database, region.getID(), importPath, options)
+                    : importTileDirectory(database, region.getID(), importPath, options);
+                std::cout << "Imported " << count << " tiles into region " << region.getID();
+            } else {
+                count = exportMBTiles(database, regionID, exportPath, options);
+                std::cout << "Exported " << count << " tiles from region " << regionID;
+            }
+
+            const auto elapsed = std::chrono::duration<double>(util::now() - start).count();
+            std::cout << " in " << elapsed << "s (" << (elapsed > 0 ? count / elapsed : 0) << " tiles/sec)" << std::endl;
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+            exit(1);
+        }
+        return 0;
+    }
+
     util::RunLoop loop;
     DefaultFileSource fileSource(output, ".");
     std::unique_ptr<OfflineRegion> region;
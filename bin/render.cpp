@@ -1,10 +1,12 @@
 #include <mbgl/map/map.hpp>
+#include <mbgl/map/metatile.hpp>
 #include <mbgl/util/image.hpp>
 #include <mbgl/util/run_loop.hpp>
 
 #include <mbgl/gl/headless_backend.hpp>
 #include <mbgl/gl/offscreen_view.hpp>
 #include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/util/image_encoder.hpp>
 #include <mbgl/storage/default_file_source.hpp>
 #include <mbgl/style/style.hpp>
 #include <mbgl/renderer/renderer.hpp>
@@ -20,9 +22,13 @@
 
 namespace po = boost::program_options;
 
+#include <atomic>
+#include <cstdio>
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
+#include <utility>
+#include <vector>
 
 int main(int argc, char *argv[]) {
     std::string style_path;
@@ -38,6 +44,13 @@ int main(int argc, char *argv[]) {
     std::string cache_file = "cache.sqlite";
     std::string asset_root = ".";
     std::string token;
+    std::string decoded_cache_dir;
+    std::string tile;
+    uint32_t metatile_size = 1;
+    uint32_t tile_size = 256;
+    uint32_t buffer = 0;
+    std::string format = "png";
+    float quality = 90;
     bool debug = false;
 
     po::options_description desc("Allowed options");
@@ -56,6 +69,13 @@ int main(int argc, char *argv[]) {
         ("output,o", po::value(&output)->value_name("file")->default_value(output), "Output file name")
         ("cache,d", po::value(&cache_file)->value_name("file")->default_value(cache_file), "Cache database file name")
         ("assets,d", po::value(&asset_root)->value_name("file")->default_value(asset_root), "Directory to which asset:// URLs will resolve")
+        ("decoded-cache", po::value(&decoded_cache_dir)->value_name("dir"), "Directory for caching decoded glyphs and sprites across runs")
+        ("tile", po::value(&tile)->value_name("z/x/y"), "Render the metatile containing this tile and write one image per tile, replacing {z}, {x} and {y} in the output file name")
+        ("metatile", po::value(&metatile_size)->value_name("tiles")->default_value(metatile_size), "Number of tiles per row and column of a metatile")
+        ("tile-size", po::value(&tile_size)->value_name("pixels")->default_value(tile_size), "Tile size")
+        ("buffer", po::value(&buffer)->value_name("pixels")->default_value(buffer), "Margin rendered around a metatile to avoid cutting off labels")
+        ("format,f", po::value(&format)->value_name("png|png8|webp")->default_value(format), "Image format; png8 writes paletted PNGs when possible")
+        ("quality,q", po::value(&quality)->value_name("0-100")->default_value(quality), "WebP quality; 100 is lossless")
     ;
 
     try {
@@ -69,6 +89,38 @@ int main(int argc, char *argv[]) {
 
     using namespace mbgl;
 
+    ImageEncoderOptions encoderOptions;
+    if (format == "png8") {
+        encoderOptions.encoding = ImageEncoding::PalettedPNG;
+    } else if (format == "webp") {
+        encoderOptions.encoding = ImageEncoding::WebP;
+        encoderOptions.quality = quality;
+    } else if (format != "png") {
+        std::cout << "Error: unknown image format " << format << std::endl << desc;
+        exit(1);
+    }
+
+    optional<Metatile> metatile;
+    if (!tile.empty()) {
+        unsigned z = 0, x = 0, y = 0;
+        char trailing;
+        try {
+            if (std::sscanf(tile.c_str(), "%u/%u/%u%c", &z, &x, &y, &trailing) != 3 || z > 255) {
+                throw std::invalid_argument("tile must be given as z/x/y");
+            }
+            metatile.emplace(z, x, y, metatile_size, tile_size, buffer);
+        } catch (std::exception& e) {
+            std::cout << "Error: " << e.what() << std::endl << desc;
+            exit(1);
+        }
+        if (metatile->size > 1 && (output.find("{x}") == std::string::npos || output.find("{y}") == std::string::npos)) {
+            std::cout << "Error: output file name must contain {x} and {y} when rendering a metatile" << std::endl << desc;
+            exit(1);
+        }
+        width = metatile->renderSize().width;
+        height = metatile->renderSize().height;
+    }
+
     util::RunLoop loop;
     DefaultFileSource fileSource(cache_file, asset_root);
 
@@ -90,22 +142,40 @@ int main(int argc, char *argv[]) {
     OffscreenView view(backend.getContext(), { static_cast<uint32_t>(width * pixelRatio),
                                                static_cast<uint32_t>(height * pixelRatio) });
     ThreadPool threadPool(4);
-    AsyncRendererFrontend rendererFrontend(std::make_unique<Renderer>(backend, pixelRatio, fileSource, threadPool), view);
-    Map map(rendererFrontend, MapObserver::nullObserver(), mbgl::Size { width, height }, pixelRatio, fileSource, threadPool, MapMode::Still);
+
+    optional<std::string> decodedCacheDir;
+    if (!decoded_cache_dir.empty()) {
+        decodedCacheDir = decoded_cache_dir;
+    }
+
+    AsyncRendererFrontend rendererFrontend(std::make_unique<Renderer>(backend, pixelRatio, fileSource, threadPool,
+                                                                      GLContextMode::Unique, optional<std::string>(),
+                                                                      decodedCacheDir), view);
+    Map map(rendererFrontend, MapObserver::nullObserver(), mbgl::Size { width, height }, pixelRatio, fileSource, threadPool,
+            metatile ? MapMode::Tile : MapMode::Still);
+    map.setStyle(std::make_unique<style::Style>(threadPool, fileSource, pixelRatio, decodedCacheDir));
 
     if (style_path.find("://") == std::string::npos) {
         style_path = std::string("file://") + style_path;
     }
 
     map.getStyle().loadURL(style_path);
-    map.setLatLngZoom({ lat, lon }, zoom);
-    map.setBearing(bearing);
-    map.setPitch(pitch);
+    if (metatile) {
+        map.jumpTo(metatile->camera());
+    } else {
+        map.setLatLngZoom({ lat, lon }, zoom);
+        map.setBearing(bearing);
+        map.setPitch(pitch);
+    }
 
     if (debug) {
         map.setDebug(debug ? mbgl::MapDebugOptions::TileBorders | mbgl::MapDebugOptions::ParseStatus : mbgl::MapDebugOptions::NoDebug);
     }
 
+    // Images are encoded off the main thread, compressing the strips of each PNG in parallel.
+    ImageEncoder encoder(threadPool, encoderOptions);
+    std::atomic<std::size_t> pending { 0 };
+
     map.renderStill([&](std::exception_ptr error) {
         try {
             if (error) {
@@ -116,10 +186,44 @@ int main(int argc, char *argv[]) {
             exit(1);
         }
 
-        std::ofstream out(output, std::ios::binary);
-        out << encodePNG(view.readStillImage());
-        out.close();
-        loop.stop();
+        std::vector<std::pair<std::string, PremultipliedImage>> images;
+        if (metatile) {
+            auto replace = [](std::string str, const std::string& token, uint32_t value) {
+                for (auto pos = str.find(token); pos != std::string::npos; pos = str.find(token, pos)) {
+                    str.replace(pos, token.size(), std::to_string(value));
+                }
+                return str;
+            };
+            for (auto& slice : metatile->slice(view.readStillImage(), pixelRatio)) {
+                images.emplace_back(replace(replace(replace(output, "{z}", slice.z), "{x}", slice.x), "{y}", slice.y),
+                                    std::move(slice.image));
+            }
+        } else {
+            images.emplace_back(output, view.readStillImage());
+        }
+
+        pending = images.size();
+        for (auto& image : images) {
+            const std::string path = image.first;
+            encoder.encode(std::move(image.second), [&, path](std::exception_ptr encodeError, std::string data) {
+                if (encodeError) {
+                    try {
+                        std::rethrow_exception(encodeError);
+                    } catch(std::exception& e) {
+                        std::cout << "Error: " << e.what() << std::endl;
+                        exit(1);
+                    }
+                }
+
+                std::ofstream out(path, std::ios::binary);
+                out << data;
+                out.close();
+
+                if (--pending == 0) {
+                    loop.stop();
+                }
+            });
+        }
     });
 
     loop.run();
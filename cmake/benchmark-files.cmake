@@ -2,14 +2,21 @@
 
 set(MBGL_BENCHMARK_FILES
     # api
+    benchmark/api/annotations.benchmark.cpp
     benchmark/api/query.benchmark.cpp
     benchmark/api/render.benchmark.cpp
 
+    # function
+    benchmark/function/camera_function.benchmark.cpp
+
     # include/mbgl
     benchmark/include/mbgl/benchmark.hpp
 
     # parse
     benchmark/parse/filter.benchmark.cpp
+    benchmark/parse/geojson.benchmark.cpp
+    benchmark/parse/raster_tile.benchmark.cpp
+    benchmark/parse/style.benchmark.cpp
     benchmark/parse/vector_tile.benchmark.cpp
 
     # src
@@ -20,6 +27,10 @@ set(MBGL_BENCHMARK_FILES
     benchmark/src/mbgl/benchmark/util.cpp
     benchmark/src/mbgl/benchmark/util.hpp
 
+    # storage
+    benchmark/storage/offline_database.benchmark.cpp
+
     # util
     benchmark/util/dtoa.benchmark.cpp
+    benchmark/util/premultiply.benchmark.cpp
 )
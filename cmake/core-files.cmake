@@ -8,6 +8,8 @@ set(MBGL_CORE_FILES
     include/mbgl/actor/message.hpp
     include/mbgl/actor/scheduler.hpp
     src/mbgl/actor/mailbox.cpp
+    src/mbgl/actor/parallel_for.cpp
+    src/mbgl/actor/parallel_for.hpp
 
     # algorithm
     src/mbgl/algorithm/covered_by_children.hpp
@@ -64,6 +66,8 @@ set(MBGL_CORE_FILES
     src/mbgl/gl/extension.hpp
     src/mbgl/gl/features.hpp
     src/mbgl/gl/framebuffer.hpp
+    src/mbgl/gl/framebuffer_readback.cpp
+    src/mbgl/gl/framebuffer_readback.hpp
     src/mbgl/gl/gl.cpp
     src/mbgl/gl/gl.hpp
     src/mbgl/gl/index_buffer.hpp
@@ -105,9 +109,11 @@ set(MBGL_CORE_FILES
     include/mbgl/map/change.hpp
     include/mbgl/map/map.hpp
     include/mbgl/map/map_observer.hpp
+    include/mbgl/map/metatile.hpp
     include/mbgl/map/mode.hpp
     include/mbgl/map/view.hpp
     src/mbgl/map/map.cpp
+    src/mbgl/map/metatile.cpp
     src/mbgl/map/transform.cpp
     src/mbgl/map/transform.hpp
     src/mbgl/map/transform_state.cpp
@@ -167,6 +173,8 @@ set(MBGL_CORE_FILES
     src/mbgl/renderer/cross_faded_property_evaluator.cpp
     src/mbgl/renderer/cross_faded_property_evaluator.hpp
     src/mbgl/renderer/data_driven_property_evaluator.hpp
+    src/mbgl/renderer/frame_fingerprint.cpp
+    src/mbgl/renderer/frame_fingerprint.hpp
     src/mbgl/renderer/frame_history.cpp
     src/mbgl/renderer/frame_history.hpp
     src/mbgl/renderer/group_by_layout.cpp
@@ -312,6 +320,8 @@ set(MBGL_CORE_FILES
     include/mbgl/storage/resource_transform.hpp
     include/mbgl/storage/response.hpp
     src/mbgl/storage/asset_file_source.hpp
+    src/mbgl/storage/decoded_cache.cpp
+    src/mbgl/storage/decoded_cache.hpp
     src/mbgl/storage/file_source_request.cpp
     src/mbgl/storage/file_source_request.hpp
     src/mbgl/storage/http_file_source.hpp
@@ -361,6 +371,8 @@ set(MBGL_CORE_FILES
     src/mbgl/style/source_impl.hpp
     src/mbgl/style/source_observer.hpp
     src/mbgl/style/style.cpp
+    src/mbgl/style/style_cache.cpp
+    src/mbgl/style/style_cache.hpp
     src/mbgl/style/style_impl.cpp
     src/mbgl/style/style_impl.hpp
     src/mbgl/style/types.cpp
@@ -397,8 +409,10 @@ set(MBGL_CORE_FILES
     include/mbgl/style/function/identity_stops.hpp
     include/mbgl/style/function/interval_stops.hpp
     include/mbgl/style/function/source_function.hpp
+    include/mbgl/style/function/zoom_stop_index.hpp
     src/mbgl/style/function/categorical_stops.cpp
     src/mbgl/style/function/identity_stops.cpp
+    src/mbgl/style/function/zoom_stop_index.cpp
 
     # style/layers
     include/mbgl/style/layers/background_layer.hpp
@@ -493,6 +507,8 @@ set(MBGL_CORE_FILES
     src/mbgl/text/shaping.hpp
 
     # tile
+    src/mbgl/tile/decoded_geometry_tile_layer.cpp
+    src/mbgl/tile/decoded_geometry_tile_layer.hpp
     src/mbgl/tile/geojson_tile.cpp
     src/mbgl/tile/geojson_tile.hpp
     src/mbgl/tile/geometry_tile.cpp
@@ -539,6 +555,7 @@ set(MBGL_CORE_FILES
     include/mbgl/util/geometry.hpp
     include/mbgl/util/ignore.hpp
     include/mbgl/util/image.hpp
+    include/mbgl/util/image_buffer_pool.hpp
     include/mbgl/util/immutable.hpp
     include/mbgl/util/indexed_tuple.hpp
     include/mbgl/util/interpolate.hpp
@@ -577,12 +594,15 @@ set(MBGL_CORE_FILES
     src/mbgl/util/geojson_impl.cpp
     src/mbgl/util/grid_index.cpp
     src/mbgl/util/grid_index.hpp
+    src/mbgl/util/http_concurrency.cpp
+    src/mbgl/util/http_concurrency.hpp
     src/mbgl/util/http_header.cpp
     src/mbgl/util/http_header.hpp
     src/mbgl/util/http_timeout.cpp
     src/mbgl/util/http_timeout.hpp
     src/mbgl/util/i18n.cpp
     src/mbgl/util/i18n.hpp
+    src/mbgl/util/image_buffer_pool.cpp
     src/mbgl/util/interpolate.cpp
     src/mbgl/util/intersection_tests.cpp
     src/mbgl/util/intersection_tests.hpp
@@ -608,6 +628,8 @@ set(MBGL_CORE_FILES
     src/mbgl/util/stopwatch.cpp
     src/mbgl/util/stopwatch.hpp
     src/mbgl/util/string.cpp
+    src/mbgl/util/texture_compression.cpp
+    src/mbgl/util/texture_compression.hpp
     src/mbgl/util/thread.hpp
     src/mbgl/util/thread_local.hpp
     src/mbgl/util/throttler.cpp
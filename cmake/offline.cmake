@@ -11,6 +11,7 @@ target_compile_options(mbgl-offline
 )
 
 target_include_directories(mbgl-offline
+    PRIVATE src
     PRIVATE platform/default
 )
 
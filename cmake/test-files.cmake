@@ -4,6 +4,7 @@ set(MBGL_TEST_FILES
     # actor
     test/actor/actor.test.cpp
     test/actor/actor_ref.test.cpp
+    test/actor/parallel_for.test.cpp
 
     # algorithm
     test/algorithm/covered_by_children.test.cpp
@@ -28,6 +29,7 @@ set(MBGL_TEST_FILES
 
     # map
     test/map/map.test.cpp
+    test/map/metatile.test.cpp
     test/map/prefetch.test.cpp
     test/map/transform.test.cpp
 
@@ -44,6 +46,7 @@ set(MBGL_TEST_FILES
     test/renderer/backend_scope.test.cpp
     test/renderer/group_by_layout.test.cpp
     test/renderer/image_manager.test.cpp
+    test/renderer/render_layer.test.cpp
 
     # sprite
     test/sprite/sprite_loader.test.cpp
@@ -71,6 +74,7 @@ set(MBGL_TEST_FILES
 
     # storage
     test/storage/asset_file_source.test.cpp
+    test/storage/decoded_cache.test.cpp
     test/storage/default_file_source.test.cpp
     test/storage/headers.test.cpp
     test/storage/http_file_source.test.cpp
@@ -84,6 +88,7 @@ set(MBGL_TEST_FILES
 
     # style/conversion
     test/style/conversion/function.test.cpp
+    test/style/conversion/geojson.test.cpp
     test/style/conversion/geojson_options.test.cpp
     test/style/conversion/layer.test.cpp
     test/style/conversion/light.test.cpp
@@ -98,11 +103,13 @@ set(MBGL_TEST_FILES
     test/style/function/exponential_stops.test.cpp
     test/style/function/interval_stops.test.cpp
     test/style/function/source_function.test.cpp
+    test/style/function/zoom_stop_index.test.cpp
 
     # style
     test/style/properties.test.cpp
     test/style/source.test.cpp
     test/style/style.test.cpp
+    test/style/style_cache.test.cpp
     test/style/style_image.test.cpp
     test/style/style_layer.test.cpp
     test/style/style_parser.test.cpp
@@ -114,6 +121,7 @@ set(MBGL_TEST_FILES
 
     # tile
     test/tile/annotation_tile.test.cpp
+    test/tile/decoded_geometry_tile_layer.test.cpp
     test/tile/geojson_tile.test.cpp
     test/tile/geometry_tile_data.test.cpp
     test/tile/raster_tile.test.cpp
@@ -125,8 +133,10 @@ set(MBGL_TEST_FILES
     test/util/async_task.test.cpp
     test/util/dtoa.test.cpp
     test/util/geo.test.cpp
+    test/util/http_concurrency.test.cpp
     test/util/http_timeout.test.cpp
     test/util/image.test.cpp
+    test/util/image_encoder.test.cpp
     test/util/mapbox.test.cpp
     test/util/memory.test.cpp
     test/util/merge_lines.test.cpp
@@ -136,6 +146,7 @@ set(MBGL_TEST_FILES
     test/util/projection.test.cpp
     test/util/run_loop.test.cpp
     test/util/text_conversions.test.cpp
+    test/util/texture_compression.test.cpp
     test/util/thread.test.cpp
     test/util/thread_local.test.cpp
     test/util/tile_cover.test.cpp
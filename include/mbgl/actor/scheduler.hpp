@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 
 namespace mbgl {
@@ -33,6 +34,11 @@ class Scheduler {
 public:
     virtual ~Scheduler() = default;
     virtual void schedule(std::weak_ptr<Mailbox>) = 0;
+
+    // The number of threads that process messages concurrently.
+    virtual std::size_t getThreadCount() const {
+        return 1;
+    }
 };
 
 } // namespace mbgl
@@ -14,6 +14,7 @@
 #include <functional>
 #include <vector>
 #include <memory>
+#include <utility>
 
 namespace mbgl {
 
@@ -46,6 +47,21 @@ public:
     using StillImageCallback = std::function<void (std::exception_ptr)>;
     void renderStill(StillImageCallback callback);
 
+    // Renders one still image per entry, in order, reusing the loaded style and renderer. The
+    // tiles of all upcoming images are requested along with those of the first one, so tiles
+    // that are shared between images are loaded once. Before rendering an image, the map jumps
+    // to its camera and is resized to its size; the view of the renderer frontend must match
+    // that size by the time the image is rendered, e.g. by resizing it from the callback of
+    // the previous image. The callback is invoked (on the render thread) with the index of
+    // every completed image. If an image fails to render, the callback receives the error and
+    // the remaining images are skipped.
+    struct StillImageOptions {
+        CameraOptions camera;
+        Size size;
+    };
+    using StillImageBatchCallback = std::function<void (std::size_t index, std::exception_ptr)>;
+    void renderStills(std::vector<StillImageOptions>, StillImageBatchCallback callback);
+
     // Triggers a repaint.
     void triggerRepaint();
 
@@ -143,6 +159,11 @@ public:
     void updateAnnotation(AnnotationID, const Annotation&);
     void removeAnnotation(AnnotationID);
 
+    // Change many annotations at once, refreshing the affected annotation tiles only once.
+    AnnotationIDs addAnnotations(const std::vector<Annotation>&);
+    void updateAnnotations(const std::vector<std::pair<AnnotationID, Annotation>>&);
+    void removeAnnotations(const AnnotationIDs&);
+
     // Tile prefetching
     //
     // When loading a map, if `PrefetchZoomDelta` is set to any number greater than 0, the map will
@@ -152,6 +173,12 @@ public:
     void setPrefetchZoomDelta(uint8_t delta);
     uint8_t getPrefetchZoomDelta() const;
 
+    // While the camera is animated, tiles at the destination and along the way are loaded with
+    // low priority before the camera arrives. `PrefetchTileBudget` limits the number of these
+    // tiles per source. Setting it to 0 disables it. The default budget is 64 tiles.
+    void setPrefetchTileBudget(uint32_t budget);
+    uint32_t getPrefetchTileBudget() const;
+
     // Debug
     void setDebug(MapDebugOptions);
     void cycleDebugOptions();
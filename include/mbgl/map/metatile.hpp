@@ -0,0 +1,55 @@
+#pragma once
+
+#include <mbgl/map/camera.hpp>
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/size.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace mbgl {
+
+/**
+ * A square block of tiles that is rendered in a single pass with `MapMode::Tile` and then
+ * sliced into individual tile images. Neighbouring tiles share tile loading, layout and label
+ * placement, and labels that cross the boundaries between the tiles of a metatile come out
+ * seamless.
+ *
+ * `buffer` adds a margin of logical pixels that is rendered around the metatile and then
+ * discarded, so that labels along the outer edges also pick up the symbols of adjacent tiles.
+ */
+class Metatile {
+public:
+    struct Tile {
+        uint8_t z;
+        uint32_t x;
+        uint32_t y;
+        PremultipliedImage image;
+    };
+
+    // Constructs the metatile of `size` x `size` tiles that contains the given tile. At low zoom
+    // levels, the metatile is shrunk to the number of tiles that exist at that zoom level. Tiles
+    // smaller than 512 pixels are rendered below their nominal zoom level, so e.g. 256 pixel
+    // tiles start at zoom level 1.
+    Metatile(uint8_t z, uint32_t x, uint32_t y,
+             uint32_t size, uint32_t tileSize = 256, uint32_t buffer = 0);
+
+    // Map size, in logical pixels, needed to render the metatile including its buffer.
+    Size renderSize() const;
+
+    // Camera that renders the metatile at renderSize().
+    CameraOptions camera() const;
+
+    // Cuts an image that was rendered with renderSize() and camera() at the given pixel ratio
+    // into the individual tiles, in row-major order.
+    std::vector<Tile> slice(const PremultipliedImage&, float pixelRatio) const;
+
+    const uint8_t z;
+    const uint32_t x; // Column of the top left tile.
+    const uint32_t y; // Row of the top left tile.
+    const uint32_t size; // Tiles per row and column.
+    const uint32_t tileSize;
+    const uint32_t buffer;
+};
+
+} // namespace mbgl
@@ -12,6 +12,7 @@ using EnumType = uint32_t;
 enum class MapMode : EnumType {
     Continuous, // continually updating map
     Still, // a once-off still image
+    Tile, // a once-off still image of a tile or metatile, for tile servers
 };
 
 // We can avoid redundant GL calls when it is known that the GL context is not
@@ -23,6 +24,15 @@ enum class GLContextMode : EnumType {
     Shared,
 };
 
+// Texture format of opaque raster tiles. RGB565 halves texture memory at a slight loss of color
+// depth. DXT1 block compression takes an eighth of the memory where the context supports it, and
+// falls back to RGB565 elsewhere. Tiles with transparent pixels always use RGBA.
+enum class RasterTextureFormat : EnumType {
+    RGBA,
+    RGB565,
+    DXT1,
+};
+
 // We can choose to constrain the map both horizontally or vertically, or only
 // vertically e.g. while panning.
 enum class ConstrainMode : EnumType {
@@ -13,6 +13,13 @@ public:
     // calling .bind() repeatedly is a no-op and that the appropriate gl::Context values are
     // set to the current state.
     virtual void bind() = 0;
+
+    // Whether the renderable object keeps what was drawn into it until the next frame, for example
+    // because it isn't swapped. Only then may the renderer skip drawing frames that would look
+    // exactly like the previous one.
+    virtual bool preservesContents() const {
+        return false;
+    }
 };
 
 } // namespace mbgl
@@ -6,6 +6,7 @@
 #include <mbgl/util/geo.hpp>
 #include <mbgl/util/geo.hpp>
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <string>
@@ -26,7 +27,9 @@ class Renderer {
 public:
     Renderer(RendererBackend&, float pixelRatio_, FileSource&, Scheduler&,
              GLContextMode = GLContextMode::Unique,
-             const optional<std::string> programCacheDir = {});
+             const optional<std::string> programCacheDir = {},
+             const optional<std::string> decodedCacheDir = {},
+             RasterTextureFormat = RasterTextureFormat::RGBA);
     ~Renderer();
 
     void setObserver(RendererObserver*);
@@ -43,6 +46,9 @@ public:
     // Debug
     void dumpDebugLogs();
 
+    // For testing only. The number of frames that weren't drawn because the view already showed them.
+    std::size_t getSkippedFrameCount() const;
+
     // Memory
     void onLowMemory();
 
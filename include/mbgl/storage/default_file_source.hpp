@@ -6,6 +6,7 @@
 #include <mbgl/util/constants.hpp>
 #include <mbgl/util/optional.hpp>
 
+#include <limits>
 #include <vector>
 #include <mutex>
 
@@ -46,6 +47,12 @@ public:
 
     void setResourceTransform(optional<ActorRef<ResourceTransform>>&&);
 
+    /*
+     * Sets upper bounds on the number of concurrent network requests, in total and per host.
+     * Below the total bound, the effective limit adapts to observed latency and error rate.
+     */
+    void setMaximumConcurrentRequests(uint32_t total, uint32_t perHost = std::numeric_limits<uint32_t>::max());
+
     std::unique_ptr<AsyncRequest> request(const Resource&, Callback) override;
 
     /*
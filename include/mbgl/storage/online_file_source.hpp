@@ -5,6 +5,8 @@
 #include <mbgl/util/constants.hpp>
 #include <mbgl/util/optional.hpp>
 
+#include <limits>
+
 namespace mbgl {
 
 class ResourceTransform;
@@ -22,6 +24,10 @@ public:
 
     void setResourceTransform(optional<ActorRef<ResourceTransform>>&&);
 
+    // Sets upper bounds on the number of concurrent HTTP requests, in total and per host. Below
+    // the total bound, the effective limit adapts to the latency and error rate of responses.
+    void setMaximumConcurrentRequests(uint32_t total, uint32_t perHost = std::numeric_limits<uint32_t>::max());
+
     std::unique_ptr<AsyncRequest> request(const Resource&, Callback) override;
 
 private:
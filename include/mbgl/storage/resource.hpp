@@ -35,6 +35,14 @@ public:
         Required = true,
     };
 
+    // Distinguishes requests of the same kind and necessity, e.g. tiles that are visible from
+    // tiles that are only prefetched. Network requests with low priority are queued behind
+    // regular ones.
+    enum Priority : bool {
+        Regular = false,
+        Low = true,
+    };
+
     Resource(Kind kind_, std::string url_, optional<TileData> tileData_ = {}, Necessity necessity_ = Required)
         : kind(kind_),
           necessity(necessity_),
@@ -60,6 +68,7 @@ public:
     
     Kind kind;
     Necessity necessity;
+    Priority priority = Regular;
     std::string url;
 
     // Includes auxiliary data if this is a tile request.
@@ -2,9 +2,12 @@
 
 #include <mbgl/style/function/exponential_stops.hpp>
 #include <mbgl/style/function/interval_stops.hpp>
+#include <mbgl/style/function/zoom_stop_index.hpp>
 #include <mbgl/util/interpolate.hpp>
 #include <mbgl/util/variant.hpp>
 
+#include <vector>
+
 namespace mbgl {
 namespace style {
 
@@ -21,21 +24,68 @@ public:
 
     CameraFunction(Stops stops_)
         : stops(std::move(stops_)) {
+        stops.match([&] (const auto& s) {
+            index = ZoomStopIndex(s.stops, base(s));
+            values.reserve(s.stops.size());
+            for (const auto& stop : s.stops) {
+                values.push_back(stop.second);
+            }
+        });
     }
 
     T evaluate(float zoom) const {
+        if (values.empty()) {
+            return T();
+        }
         return stops.match([&] (const auto& s) {
-            return s.evaluate(zoom).value_or(T());
+            return this->evaluate(s, zoom);
         });
     }
-    
+
     friend bool operator==(const CameraFunction& lhs,
                            const CameraFunction& rhs) {
         return lhs.stops == rhs.stops;
     }
 
-    Stops stops;
+    // The stops can't be changed after construction, since they are indexed for evaluation.
+    const Stops& getStops() const {
+        return stops;
+    }
+
     bool useIntegerZoom = false;
+
+private:
+    Stops stops;
+
+    static float base(const ExponentialStops<T>& s) {
+        return s.base;
+    }
+
+    static float base(const IntervalStops<T>&) {
+        return 1.0f;
+    }
+
+    // Equivalent to ExponentialStops<T>::evaluate(zoom).
+    T evaluate(const ExponentialStops<T>&, float zoom) const {
+        const std::size_t i = index.upperBound(zoom);
+        if (i == values.size()) {
+            return values.back();
+        } else if (i == 0) {
+            return values.front();
+        } else {
+            return util::interpolate(values[i - 1], values[i], index.interpolationFactor(i, zoom));
+        }
+    }
+
+    // Equivalent to IntervalStops<T>::evaluate(zoom).
+    T evaluate(const IntervalStops<T>&, float zoom) const {
+        const std::size_t i = index.upperBound(zoom);
+        return values[i == 0 ? 0 : i - 1];
+    }
+
+    // The stops, as built on construction.
+    ZoomStopIndex index;
+    std::vector<T> values;
 };
 
 } // namespace style
@@ -3,12 +3,14 @@
 #include <mbgl/style/function/composite_exponential_stops.hpp>
 #include <mbgl/style/function/composite_interval_stops.hpp>
 #include <mbgl/style/function/composite_categorical_stops.hpp>
+#include <mbgl/style/function/zoom_stop_index.hpp>
 #include <mbgl/util/interpolate.hpp>
 #include <mbgl/util/range.hpp>
 #include <mbgl/util/variant.hpp>
 
 #include <string>
 #include <tuple>
+#include <vector>
 
 namespace mbgl {
 
@@ -45,8 +47,15 @@ public:
 
     CompositeFunction(std::string property_, Stops stops_, optional<T> defaultValue_ = {})
         : property(std::move(property_)),
-          stops(std::move(stops_)),
-          defaultValue(std::move(defaultValue_)) {
+          defaultValue(std::move(defaultValue_)),
+          stops(std::move(stops_)) {
+        stops.match([&] (const auto& s) {
+            index = ZoomStopIndex(s.stops);
+            innerStops.reserve(s.stops.size());
+            for (const auto& stop : s.stops) {
+                innerStops.push_back(s.innerStops(stop.second));
+            }
+        });
     }
 
     struct CoveringRanges {
@@ -59,31 +68,18 @@ public:
     // is the first step toward evaluating the function, and is used for in the course of both partial
     // evaluation of data-driven paint properties, and full evaluation of data-driven layout properties.
     CoveringRanges coveringRanges(float zoom) const {
-        return stops.match(
-            [&] (const auto& s) {
-                assert(!s.stops.empty());
-                auto minIt = s.stops.lower_bound(zoom);
-                auto maxIt = s.stops.upper_bound(zoom);
-                
-                // lower_bound yields first element >= zoom, but we want the *last*
-                // element <= zoom, so if we found a stop > zoom, back up by one.
-                if (minIt != s.stops.begin() && minIt != s.stops.end() && minIt->first > zoom) {
-                    minIt--;
-                }
-                
-                return CoveringRanges {
-                    zoom,
-                    Range<float> {
-                        minIt == s.stops.end() ? s.stops.rbegin()->first : minIt->first,
-                        maxIt == s.stops.end() ? s.stops.rbegin()->first : maxIt->first
-                    },
-                    Range<InnerStops> {
-                        s.innerStops(minIt == s.stops.end() ? s.stops.rbegin()->second : minIt->second),
-                        s.innerStops(maxIt == s.stops.end() ? s.stops.rbegin()->second : maxIt->second)
-                    }
-                };
-            }
-        );
+        assert(index.size() > 0);
+        const std::size_t i = index.upperBound(zoom);
+
+        // The last stop <= zoom and the first stop > zoom, or the closest stop where there is none.
+        const std::size_t lower = i == 0 ? 0 : i - 1;
+        const std::size_t upper = i == index.size() ? index.size() - 1 : i;
+
+        return CoveringRanges {
+            zoom,
+            Range<float> { index.zoom(lower), index.zoom(upper) },
+            Range<InnerStops> { innerStops[lower], innerStops[upper] }
+        };
     }
 
     // Given a range of zoom values (typically two adjacent integer zoom levels, e.g. 5.0 and 6.0),
@@ -132,12 +128,22 @@ public:
             == std::tie(rhs.property, rhs.stops, rhs.defaultValue);
     }
 
+    // The stops can't be changed after construction, since they are indexed for evaluation.
+    const Stops& getStops() const {
+        return stops;
+    }
+
     std::string property;
-    Stops stops;
     optional<T> defaultValue;
     bool useIntegerZoom = false;
 
 private:
+    Stops stops;
+
+    // The stops, as built on construction.
+    ZoomStopIndex index;
+    std::vector<InnerStops> innerStops;
+
     T evaluateFinal(const CoveringRanges& ranges, const Value& value, T finalDefaultValue) const {
         auto eval = [&] (const auto& s) {
             return s.evaluate(value).value_or(defaultValue.value_or(finalDefaultValue));
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace mbgl {
+namespace style {
+
+// The zoom levels of a function's stops, laid out for finding the stops that bracket a zoom level
+// without searching all of them. Zoom functions are evaluated for every layer whenever the zoom
+// level changes, which is every frame of a zoom animation.
+class ZoomStopIndex {
+public:
+    ZoomStopIndex() = default;
+
+    template <class Stops>
+    ZoomStopIndex(const Stops& stops, float base_ = 1.0f)
+        : base(base_) {
+        zooms.reserve(stops.size());
+        for (const auto& stop : stops) {
+            zooms.push_back(stop.first);
+        }
+        build();
+    }
+
+    std::size_t size() const {
+        return zooms.size();
+    }
+
+    float zoom(std::size_t i) const {
+        return zooms[i];
+    }
+
+    // The index of the first stop with a zoom level greater than `zoom`, like `std::upper_bound`.
+    std::size_t upperBound(float zoom) const;
+
+    // The same as `util::interpolationFactor(base, { zoom(i - 1), zoom(i) }, zoom)`, with the
+    // part that only depends on the stops computed in advance.
+    float interpolationFactor(std::size_t i, float zoom) const;
+
+private:
+    void build();
+
+    std::vector<float> zooms;
+    // The result of `upperBound` for every integer zoom level, where searching starts.
+    std::vector<uint32_t> levels;
+    float base = 1.0f;
+    // `std::pow(base, zoomDiff) - 1` for the stops following every stop.
+    std::vector<float> scales;
+};
+
+} // namespace style
+} // namespace mbgl
@@ -2,6 +2,7 @@
 
 #include <mbgl/style/transition_options.hpp>
 #include <mbgl/util/geo.hpp>
+#include <mbgl/util/optional.hpp>
 
 #include <string>
 #include <vector>
@@ -21,7 +22,8 @@ class Layer;
 
 class Style {
 public:
-    Style(Scheduler&, FileSource&, float pixelRatio);
+    Style(Scheduler&, FileSource&, float pixelRatio,
+          const optional<std::string>& decodedCacheDir = {});
     ~Style();
 
     void loadJSON(const std::string&);
@@ -1,12 +1,17 @@
 #pragma once
 
 #include <mbgl/util/noncopyable.hpp>
+#include <mbgl/storage/resource.hpp>
 
 namespace mbgl {
 
 class AsyncRequest : private util::noncopyable {
 public:
     virtual ~AsyncRequest() = default;
+
+    // Changes the priority of a request that is still waiting to be made. File sources that
+    // don't queue requests ignore it, and requests already in progress aren't affected.
+    virtual void setPriority(Resource::Priority) {}
 };
 
 } // namespace mbgl
@@ -39,6 +39,8 @@ constexpr float  MIN_ZOOM_F = MIN_ZOOM;
 constexpr float  MAX_ZOOM_F = MAX_ZOOM;
 
 constexpr uint8_t DEFAULT_PREFETCH_ZOOM_DELTA = 4;
+constexpr uint32_t DEFAULT_PREFETCH_TILE_BUDGET = 64;
+constexpr uint8_t PREFETCH_TRANSITION_SAMPLES = 8;
 
 constexpr uint64_t DEFAULT_MAX_CACHE_SIZE = 50 * 1024 * 1024;
 
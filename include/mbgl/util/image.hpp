@@ -4,12 +4,16 @@
 #include <mbgl/util/geometry.hpp>
 #include <mbgl/util/size.hpp>
 
+#include <cassert>
 #include <string>
 #include <memory>
 #include <algorithm>
+#include <stdexcept>
 
 namespace mbgl {
 
+class ImageBufferPool;
+
 enum class ImageAlphaMode {
     Unassociated,
     Premultiplied,
@@ -146,6 +150,14 @@ using AlphaImage = Image<ImageAlphaMode::Exclusive>;
 
 // TODO: don't use std::string for binary data.
 PremultipliedImage decodeImage(const std::string&);
+
+// Decodes into a buffer taken from `pool`, on platforms whose decoders write pixels directly.
+PremultipliedImage decodeImage(const std::string&, ImageBufferPool& pool);
+
 std::string encodePNG(const PremultipliedImage&);
 
+// Encodes a WebP image. A quality of 100 selects lossless compression. Throws on platforms
+// without a WebP encoder.
+std::string encodeWebP(const PremultipliedImage&, float quality);
+
 } // namespace mbgl
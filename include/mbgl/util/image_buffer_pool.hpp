@@ -0,0 +1,43 @@
+#pragma once
+
+#include <mbgl/util/noncopyable.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace mbgl {
+
+/*
+ * Keeps the pixel buffers of discarded images for reuse by image decoders, which saves an
+ * allocation of several hundred kilobytes per raster tile. Buffers are matched by their exact
+ * size, since tiles of a source share dimensions. Safe to use from multiple threads.
+ */
+class ImageBufferPool : private util::noncopyable {
+public:
+    // Keeps at most `maxBytes` bytes of buffers, 16 MiB by default.
+    explicit ImageBufferPool(std::size_t maxBytes = 16 * 1024 * 1024);
+
+    // Returns a buffer of `bytes` bytes with unspecified contents.
+    std::unique_ptr<uint8_t[]> acquire(std::size_t bytes);
+
+    // Hands back a buffer of `bytes` bytes. Buffers beyond the pool's capacity are freed.
+    void release(std::unique_ptr<uint8_t[]>, std::size_t bytes);
+
+    // The number of buffers and the total number of bytes that are kept.
+    std::size_t size() const;
+    std::size_t bytes() const;
+
+private:
+    const std::size_t maxBytes;
+
+    mutable std::mutex mutex;
+    std::unordered_map<std::size_t, std::vector<std::unique_ptr<uint8_t[]>>> buffers;
+    std::size_t count = 0;
+    std::size_t total = 0;
+};
+
+} // namespace mbgl
@@ -2,11 +2,22 @@
 
 #include <mbgl/util/image.hpp>
 
+#include <cstddef>
+#include <cstdint>
+
 namespace mbgl {
 namespace util {
 
 PremultipliedImage premultiply(UnassociatedImage&&);
 UnassociatedImage unpremultiply(PremultipliedImage&&);
 
+// In-place kernels over `count` RGBA pixels. They are vectorized where the target supports it
+// and produce the same results as the scalar formulas on every platform.
+void premultiply(uint8_t* pixels, std::size_t count);
+void unpremultiply(uint8_t* pixels, std::size_t count);
+
+// Reverses the order of `height` rows of `stride` bytes each, in place.
+void flipRows(uint8_t* data, std::size_t stride, std::size_t height);
+
 } // namespace util
 } // namespace mbgl
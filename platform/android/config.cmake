@@ -43,6 +43,8 @@ macro(mbgl_platform_core)
 
         # Offline
         PRIVATE platform/default/mbgl/storage/offline.cpp
+        PRIVATE platform/default/mbgl/storage/offline_bulk.cpp
+        PRIVATE platform/default/mbgl/storage/offline_bulk.hpp
         PRIVATE platform/default/mbgl/storage/offline_database.cpp
         PRIVATE platform/default/mbgl/storage/offline_database.hpp
         PRIVATE platform/default/mbgl/storage/offline_download.cpp
@@ -60,6 +62,8 @@ macro(mbgl_platform_core)
 
         # Image handling
         PRIVATE platform/default/png_writer.cpp
+        PRIVATE platform/default/mbgl/util/image_encoder.cpp
+        PRIVATE platform/default/mbgl/util/image_encoder.hpp
         PRIVATE platform/android/src/bitmap.cpp
         PRIVATE platform/android/src/bitmap.hpp
         PRIVATE platform/android/src/bitmap_factory.cpp
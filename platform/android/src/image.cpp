@@ -1,6 +1,7 @@
 #include <mbgl/util/image.hpp>
 #include <mbgl/util/string.hpp>
 
+#include <stdexcept>
 #include <string>
 
 #include "attach_env.hpp"
@@ -19,4 +20,13 @@ PremultipliedImage decodeImage(const std::string& string) {
     return android::Bitmap::GetImage(*env, bitmap);
 }
 
+PremultipliedImage decodeImage(const std::string& string, ImageBufferPool&) {
+    // The system decoder allocates its own pixel buffers.
+    return decodeImage(string);
+}
+
+std::string encodeWebP(const PremultipliedImage&, float) {
+    throw std::runtime_error("WebP encoding is not supported on this platform");
+}
+
 } // namespace mbgl
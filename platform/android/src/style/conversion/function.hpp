@@ -170,7 +170,7 @@ struct Converter<jni::jobject*, mbgl::style::CameraFunction<T>> {
         static jni::jmethodID* constructor = &jni::GetMethodID(env, *clazz, "<init>", "(Lcom/mapbox/mapboxsdk/style/functions/stops/Stops;)V");
 
         StopsEvaluator<T> evaluator(env);
-        jni::jobject* stops = apply_visitor(evaluator, value.stops);
+        jni::jobject* stops = apply_visitor(evaluator, value.getStops());
         jni::jobject* converted = &jni::NewObject(env, *clazz, *constructor, stops);
 
         return { converted };
@@ -209,7 +209,7 @@ struct Converter<jni::jobject*, mbgl::style::CompositeFunction<T>> {
 
         // Convert stops
         StopsEvaluator<T> evaluator(env);
-        jni::jobject* stops = apply_visitor(evaluator, value.stops);
+        jni::jobject* stops = apply_visitor(evaluator, value.getStops());
 
 
         // Convert default value
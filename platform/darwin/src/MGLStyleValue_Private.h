@@ -538,7 +538,7 @@ private: // Private utilities for converting from mbgl to mgl values
 
         id operator()(const mbgl::style::CameraFunction<MBGLEnum> &mbglValue) const {
             CameraFunctionStopsVisitor visitor;
-            return apply_visitor(visitor, mbglValue.stops);
+            return apply_visitor(visitor, mbglValue.getStops());
         }
     };
 
@@ -691,7 +691,7 @@ private: // Private utilities for converting from mbgl to mgl values
 
         id operator()(const mbgl::style::CameraFunction<MBGLType> &mbglValue) const {
             CameraFunctionStopsVisitor visitor;
-            return apply_visitor(visitor, mbglValue.stops);
+            return apply_visitor(visitor, mbglValue.getStops());
         }
 
         id operator()(const mbgl::style::SourceFunction<MBGLType> &mbglValue) const {
@@ -701,7 +701,7 @@ private: // Private utilities for converting from mbgl to mgl values
 
         MGLCompositeStyleFunction<ObjCType> * operator()(const mbgl::style::CompositeFunction<MBGLType> &mbglValue) const {
             CompositeFunctionStopsVisitor visitor { mbglValue };
-            return apply_visitor(visitor, mbglValue.stops);
+            return apply_visitor(visitor, mbglValue.getStops());
         }
     };
 };
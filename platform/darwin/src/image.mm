@@ -104,4 +104,14 @@ PremultipliedImage decodeImage(const std::string& source) {
     return MGLPremultipliedImageFromCGImage(*image);
 }
 
+PremultipliedImage decodeImage(const std::string& source, ImageBufferPool&) {
+    // The system decoder allocates its own pixel buffers.
+    return decodeImage(source);
+}
+
+std::string encodeWebP(const PremultipliedImage&, float) {
+    // ImageIO can decode WebP images, but not encode them.
+    throw std::runtime_error("WebP encoding is not supported on this platform");
+}
+
 } // namespace mbgl
@@ -54,6 +54,10 @@ public:
         onlineFileSource.setResourceTransform(std::move(transform));
     }
 
+    void setMaximumConcurrentRequests(uint32_t total, uint32_t perHost) {
+        onlineFileSource.setMaximumConcurrentRequests(total, perHost);
+    }
+
     void listRegions(std::function<void (std::exception_ptr, optional<std::vector<OfflineRegion>>)> callback) {
         try {
             callback({}, offlineDatabase.listRegions());
@@ -158,6 +162,13 @@ public:
         tasks.erase(req);
     }
 
+    void setPriority(AsyncRequest* req, Resource::Priority priority) {
+        auto it = tasks.find(req);
+        if (it != tasks.end()) {
+            it->second->setPriority(priority);
+        }
+    }
+
     void setOfflineMapboxTileCountLimit(uint64_t limit) {
         offlineDatabase.setOfflineMapboxTileCountLimit(limit);
     }
@@ -232,10 +243,17 @@ void DefaultFileSource::setResourceTransform(optional<ActorRef<ResourceTransform
     impl->actor().invoke(&Impl::setResourceTransform, std::move(transform));
 }
 
+void DefaultFileSource::setMaximumConcurrentRequests(uint32_t total, uint32_t perHost) {
+    impl->actor().invoke(&Impl::setMaximumConcurrentRequests, total, perHost);
+}
+
 std::unique_ptr<AsyncRequest> DefaultFileSource::request(const Resource& resource, Callback callback) {
     auto req = std::make_unique<FileSourceRequest>(std::move(callback));
 
     req->onCancel([fs = impl->actor(), req = req.get()] () mutable { fs.invoke(&Impl::cancel, req); });
+    req->onSetPriority([fs = impl->actor(), req = req.get()] (Resource::Priority priority) mutable {
+        fs.invoke(&Impl::setPriority, req, priority);
+    });
 
     impl->actor().invoke(&Impl::request, req.get(), resource, req->actor());
 
@@ -102,6 +102,11 @@ HTTPFileSource::Impl::Impl() {
     handleError(curl_multi_setopt(multi, CURLMOPT_SOCKETDATA, this));
     handleError(curl_multi_setopt(multi, CURLMOPT_TIMERFUNCTION, startTimeout));
     handleError(curl_multi_setopt(multi, CURLMOPT_TIMERDATA, this));
+#if LIBCURL_VERSION_NUM >= ((7) << 16 | (43) << 8 | 0) // Added in 7.43.0
+    // Multiplex requests to the same host over a single HTTP/2 connection when the server
+    // supports it, instead of opening one connection per concurrent request.
+    handleError(curl_multi_setopt(multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX));
+#endif
 }
 
 HTTPFileSource::Impl::~Impl() {
@@ -260,6 +265,14 @@ HTTPRequest::HTTPRequest(HTTPFileSource::Impl* context_, Resource resource_, Fil
 #endif
     handleError(curl_easy_setopt(handle, CURLOPT_USERAGENT, "MapboxGL/1.0"));
     handleError(curl_easy_setopt(handle, CURLOPT_SHARE, context->share));
+#if LIBCURL_VERSION_NUM >= ((7) << 16 | (47) << 8 | 0) // Added in 7.47.0
+    // Negotiate HTTP/2 via ALPN for HTTPS; curl falls back to HTTP/1.1 if it isn't supported.
+    curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+#endif
+#if LIBCURL_VERSION_NUM >= ((7) << 16 | (43) << 8 | 0) // Added in 7.43.0
+    // Prefer waiting for an existing connection that can multiplex over opening a new one.
+    handleError(curl_easy_setopt(handle, CURLOPT_PIPEWAIT, 1));
+#endif
 
     // Start requesting the information.
     handleError(curl_multi_add_handle(context->multi, handle));
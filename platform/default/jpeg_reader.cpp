@@ -1,81 +1,70 @@
 #include <mbgl/util/image.hpp>
-#include <mbgl/util/char_array_buffer.hpp>
+#include <mbgl/util/image_buffer_pool.hpp>
 
-#include <istream>
-#include <sstream>
-#include <array>
+#include <algorithm>
+#include <stdexcept>
 
 extern "C"
 {
 #include <jpeglib.h>
+#include <jerror.h>
 }
 
 namespace mbgl {
 
-const static unsigned BUF_SIZE = 4096;
-
-struct jpeg_stream_wrapper {
-    jpeg_source_mgr manager;
-    std::istream* stream;
-    std::array<JOCTET, BUF_SIZE> buffer;
-};
-
-static void init_source(j_decompress_ptr cinfo) {
-    auto* wrap = reinterpret_cast<jpeg_stream_wrapper*>(cinfo->src);
-    wrap->stream->seekg(0, std::ios_base::beg);
-}
+// The encoded image is entirely in memory, so the source manager hands it to libjpeg in one piece.
+static void init_source(j_decompress_ptr) {}
 
 static boolean fill_input_buffer(j_decompress_ptr cinfo) {
-    auto* wrap = reinterpret_cast<jpeg_stream_wrapper*>(cinfo->src);
-    wrap->stream->read(reinterpret_cast<char*>(&wrap->buffer[0]), BUF_SIZE);
-    std::streamsize size = wrap->stream->gcount();
-    wrap->manager.next_input_byte = wrap->buffer.data();
-    wrap->manager.bytes_in_buffer = BUF_SIZE;
-    return (size > 0) ? TRUE : FALSE;
+    // Only called once all data has been consumed. Like jpeg_mem_src(), report the truncation
+    // through the error manager and insert a fake EOI marker, so that the decoder winds down
+    // without unwinding through libjpeg.
+    static const JOCTET eoi[2] = { 0xFF, JPEG_EOI };
+    WARNMS(cinfo, JWRN_JPEG_EOF);
+    cinfo->src->next_input_byte = eoi;
+    cinfo->src->bytes_in_buffer = 2;
+    return TRUE;
 }
 
 static void skip(j_decompress_ptr cinfo, long count) {
     if (count <= 0) return; // A zero or negative skip count should be treated as a no-op.
-    auto* wrap = reinterpret_cast<jpeg_stream_wrapper*>(cinfo->src);
-
-    if (wrap->manager.bytes_in_buffer > 0 && count < static_cast<long>(wrap->manager.bytes_in_buffer))
-    {
-        wrap->manager.bytes_in_buffer -= count;
-        wrap->manager.next_input_byte = &wrap->buffer[BUF_SIZE - wrap->manager.bytes_in_buffer];
-    }
-    else
-    {
-        wrap->stream->seekg(count - wrap->manager.bytes_in_buffer, std::ios_base::cur);
-        // trigger buffer fill
-        wrap->manager.next_input_byte = nullptr;
-        wrap->manager.bytes_in_buffer = 0; // bytes_in_buffer may be zero on return.
+    jpeg_source_mgr* src = cinfo->src;
+    while (count > static_cast<long>(src->bytes_in_buffer)) {
+        count -= static_cast<long>(src->bytes_in_buffer);
+        fill_input_buffer(cinfo);
     }
+    src->next_input_byte += count;
+    src->bytes_in_buffer -= count;
 }
 
 static void term(j_decompress_ptr) {}
 
-static void attach_stream(j_decompress_ptr cinfo, std::istream* in) {
+static void attach_memory(j_decompress_ptr cinfo, const uint8_t* data, size_t size) {
     if (cinfo->src == nullptr) {
         cinfo->src = (struct jpeg_source_mgr *)
-            (*cinfo->mem->alloc_small) ((j_common_ptr) cinfo, JPOOL_PERMANENT, sizeof(jpeg_stream_wrapper));
+            (*cinfo->mem->alloc_small) ((j_common_ptr) cinfo, JPOOL_PERMANENT, sizeof(jpeg_source_mgr));
     }
-    auto * src = reinterpret_cast<jpeg_stream_wrapper*> (cinfo->src);
-    src->manager.init_source = init_source;
-    src->manager.fill_input_buffer = fill_input_buffer;
-    src->manager.skip_input_data = skip;
-    src->manager.resync_to_restart = jpeg_resync_to_restart;
-    src->manager.term_source = term;
-    src->manager.bytes_in_buffer = 0;
-    src->manager.next_input_byte = nullptr;
-    src->stream = in;
+    jpeg_source_mgr* src = cinfo->src;
+    src->init_source = init_source;
+    src->fill_input_buffer = fill_input_buffer;
+    src->skip_input_data = skip;
+    src->resync_to_restart = jpeg_resync_to_restart;
+    src->term_source = term;
+    src->bytes_in_buffer = size;
+    src->next_input_byte = data;
 }
 
 static void on_error(j_common_ptr) {}
 
-static void on_error_message(j_common_ptr cinfo) {
-    char buffer[JMSG_LENGTH_MAX];
-    (*cinfo->err->format_message)(cinfo, buffer);
-    throw std::runtime_error(std::string("JPEG Reader: libjpeg could not read image: ") + buffer);
+// Warnings are counted by the error manager and raised once libjpeg has returned.
+static void on_error_message(j_common_ptr) {}
+
+static void check_warnings(j_decompress_ptr cinfo) {
+    if (cinfo->err->num_warnings > 0) {
+        char buffer[JMSG_LENGTH_MAX];
+        (*cinfo->err->format_message)((j_common_ptr) cinfo, buffer);
+        throw std::runtime_error(std::string("JPEG Reader: libjpeg could not read image: ") + buffer);
+    }
 }
 
 struct jpeg_info_guard {
@@ -89,10 +78,7 @@ struct jpeg_info_guard {
     jpeg_decompress_struct* i_;
 };
 
-PremultipliedImage decodeJPEG(const uint8_t* data, size_t size) {
-    util::CharArrayBuffer dataBuffer { reinterpret_cast<const char*>(data), size };
-    std::istream stream(&dataBuffer);
-
+PremultipliedImage decodeJPEG(const uint8_t* data, size_t size, ImageBufferPool* pool) {
     jpeg_decompress_struct cinfo;
     jpeg_info_guard iguard(&cinfo);
     jpeg_error_mgr jerr;
@@ -100,13 +86,15 @@ PremultipliedImage decodeJPEG(const uint8_t* data, size_t size) {
     jerr.error_exit = on_error;
     jerr.output_message = on_error_message;
     jpeg_create_decompress(&cinfo);
-    attach_stream(&cinfo, &stream);
+    attach_memory(&cinfo, data, size);
 
     int ret = jpeg_read_header(&cinfo, TRUE);
+    check_warnings(&cinfo);
     if (ret != JPEG_HEADER_OK)
         throw std::runtime_error("JPEG Reader: failed to read header");
 
     jpeg_start_decompress(&cinfo);
+    check_warnings(&cinfo);
 
     if (cinfo.out_color_space == JCS_UNKNOWN)
         throw std::runtime_error("JPEG Reader: failed to read unknown color space");
@@ -119,31 +107,45 @@ PremultipliedImage decodeJPEG(const uint8_t* data, size_t size) {
     size_t components = cinfo.output_components;
     size_t rowStride = components * width;
 
-    PremultipliedImage image({ static_cast<uint32_t>(width), static_cast<uint32_t>(height) });
+    const size_t bytes = width * height * 4;
+    PremultipliedImage image({ static_cast<uint32_t>(width), static_cast<uint32_t>(height) },
+                             pool ? pool->acquire(bytes) : std::unique_ptr<uint8_t[]>(new uint8_t[bytes]));
     uint8_t* dst = image.data.get();
 
-    JSAMPARRAY buffer = (*cinfo.mem->alloc_sarray)((j_common_ptr) &cinfo, JPOOL_IMAGE, rowStride, 1);
+    // Read as many scanlines per call as the decoder produces at once, which is typically a
+    // whole MCU row, to reduce per-call overhead.
+    const JDIMENSION batch = std::max(1, cinfo.rec_outbuf_height);
+    JSAMPARRAY buffer = (*cinfo.mem->alloc_sarray)((j_common_ptr) &cinfo, JPOOL_IMAGE, rowStride, batch);
 
     while (cinfo.output_scanline < cinfo.output_height) {
-        jpeg_read_scanlines(&cinfo, buffer, 1);
-
-        for (size_t i = 0; i < width; ++i) {
-            dst[0] = buffer[0][components * i];
-            dst[3] = 0xFF;
-
+        const JDIMENSION lines = jpeg_read_scanlines(&cinfo, buffer, batch);
+        check_warnings(&cinfo);
+        if (lines == 0)
+            throw std::runtime_error("JPEG Reader: failed to read scanlines");
+
+        // JPEG images are opaque, so expanding to RGBA is all that is left to do.
+        for (JDIMENSION line = 0; line < lines; ++line) {
+            const JSAMPLE* src = buffer[line];
             if (components > 2) {
-                dst[1] = buffer[0][components * i + 1];
-                dst[2] = buffer[0][components * i + 2];
+                for (size_t i = 0; i < width; ++i) {
+                    dst[0] = src[components * i];
+                    dst[1] = src[components * i + 1];
+                    dst[2] = src[components * i + 2];
+                    dst[3] = 0xFF;
+                    dst += 4;
+                }
             } else {
-                dst[1] = dst[0];
-                dst[2] = dst[0];
+                for (size_t i = 0; i < width; ++i) {
+                    dst[0] = dst[1] = dst[2] = src[components * i];
+                    dst[3] = 0xFF;
+                    dst += 4;
+                }
             }
-
-            dst += 4;
         }
     }
 
     jpeg_finish_decompress(&cinfo);
+    check_warnings(&cinfo);
 
     return image;
 }
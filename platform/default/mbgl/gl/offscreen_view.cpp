@@ -1,6 +1,7 @@
 #include <mbgl/gl/offscreen_view.hpp>
 #include <mbgl/gl/context.hpp>
 #include <mbgl/gl/framebuffer.hpp>
+#include <mbgl/gl/framebuffer_readback.hpp>
 #include <mbgl/gl/renderbuffer.hpp>
 #include <mbgl/util/optional.hpp>
 
@@ -28,20 +29,54 @@ public:
         context.viewport = { 0, 0, size };
     }
 
+    bool preservesContents() const {
+        // Resizing discards the renderbuffers.
+        return bool(framebuffer);
+    }
+
     PremultipliedImage readStillImage() {
         return context.readFramebuffer<PremultipliedImage>(size);
     }
 
+    std::future<PremultipliedImage> readStillImageAsync() {
+        if (!readback) {
+            readback = std::make_unique<gl::FramebufferReadback>(context, size);
+        }
+        return readback->read();
+    }
+
+    void finishReads() {
+        if (readback) {
+            readback->finish();
+        }
+    }
+
+    void resize(const Size size_) {
+        assert(!size_.isEmpty());
+        if (size_ == size) {
+            return;
+        }
+
+        // Pending reads refer to the old renderbuffer, so they have to complete first.
+        finishReads();
+        readback.reset();
+        framebuffer = {};
+        color = {};
+        depthStencil = {};
+        size = size_;
+    }
+
     const Size& getSize() const {
         return size;
     }
 
 private:
     gl::Context& context;
-    const Size size;
+    Size size;
     optional<gl::Framebuffer> framebuffer;
     optional<gl::Renderbuffer<gl::RenderbufferType::RGBA>> color;
     optional<gl::Renderbuffer<gl::RenderbufferType::DepthStencil>> depthStencil;
+    std::unique_ptr<gl::FramebufferReadback> readback;
 };
 
 OffscreenView::OffscreenView(gl::Context& context, const Size size)
@@ -54,10 +89,26 @@ void OffscreenView::bind() {
     impl->bind();
 }
 
+bool OffscreenView::preservesContents() const {
+    return impl->preservesContents();
+}
+
 PremultipliedImage OffscreenView::readStillImage() {
     return impl->readStillImage();
 }
 
+std::future<PremultipliedImage> OffscreenView::readStillImageAsync() {
+    return impl->readStillImageAsync();
+}
+
+void OffscreenView::finishReads() {
+    impl->finishReads();
+}
+
+void OffscreenView::resize(const Size size) {
+    impl->resize(size);
+}
+
 const Size& OffscreenView::getSize() const {
     return impl->getSize();
 }
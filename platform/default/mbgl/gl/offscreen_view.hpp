@@ -3,6 +3,8 @@
 #include <mbgl/map/view.hpp>
 #include <mbgl/util/image.hpp>
 
+#include <future>
+
 namespace mbgl {
 
 namespace gl {
@@ -15,9 +17,19 @@ public:
     ~OffscreenView() override;
 
     void bind() override;
+    bool preservesContents() const override;
 
     PremultipliedImage readStillImage();
 
+    // Starts reading the current contents without waiting for rendering to finish. The image
+    // is copied out by the next call to readStillImageAsync() or finishReads(), which lets
+    // the transfer overlap with rendering the next image, or when the future is waited on.
+    std::future<PremultipliedImage> readStillImageAsync();
+    void finishReads();
+
+    // Changes the size of the images rendered from now on. Completes pending reads first.
+    void resize(Size);
+
     const Size& getSize() const;
 
 private:
@@ -0,0 +1,328 @@
+#include <mbgl/storage/offline_bulk.hpp>
+#include <mbgl/storage/offline_database.hpp>
+#include <mbgl/storage/resource.hpp>
+#include <mbgl/storage/response.hpp>
+#include <mbgl/actor/parallel_for.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/optional.hpp>
+#include <mbgl/util/string.hpp>
+
+#include "sqlite3.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+namespace mbgl {
+
+namespace {
+
+// Collects tiles and writes them to the region in batches. Before each batch is written, its
+// tiles are compressed in parallel; only the database writes are serialized.
+class BatchWriter {
+public:
+    BatchWriter(OfflineDatabase& database_, int64_t regionID_, const OfflineBulkOptions& options_)
+        : database(database_),
+          regionID(regionID_),
+          options(options_),
+          // The writing thread compresses tiles as well.
+          threadPool(std::max<std::size_t>(options.threadCount, 1) - 1) {
+        pending.reserve(options.batchSize);
+    }
+
+    void add(int8_t z, int32_t x, int32_t y, std::string data) {
+        pending.push_back({ z, x, y, std::move(data) });
+        if (pending.size() >= options.batchSize) {
+            flush();
+        }
+    }
+
+    void flush() {
+        if (pending.empty()) {
+            return;
+        }
+
+        std::vector<optional<OfflineDatabase::PreparedResource>> prepared(pending.size());
+        parallelFor(threadPool, pending.size(), [&] (std::size_t i) {
+            Tile& tile = pending[i];
+            Response response;
+            response.data = std::make_shared<std::string>(std::move(tile.data));
+            prepared[i] = OfflineDatabase::prepareResource(
+                Resource::tile(options.urlTemplate, options.pixelRatio, tile.x, tile.y, tile.z,
+                               Tileset::Scheme::XYZ),
+                std::move(response));
+        });
+
+        std::vector<OfflineDatabase::PreparedResource> batch;
+        batch.reserve(prepared.size());
+        for (auto& resource : prepared) {
+            batch.push_back(std::move(*resource));
+        }
+
+        database.putRegionResources(regionID, batch);
+        count += batch.size();
+        pending.clear();
+    }
+
+    uint64_t count = 0;
+
+private:
+    struct Tile {
+        int8_t z;
+        int32_t x;
+        int32_t y;
+        std::string data;
+    };
+
+    OfflineDatabase& database;
+    const int64_t regionID;
+    const OfflineBulkOptions& options;
+    ThreadPool threadPool;
+    std::vector<Tile> pending;
+};
+
+// Parses a non-negative decimal tile coordinate from a path component, ignoring the extension.
+optional<int32_t> parseCoordinate(const std::string& name) {
+    char* end = nullptr;
+    const long value = std::strtol(name.c_str(), &end, 10);
+    if (end == name.c_str() || (*end != '\0' && *end != '.') || value < 0 || value > (1 << 30)) {
+        return {};
+    }
+    return static_cast<int32_t>(value);
+}
+
+std::vector<std::string> listDirectory(const std::string& path) {
+    std::vector<std::string> result;
+    DIR* dir = opendir(path.c_str());
+    if (!dir) {
+        return result;
+    }
+    while (struct dirent* entry = readdir(dir)) {
+        if (entry->d_name[0] != '.') {
+            result.emplace_back(entry->d_name);
+        }
+    }
+    closedir(dir);
+    return result;
+}
+
+bool isDirectory(const std::string& path) {
+    struct stat buf;
+    return stat(path.c_str(), &buf) == 0 && S_ISDIR(buf.st_mode);
+}
+
+bool exists(const std::string& path) {
+    struct stat buf;
+    return stat(path.c_str(), &buf) == 0;
+}
+
+// Parses MBTiles `bounds` metadata, which lists the west, south, east and north edges.
+optional<LatLngBounds> parseBounds(const std::string& value) {
+    double edges[4];
+    const char* begin = value.c_str();
+    for (std::size_t i = 0; i < 4; i++) {
+        char* end = nullptr;
+        edges[i] = std::strtod(begin, &end);
+        if (end == begin || !std::isfinite(edges[i]) || (*end != (i < 3 ? ',' : '\0'))) {
+            return {};
+        }
+        begin = end + 1;
+    }
+    const double west = edges[0], south = edges[1], east = edges[2], north = edges[3];
+    if (south < -90 || north > 90 || south > north || west < -180 || east > 180 || west > east) {
+        return {};
+    }
+    return LatLngBounds::hull(LatLng(south, west), LatLng(north, east));
+}
+
+optional<double> parseZoom(const std::string& value) {
+    char* end = nullptr;
+    const double zoom = std::strtod(value.c_str(), &end);
+    if (end == value.c_str() || *end != '\0' || !(zoom >= 0 && zoom <= 30)) {
+        return {};
+    }
+    return zoom;
+}
+
+// Returns the MBTiles `format` of a tile, recognizing raster images by their signature.
+std::string tileFormat(const std::string& data) {
+    if (data.compare(0, 8, "\x89PNG\r\n\x1a\n") == 0) {
+        return "png";
+    } else if (data.compare(0, 3, "\xFF\xD8\xFF") == 0) {
+        return "jpg";
+    } else if (data.size() >= 12 && data.compare(0, 4, "RIFF") == 0 && data.compare(8, 4, "WEBP") == 0) {
+        return "webp";
+    } else {
+        return "pbf";
+    }
+}
+
+} // namespace
+
+OfflineTilePyramidRegionDefinition readMBTilesRegion(const std::string& path, const OfflineTilePyramidRegionDefinition& defaults) {
+    mapbox::sqlite::Database mbtiles(path, mapbox::sqlite::ReadOnly);
+    mapbox::sqlite::Statement stmt = mbtiles.prepare(
+        "SELECT name, value FROM metadata WHERE name IN ('bounds', 'minzoom', 'maxzoom')");
+
+    optional<LatLngBounds> bounds;
+    optional<double> minZoom;
+    optional<double> maxZoom;
+    while (stmt.run()) {
+        const std::string name = stmt.get<std::string>(0);
+        const std::string value = stmt.get<std::string>(1);
+        if (name == "bounds") {
+            bounds = parseBounds(value);
+        } else if (name == "minzoom") {
+            minZoom = parseZoom(value);
+        } else if (name == "maxzoom") {
+            maxZoom = parseZoom(value);
+        }
+    }
+
+    const double min = minZoom ? *minZoom : defaults.minZoom;
+    const double max = maxZoom ? *maxZoom : defaults.maxZoom;
+    if (max < min) {
+        throw std::runtime_error("MBTiles file has maxzoom below minzoom: " + path);
+    }
+
+    return { defaults.styleURL, bounds ? *bounds : defaults.bounds, min, max, defaults.pixelRatio };
+}
+
+uint64_t importMBTiles(OfflineDatabase& database, int64_t regionID, const std::string& path, const OfflineBulkOptions& options) {
+    mapbox::sqlite::Database mbtiles(path, mapbox::sqlite::ReadOnly);
+    mapbox::sqlite::Statement stmt = mbtiles.prepare(
+        "SELECT zoom_level, tile_column, tile_row, tile_data FROM tiles");
+
+    BatchWriter writer(database, regionID, options);
+    while (stmt.run()) {
+        const int32_t z = stmt.get<int>(0);
+        if (z < 0 || z > 30) {
+            continue;
+        }
+        // MBTiles rows follow the TMS scheme, with the y axis pointing north.
+        const int32_t dim = 1 << z;
+        const int32_t x = stmt.get<int>(1);
+        const int32_t row = stmt.get<int>(2);
+        if (x < 0 || x >= dim || row < 0 || row >= dim) {
+            continue;
+        }
+        const int32_t y = dim - 1 - row;
+        writer.add(static_cast<int8_t>(z), x, y, stmt.get<std::string>(3));
+    }
+    writer.flush();
+
+    return writer.count;
+}
+
+uint64_t importTileDirectory(OfflineDatabase& database, int64_t regionID, const std::string& path, const OfflineBulkOptions& options) {
+    BatchWriter writer(database, regionID, options);
+
+    for (const auto& zName : listDirectory(path)) {
+        const auto z = parseCoordinate(zName);
+        const std::string zPath = path + "/" + zName;
+        if (!z || *z > 30 || !isDirectory(zPath)) {
+            continue;
+        }
+        for (const auto& xName : listDirectory(zPath)) {
+            const auto x = parseCoordinate(xName);
+            const std::string xPath = zPath + "/" + xName;
+            if (!x || !isDirectory(xPath)) {
+                continue;
+            }
+            for (const auto& yName : listDirectory(xPath)) {
+                const auto y = parseCoordinate(yName);
+                const std::string yPath = xPath + "/" + yName;
+                if (!y || isDirectory(yPath)) {
+                    continue;
+                }
+                writer.add(static_cast<int8_t>(*z), *x, *y, util::read_file(yPath));
+            }
+        }
+    }
+    writer.flush();
+
+    return writer.count;
+}
+
+uint64_t exportMBTiles(OfflineDatabase& database, int64_t regionID, const std::string& path, const OfflineBulkOptions& options) {
+    const std::vector<OfflineRegion> regions = database.listRegions();
+    const auto region = std::find_if(regions.begin(), regions.end(), [&](const OfflineRegion& candidate) {
+        return candidate.getID() == regionID;
+    });
+    if (region == regions.end()) {
+        throw std::runtime_error("Offline region doesn't exist: " + util::toString(regionID));
+    }
+    const OfflineRegionDefinition& definition = region->getDefinition();
+
+    if (exists(path)) {
+        throw std::runtime_error("MBTiles file already exists: " + path);
+    }
+
+    mapbox::sqlite::Database mbtiles(path, mapbox::sqlite::ReadWrite | mapbox::sqlite::Create);
+    mbtiles.exec("CREATE TABLE metadata (name TEXT, value TEXT)");
+    mbtiles.exec("CREATE TABLE tiles (zoom_level INTEGER, tile_column INTEGER, tile_row INTEGER, tile_data BLOB)");
+    mbtiles.exec("CREATE UNIQUE INDEX tile_index ON tiles (zoom_level, tile_column, tile_row)");
+
+    mapbox::sqlite::Transaction transaction(mbtiles);
+
+    mapbox::sqlite::Statement insert = mbtiles.prepare(
+        "INSERT OR REPLACE INTO tiles (zoom_level, tile_column, tile_row, tile_data) VALUES (?1, ?2, ?3, ?4)");
+
+    // Tiles are only stored with a pixel ratio other than 1 if the template supports it.
+    const uint8_t pixelRatio = Resource::tile(options.urlTemplate, options.pixelRatio, 0, 0, 0,
+                                              Tileset::Scheme::XYZ).tileData->pixelRatio;
+    uint64_t count = 0;
+    optional<std::string> format;
+    int32_t maxTileZoom = 0;
+
+    database.forEachRegionTile(regionID, options.urlTemplate, [&](const Resource::TileData& tile, const std::string& data) {
+        if (tile.pixelRatio != pixelRatio) {
+            return;
+        }
+        if (!format) {
+            format = tileFormat(data);
+        }
+        maxTileZoom = std::max<int32_t>(maxTileZoom, tile.z);
+        insert.bind(1, int32_t(tile.z));
+        insert.bind(2, tile.x);
+        insert.bind(3, (int32_t(1) << tile.z) - 1 - tile.y);
+        insert.bindBlob(4, data.data(), data.size(), false);
+        insert.run();
+        insert.reset();
+        count++;
+    });
+
+    // Describe the region, so that importing the file again recreates it. Regions without a maximum
+    // zoom level end at the highest zoom level of their tiles.
+    const LatLngBounds& bounds = definition.bounds;
+    const double maxZoom = std::isfinite(definition.maxZoom)
+        ? definition.maxZoom
+        : std::max<double>(definition.minZoom, maxTileZoom);
+    const std::pair<const char*, std::string> metadata[] = {
+        { "name", options.name.empty() ? definition.styleURL : options.name },
+        { "format", format ? *format : "pbf" },
+        { "bounds", util::toString(bounds.west()) + "," + util::toString(bounds.south()) + "," +
+                    util::toString(bounds.east()) + "," + util::toString(bounds.north()) },
+        { "minzoom", util::toString(definition.minZoom) },
+        { "maxzoom", util::toString(maxZoom) },
+    };
+    mapbox::sqlite::Statement insertMetadata = mbtiles.prepare("INSERT INTO metadata (name, value) VALUES (?1, ?2)");
+    for (const auto& entry : metadata) {
+        insertMetadata.bind(1, entry.first);
+        insertMetadata.bind(2, entry.second);
+        insertMetadata.run();
+        insertMetadata.reset();
+    }
+
+    transaction.commit();
+
+    return count;
+}
+
+} // namespace mbgl
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <mbgl/storage/offline.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace mbgl {
+
+class OfflineDatabase;
+
+/**
+ * Options for bulk import and export of offline region tiles.
+ *
+ * Tiles are stored under `urlTemplate`, which must match the first tile URL of the
+ * corresponding source (after canonicalization) for the region to be usable offline.
+ *
+ * @private
+ */
+class OfflineBulkOptions {
+public:
+    std::string urlTemplate;
+    float pixelRatio = 1.0f;
+
+    // Name written to the metadata of exported MBTiles files. Defaults to the region's style URL.
+    std::string name;
+
+    // Number of tiles written per database transaction.
+    std::size_t batchSize = 4096;
+
+    // Number of threads compressing tile data before each batch is written.
+    std::size_t threadCount = 4;
+};
+
+/*
+ * Returns the region covered by an MBTiles file, as described by its `bounds`, `minzoom` and
+ * `maxzoom` metadata. Values missing from the metadata are taken from `defaults`.
+ */
+OfflineTilePyramidRegionDefinition readMBTilesRegion(const std::string& path, const OfflineTilePyramidRegionDefinition& defaults);
+
+/*
+ * Imports all tiles of an MBTiles file into an existing region. Tile data is stored verbatim,
+ * so MBTiles files with gzip-compressed vector tiles need to be decompressed beforehand.
+ * Rows with coordinates outside the tile grid of their zoom level are skipped.
+ * Returns the number of imported tiles.
+ */
+uint64_t importMBTiles(OfflineDatabase&, int64_t regionID, const std::string& path, const OfflineBulkOptions&);
+
+/*
+ * Imports all tiles of a `{z}/{x}/{y}.{extension}` directory tree into an existing region.
+ * Returns the number of imported tiles.
+ */
+uint64_t importTileDirectory(OfflineDatabase&, int64_t regionID, const std::string& path, const OfflineBulkOptions&);
+
+/*
+ * Writes the tiles of a region that match `options.urlTemplate` and `options.pixelRatio` to a
+ * new MBTiles file, along with the bounds, zoom range and tile format of the region. Throws if
+ * the region doesn't exist. Returns the number of exported tiles.
+ */
+uint64_t exportMBTiles(OfflineDatabase&, int64_t regionID, const std::string& path, const OfflineBulkOptions&);
+
+} // namespace mbgl
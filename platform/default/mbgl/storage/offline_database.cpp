@@ -159,6 +159,19 @@ optional<int64_t> OfflineDatabase::hasInternal(const Resource& resource) {
     }
 }
 
+namespace {
+
+// Compresses response data for storage. Returns nothing if compression doesn't make it smaller.
+optional<std::string> compressForStorage(const std::string& data) {
+    std::string compressed = util::compress(data);
+    if (compressed.size() < data.size()) {
+        return compressed;
+    }
+    return {};
+}
+
+} // namespace
+
 std::pair<bool, uint64_t> OfflineDatabase::put(const Resource& resource, const Response& response) {
     return putInternal(resource, response, true);
 }
@@ -168,16 +181,16 @@ std::pair<bool, uint64_t> OfflineDatabase::putInternal(const Resource& resource,
         return { false, 0 };
     }
 
-    std::string compressedData;
-    bool compressed = false;
+    optional<std::string> compressedData;
     uint64_t size = 0;
 
     if (response.data) {
-        compressedData = util::compress(*response.data);
-        compressed = compressedData.size() < response.data->size();
-        size = compressed ? compressedData.size() : response.data->size();
+        compressedData = compressForStorage(*response.data);
+        size = compressedData ? compressedData->size() : response.data->size();
     }
 
+    const bool compressed = bool(compressedData);
+
     if (evict_ && !evict(size)) {
         Log::Debug(Event::Database, "Unable to make space for entry");
         return { false, 0 };
@@ -185,20 +198,41 @@ std::pair<bool, uint64_t> OfflineDatabase::putInternal(const Resource& resource,
 
     bool inserted;
 
+    // Begin an immediate-mode transaction to ensure that two writers do not attempt
+    // to INSERT a resource at the same moment.
+    mapbox::sqlite::Transaction transaction(*db, mapbox::sqlite::Transaction::Immediate);
+
     if (resource.kind == Resource::Kind::Tile) {
         assert(resource.tileData);
         inserted = putTile(*resource.tileData, response,
-                compressed ? compressedData : response.data ? *response.data : "",
+                compressed ? *compressedData : response.data ? *response.data : "",
                 compressed);
     } else {
         inserted = putResource(resource, response,
-                compressed ? compressedData : response.data ? *response.data : "",
+                compressed ? *compressedData : response.data ? *response.data : "",
                 compressed);
     }
 
+    transaction.commit();
+
     return { inserted, size };
 }
 
+OfflineDatabase::PreparedResource OfflineDatabase::prepareResource(Resource resource, Response response) {
+    PreparedResource result { std::move(resource), std::move(response), {}, false, 0 };
+
+    if (result.response.data) {
+        optional<std::string> compressedData = compressForStorage(*result.response.data);
+        result.compressed = bool(compressedData);
+        result.data = compressedData ? std::move(*compressedData) : *result.response.data;
+        result.size = result.data.size();
+        // The payload now lives in `data`; don't keep a second copy around.
+        result.response.data.reset();
+    }
+
+    return result;
+}
+
 optional<std::pair<Response, uint64_t>> OfflineDatabase::getResource(const Resource& resource) {
     // clang-format off
     Statement accessedStmt = getStatement(
@@ -277,11 +311,8 @@ bool OfflineDatabase::putResource(const Resource& resource,
         return false;
     }
 
-    // We can't use REPLACE because it would change the id value.
-
-    // Begin an immediate-mode transaction to ensure that two writers do not attempt
-    // to INSERT a resource at the same moment.
-    mapbox::sqlite::Transaction transaction(*db, mapbox::sqlite::Transaction::Immediate);
+    // We can't use REPLACE because it would change the id value. The caller holds an
+    // immediate-mode transaction, so no other writer can INSERT the same row meanwhile.
 
     // clang-format off
     Statement update = getStatement(
@@ -313,7 +344,6 @@ bool OfflineDatabase::putResource(const Resource& resource,
 
     update->run();
     if (update->changes() != 0) {
-        transaction.commit();
         return false;
     }
 
@@ -339,7 +369,6 @@ bool OfflineDatabase::putResource(const Resource& resource,
     }
 
     insert->run();
-    transaction.commit();
 
     return true;
 }
@@ -460,11 +489,8 @@ bool OfflineDatabase::putTile(const Resource::TileData& tile,
         return false;
     }
 
-    // We can't use REPLACE because it would change the id value.
-
-    // Begin an immediate-mode transaction to ensure that two writers do not attempt
-    // to INSERT a resource at the same moment.
-    mapbox::sqlite::Transaction transaction(*db, mapbox::sqlite::Transaction::Immediate);
+    // We can't use REPLACE because it would change the id value. The caller holds an
+    // immediate-mode transaction, so no other writer can INSERT the same row meanwhile.
 
     // clang-format off
     Statement update = getStatement(
@@ -502,7 +528,6 @@ bool OfflineDatabase::putTile(const Resource::TileData& tile,
 
     update->run();
     if (update->changes() != 0) {
-        transaction.commit();
         return false;
     }
 
@@ -531,7 +556,6 @@ bool OfflineDatabase::putTile(const Resource::TileData& tile,
     }
 
     insert->run();
-    transaction.commit();
 
     return true;
 }
@@ -618,6 +642,21 @@ optional<int64_t> OfflineDatabase::hasRegionResource(int64_t regionID, const Res
     return response;
 }
 
+std::vector<optional<int64_t>> OfflineDatabase::hasRegionResources(int64_t regionID, const std::vector<Resource>& resources) {
+    std::vector<optional<int64_t>> result;
+    result.reserve(resources.size());
+
+    // Marking the resources as used writes to region_resources and region_tiles; doing that
+    // in one transaction avoids a journal sync per resource.
+    mapbox::sqlite::Transaction transaction(*db);
+    for (const auto& resource : resources) {
+        result.push_back(hasRegionResource(regionID, resource));
+    }
+    transaction.commit();
+
+    return result;
+}
+
 uint64_t OfflineDatabase::putRegionResource(int64_t regionID, const Resource& resource, const Response& response) {
     uint64_t size = putInternal(resource, response, false).second;
     bool previouslyUnused = markUsed(regionID, resource);
@@ -632,6 +671,70 @@ uint64_t OfflineDatabase::putRegionResource(int64_t regionID, const Resource& re
     return size;
 }
 
+uint64_t OfflineDatabase::putRegionResources(int64_t regionID, const std::vector<PreparedResource>& resources) {
+    uint64_t size = 0;
+
+    mapbox::sqlite::Transaction transaction(*db, mapbox::sqlite::Transaction::Immediate);
+
+    for (const auto& prepared : resources) {
+        const Resource& resource = prepared.resource;
+        if (prepared.response.error) {
+            continue;
+        }
+
+        if (resource.kind == Resource::Kind::Tile) {
+            assert(resource.tileData);
+            putTile(*resource.tileData, prepared.response, prepared.data, prepared.compressed);
+        } else {
+            putResource(resource, prepared.response, prepared.data, prepared.compressed);
+        }
+
+        bool previouslyUnused = markUsed(regionID, resource);
+        if (offlineMapboxTileCount
+            && resource.kind == Resource::Kind::Tile
+            && util::mapbox::isMapboxURL(resource.url)
+            && previouslyUnused) {
+            *offlineMapboxTileCount += 1;
+        }
+
+        size += prepared.size;
+    }
+
+    transaction.commit();
+
+    return size;
+}
+
+void OfflineDatabase::forEachRegionTile(int64_t regionID,
+                                        const std::string& urlTemplate,
+                                        std::function<void (const Resource::TileData&, const std::string&)> callback) {
+    // clang-format off
+    Statement stmt = getStatement(
+        //      0            1     2  3  4     5
+        "SELECT pixel_ratio, x, y, z, data, compressed "
+        "FROM region_tiles, tiles "
+        "WHERE region_id    = ?1 "
+        "  AND tile_id      = tiles.id "
+        "  AND url_template = ?2 "
+        "  AND data IS NOT NULL ");
+    // clang-format on
+
+    stmt->bind(1, regionID);
+    stmt->bind(2, urlTemplate);
+
+    while (stmt->run()) {
+        const Resource::TileData tile {
+            urlTemplate,
+            static_cast<uint8_t>(stmt->get<int>(0)),
+            static_cast<int32_t>(stmt->get<int64_t>(1)),
+            static_cast<int32_t>(stmt->get<int64_t>(2)),
+            static_cast<int8_t>(stmt->get<int>(3))
+        };
+        const std::string data = stmt->get<std::string>(4);
+        callback(tile, stmt->get<int>(5) ? util::decompress(data) : data);
+    }
+}
+
 bool OfflineDatabase::markUsed(int64_t regionID, const Resource& resource) {
     if (resource.kind == Resource::Kind::Tile) {
         // clang-format off
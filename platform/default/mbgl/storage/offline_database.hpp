@@ -2,14 +2,17 @@
 
 #include <mbgl/storage/resource.hpp>
 #include <mbgl/storage/offline.hpp>
+#include <mbgl/storage/response.hpp>
 #include <mbgl/util/noncopyable.hpp>
 #include <mbgl/util/optional.hpp>
 #include <mbgl/util/constants.hpp>
 #include <mbgl/util/mapbox.hpp>
 
+#include <functional>
 #include <unordered_map>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace mapbox {
 namespace sqlite {
@@ -20,7 +23,6 @@ class Statement;
 
 namespace mbgl {
 
-class Response;
 class TileID;
 
 class OfflineDatabase : private util::noncopyable {
@@ -47,8 +49,33 @@ public:
     // Return value is (response, stored size)
     optional<std::pair<Response, uint64_t>> getRegionResource(int64_t regionID, const Resource&);
     optional<int64_t> hasRegionResource(int64_t regionID, const Resource&);
+    // Batched version of hasRegionResource that runs in a single transaction.
+    std::vector<optional<int64_t>> hasRegionResources(int64_t regionID, const std::vector<Resource>&);
     uint64_t putRegionResource(int64_t regionID, const Resource&, const Response&);
 
+    // A resource whose response data has already been compressed for storage. Preparing
+    // resources is thread-safe, so bulk imports can compress on worker threads and only
+    // serialize the database writes.
+    struct PreparedResource {
+        Resource resource;
+        Response response;
+        std::string data;
+        bool compressed;
+        uint64_t size;
+    };
+
+    static PreparedResource prepareResource(Resource, Response);
+
+    // Stores a batch of prepared resources for a region in a single transaction. Returns
+    // the total stored size.
+    uint64_t putRegionResources(int64_t regionID, const std::vector<PreparedResource>&);
+
+    // Streams the stored tiles of a region that use the given URL template, with their data
+    // decompressed.
+    void forEachRegionTile(int64_t regionID,
+                           const std::string& urlTemplate,
+                           std::function<void (const Resource::TileData&, const std::string&)>);
+
     OfflineRegionDefinition getRegionDefinition(int64_t regionID);
     OfflineRegionStatus getRegionCompletedStatus(int64_t regionID);
 
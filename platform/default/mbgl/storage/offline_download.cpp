@@ -23,6 +23,9 @@ namespace mbgl {
 
 using namespace style;
 
+// Number of tiles whose presence in the database is checked in a single transaction.
+static const std::size_t tileBatchSize = 256;
+
 OfflineDownload::OfflineDownload(int64_t id_,
                                  OfflineRegionDefinition&& definition_,
                                  OfflineDatabase& offlineDatabase_,
@@ -80,7 +83,7 @@ OfflineRegionStatus OfflineDownload::getStatus() const {
         auto handleTiledSource = [&] (const variant<std::string, Tileset>& urlOrTileset, const uint16_t tileSize) {
             if (urlOrTileset.is<Tileset>()) {
                 result.requiredResourceCount +=
-                    definition.tileCover(type, tileSize, urlOrTileset.get<Tileset>().zoomRange).size();
+                    definition.tileCount(type, tileSize, urlOrTileset.get<Tileset>().zoomRange);
             } else {
                 result.requiredResourceCount += 1;
                 const auto& url = urlOrTileset.get<std::string>();
@@ -90,7 +93,7 @@ OfflineRegionStatus OfflineDownload::getStatus() const {
                     optional<Tileset> tileset = style::conversion::convertJSON<Tileset>(*sourceResponse->data, error);
                     if (tileset) {
                         result.requiredResourceCount +=
-                            definition.tileCover(type, tileSize, (*tileset).zoomRange).size();
+                            definition.tileCount(type, tileSize, (*tileset).zoomRange);
                     }
                 } else {
                     result.requiredResourceCountIsPrecise = false;
@@ -253,7 +256,7 @@ void OfflineDownload::activateDownload() {
    the first few errors is fruitless anyway.
 */
 void OfflineDownload::continueDownload() {
-    if (resourcesRemaining.empty() && status.complete()) {
+    if (resourcesRemaining.empty() && tilesMissing.empty() && tilesRemaining.empty() && status.complete()) {
         setState(OfflineRegionDownloadState::Inactive);
         return;
     }
@@ -262,12 +265,35 @@ void OfflineDownload::continueDownload() {
         ensureResource(resourcesRemaining.front());
         resourcesRemaining.pop_front();
     }
+
+    while (!tilesMissing.empty() && requests.size() < HTTPFileSource::maximumConcurrentRequests()) {
+        Resource tile = std::move(tilesMissing.front());
+        tilesMissing.pop_front();
+        downloadResource(tile, {});
+    }
+
+    // Refill the queue with the next batch of tiles. Like ensureResource, this is deferred to the
+    // run loop so that regions with many already-downloaded tiles don't block it for long.
+    if (resourcesRemaining.empty() && tilesMissing.empty() && !tilesRemaining.empty() && !ensureTilesPending &&
+        requests.size() < HTTPFileSource::maximumConcurrentRequests()) {
+        ensureTilesPending = true;
+        auto workRequestsIt = requests.insert(requests.begin(), nullptr);
+        *workRequestsIt = util::RunLoop::Get()->invokeCancellable([=]() {
+            requests.erase(workRequestsIt);
+            ensureTilesPending = false;
+            ensureTiles();
+            continueDownload();
+        });
+    }
 }
 
 void OfflineDownload::deactivateDownload() {
     requiredSourceURLs.clear();
     resourcesRemaining.clear();
+    tilesMissing.clear();
+    tilesRemaining.clear();
     requests.clear();
+    ensureTilesPending = false;
 }
 
 void OfflineDownload::queueResource(Resource resource) {
@@ -276,10 +302,64 @@ void OfflineDownload::queueResource(Resource resource) {
 }
 
 void OfflineDownload::queueTiles(SourceType type, uint16_t tileSize, const Tileset& tileset) {
-    for (const auto& tile : definition.tileCover(type, tileSize, tileset.zoomRange)) {
-        status.requiredResourceCount++;
-        resourcesRemaining.push_back(
-            Resource::tile(tileset.tiles[0], definition.pixelRatio, tile.x, tile.y, tile.z, tileset.scheme));
+    const Range<uint8_t> zoomRange = definition.coveringZoomRange(type, tileSize, tileset.zoomRange);
+    if (zoomRange.min > zoomRange.max) {
+        return;
+    }
+
+    status.requiredResourceCount += definition.tileCount(type, tileSize, tileset.zoomRange);
+    tilesRemaining.push_back({ tileset.tiles[0], tileset.scheme, zoomRange.min, zoomRange.max,
+                               util::TileCover(definition.bounds, zoomRange.min) });
+}
+
+optional<Resource> OfflineDownload::nextTile() {
+    while (!tilesRemaining.empty()) {
+        TileQueue& queue = tilesRemaining.front();
+        if (auto tile = queue.cover.next()) {
+            const CanonicalTileID& tileID = tile->canonical;
+            return Resource::tile(queue.urlTemplate, definition.pixelRatio, tileID.x, tileID.y, tileID.z, queue.scheme);
+        }
+        if (queue.z < queue.maxZ) {
+            queue.cover = util::TileCover(definition.bounds, ++queue.z);
+        } else {
+            tilesRemaining.pop_front();
+        }
+    }
+    return {};
+}
+
+void OfflineDownload::ensureTiles() {
+    std::vector<Resource> batch;
+    batch.reserve(tileBatchSize);
+    while (batch.size() < tileBatchSize) {
+        optional<Resource> tile = nextTile();
+        if (!tile) {
+            break;
+        }
+        batch.push_back(std::move(*tile));
+    }
+
+    if (batch.empty()) {
+        return;
+    }
+
+    const std::vector<optional<int64_t>> sizes = offlineDatabase.hasRegionResources(id, batch);
+
+    bool changed = false;
+    for (std::size_t i = 0; i < batch.size(); i++) {
+        if (sizes[i]) {
+            status.completedResourceCount++;
+            status.completedResourceSize += *sizes[i];
+            status.completedTileCount += 1;
+            status.completedTileSize += *sizes[i];
+            changed = true;
+        } else {
+            tilesMissing.push_back(std::move(batch[i]));
+        }
+    }
+
+    if (changed) {
+        observer->statusChanged(status);
     }
 }
 
@@ -315,39 +395,44 @@ void OfflineDownload::ensureResource(const Resource& resource,
             return;
         }
 
-        if (checkTileCountLimit(resource)) {
+        downloadResource(resource, callback);
+    });
+}
+
+void OfflineDownload::downloadResource(const Resource& resource,
+                                       std::function<void(Response)> callback) {
+    if (checkTileCountLimit(resource)) {
+        return;
+    }
+
+    auto fileRequestsIt = requests.insert(requests.begin(), nullptr);
+    *fileRequestsIt = onlineFileSource.request(resource, [=](Response onlineResponse) {
+        if (onlineResponse.error) {
+            observer->responseError(*onlineResponse.error);
             return;
         }
 
-        auto fileRequestsIt = requests.insert(requests.begin(), nullptr);
-        *fileRequestsIt = onlineFileSource.request(resource, [=](Response onlineResponse) {
-            if (onlineResponse.error) {
-                observer->responseError(*onlineResponse.error);
-                return;
-            }
-
-            requests.erase(fileRequestsIt);
+        requests.erase(fileRequestsIt);
 
-            if (callback) {
-                callback(onlineResponse);
-            }
+        if (callback) {
+            callback(onlineResponse);
+        }
 
-            status.completedResourceCount++;
-            uint64_t resourceSize = offlineDatabase.putRegionResource(id, resource, onlineResponse);
-            status.completedResourceSize += resourceSize;
-            if (resource.kind == Resource::Kind::Tile) {
-                status.completedTileCount += 1;
-                status.completedTileSize += resourceSize;
-            }
+        status.completedResourceCount++;
+        uint64_t resourceSize = offlineDatabase.putRegionResource(id, resource, onlineResponse);
+        status.completedResourceSize += resourceSize;
+        if (resource.kind == Resource::Kind::Tile) {
+            status.completedTileCount += 1;
+            status.completedTileSize += resourceSize;
+        }
 
-            observer->statusChanged(status);
+        observer->statusChanged(status);
 
-            if (checkTileCountLimit(resource)) {
-                return;
-            }
+        if (checkTileCountLimit(resource)) {
+            return;
+        }
 
-            continueDownload();
-        });
+        continueDownload();
     });
 }
 
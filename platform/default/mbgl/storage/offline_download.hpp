@@ -2,6 +2,8 @@
 
 #include <mbgl/storage/offline.hpp>
 #include <mbgl/storage/resource.hpp>
+#include <mbgl/util/tile_cover.hpp>
+#include <mbgl/util/tileset.hpp>
 
 #include <list>
 #include <unordered_set>
@@ -14,7 +16,6 @@ class OfflineDatabase;
 class FileSource;
 class AsyncRequest;
 class Response;
-class Tileset;
 
 namespace style {
 class Parser;
@@ -46,8 +47,20 @@ private:
      * is deactivated, all in progress requests are cancelled.
      */
     void ensureResource(const Resource&, std::function<void (Response)> = {});
+
+    /*
+     * Request a resource that is known to be missing from the database and store the response.
+     */
+    void downloadResource(const Resource&, std::function<void (Response)>);
     bool checkTileCountLimit(const Resource& resource);
 
+    /*
+     * Pull the next batch of tiles from the lazily enumerated tile covers and check them
+     * against the database in a single transaction. Tiles that are already stored are
+     * counted as completed; the remaining ones are appended to `tilesMissing`.
+     */
+    void ensureTiles();
+
     int64_t id;
     OfflineRegionDefinition definition;
     OfflineDatabase& offlineDatabase;
@@ -59,8 +72,24 @@ private:
     std::unordered_set<std::string> requiredSourceURLs;
     std::deque<Resource> resourcesRemaining;
 
+    // Tiles the last batch check didn't find in the database. They go straight to the network.
+    std::deque<Resource> tilesMissing;
+
+    // Tiles are enumerated on demand rather than materialized up front, so that the memory
+    // used by a download is independent of the number of tiles in the region.
+    struct TileQueue {
+        std::string urlTemplate;
+        Tileset::Scheme scheme;
+        uint8_t z;
+        uint8_t maxZ;
+        util::TileCover cover;
+    };
+    std::deque<TileQueue> tilesRemaining;
+    bool ensureTilesPending = false;
+
     void queueResource(Resource);
     void queueTiles(SourceType, uint16_t tileSize, const Tileset&);
+    optional<Resource> nextTile();
 };
 
 } // namespace mbgl
@@ -45,6 +45,10 @@ ThreadPool::~ThreadPool() {
     }
 }
 
+std::size_t ThreadPool::getThreadCount() const {
+    return threads.size();
+}
+
 void ThreadPool::schedule(std::weak_ptr<Mailbox> mailbox) {
     {
         std::lock_guard<std::mutex> lock(mutex);
@@ -15,6 +15,7 @@ public:
     ~ThreadPool() override;
 
     void schedule(std::weak_ptr<Mailbox>) override;
+    std::size_t getThreadCount() const override;
 
 private:
     std::vector<std::thread> threads;
@@ -0,0 +1,280 @@
+#include <mbgl/util/image_encoder.hpp>
+#include <mbgl/actor/actor.hpp>
+#include <mbgl/actor/parallel_for.hpp>
+#include <mbgl/util/premultiply.hpp>
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace mbgl {
+
+namespace {
+
+// The deflate window is 32 KiB. Priming every strip with the data that precedes it lets strips
+// compress nearly as well as a single stream.
+const std::size_t dictionarySize = 32768;
+
+const char colorTypeRGBA = 6;
+const char colorTypePalette = 3;
+
+void appendUInt32(std::string& out, const uint32_t value) {
+    const char bytes[4] = { char(value >> 24), char(value >> 16), char(value >> 8), char(value) };
+    out.append(bytes, 4);
+}
+
+void addChunk(std::string& png, const char* type, const std::string& data = {}) {
+    uLong crc = crc32(0, reinterpret_cast<const Bytef*>(type), 4);
+    crc = crc32(crc, reinterpret_cast<const Bytef*>(data.data()), uInt(data.size()));
+
+    appendUInt32(png, uint32_t(data.size()));
+    png.append(type, 4);
+    png.append(data);
+    appendUInt32(png, uint32_t(crc));
+}
+
+inline uint32_t color(const uint8_t* src) {
+    uint32_t value;
+    std::memcpy(&value, src, 4);
+    return value;
+}
+
+// Fills PNG scanlines, each prefixed with filter type 0, with one strip of rows per task.
+void fillScanlines(std::string& raw, const uint32_t height, const std::size_t rowBytes,
+                   const uint32_t stripHeight, Scheduler& scheduler,
+                   const std::function<void (uint32_t y, uint8_t* row)>& fillRow) {
+    raw.assign(height * (rowBytes + 1), 0);
+    const uint32_t strips = (height + stripHeight - 1) / stripHeight;
+    parallelFor(scheduler, strips, [&](std::size_t strip) {
+        const uint32_t end = std::min<uint32_t>(height, (strip + 1) * stripHeight);
+        for (uint32_t y = strip * stripHeight; y < end; y++) {
+            fillRow(y, reinterpret_cast<uint8_t*>(&raw[y * (rowBytes + 1) + 1]));
+        }
+    });
+}
+
+struct Strip {
+    std::string deflated;
+    uLong adler;
+    std::size_t length;
+};
+
+// Produces a zlib stream of `raw` whose strips of `stripSize` bytes are deflated in parallel.
+// Strips other than the last one end with a sync flush, which aligns them to a byte boundary
+// without marking the final block, so that they can be concatenated. The checksum of the whole
+// stream is combined from the checksums of the strips.
+std::string deflateStrips(const std::string& raw, const std::size_t stripSize, const int level, Scheduler& scheduler) {
+    const std::size_t count = std::max<std::size_t>(1, (raw.size() + stripSize - 1) / stripSize);
+    std::vector<Strip> strips(count);
+
+    parallelFor(scheduler, count, [&](std::size_t i) {
+        const std::size_t begin = std::min(raw.size(), i * stripSize);
+        const std::size_t end = std::min(raw.size(), begin + stripSize);
+        const bool last = i + 1 == count;
+        const Bytef* data = reinterpret_cast<const Bytef*>(raw.data());
+
+        z_stream stream;
+        std::memset(&stream, 0, sizeof(stream));
+
+        // Negative window bits produce raw deflate data without zlib header and checksum.
+        if (deflateInit2(&stream, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            throw std::runtime_error("failed to initialize deflate");
+        }
+
+        if (begin > 0) {
+            const std::size_t dictionaryBegin = begin - std::min(begin, dictionarySize);
+            deflateSetDictionary(&stream, data + dictionaryBegin, uInt(begin - dictionaryBegin));
+        }
+
+        Strip& strip = strips[i];
+        strip.adler = adler32(adler32(0, nullptr, 0), data + begin, uInt(end - begin));
+        strip.length = end - begin;
+
+        stream.next_in = const_cast<Bytef*>(data + begin);
+        stream.avail_in = uInt(end - begin);
+
+        const int flush = last ? Z_FINISH : Z_SYNC_FLUSH;
+        char out[16384];
+        int code;
+        do {
+            stream.next_out = reinterpret_cast<Bytef*>(out);
+            stream.avail_out = sizeof(out);
+            code = deflate(&stream, flush);
+            strip.deflated.append(out, sizeof(out) - stream.avail_out);
+        } while (code == Z_OK && stream.avail_out == 0);
+
+        deflateEnd(&stream);
+
+        // A repeated sync flush that has nothing left to write reports Z_BUF_ERROR.
+        if (last ? code != Z_STREAM_END : (code != Z_OK && code != Z_BUF_ERROR)) {
+            throw std::runtime_error("failed to deflate image data");
+        }
+    });
+
+    std::size_t length = 2 + 4;
+    for (const auto& strip : strips) {
+        length += strip.deflated.size();
+    }
+
+    std::string result;
+    result.reserve(length);
+
+    // zlib header: deflate with a 32 KiB window and no preset dictionary.
+    result.append({ char(0x78), char(0x9C) });
+
+    uLong adler = adler32(0, nullptr, 0);
+    for (const auto& strip : strips) {
+        result.append(strip.deflated);
+        adler = adler32_combine(adler, strip.adler, z_off_t(strip.length));
+    }
+    appendUInt32(result, uint32_t(adler));
+
+    return result;
+}
+
+std::string assemblePNG(const Size size, const char colorType, const std::string& idat,
+                        const std::string& palette = {}, const std::string& transparency = {}) {
+    // PNG magic bytes
+    const char preamble[8] = { char(0x89), 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+
+    std::string ihdr;
+    appendUInt32(ihdr, size.width);
+    appendUInt32(ihdr, size.height);
+    ihdr.append({
+        8,         // bit depth == 8 bits
+        colorType, // color type
+        0,         // compression method == deflate
+        0,         // filter method == default
+        0,         // interlace method == none
+    });
+
+    std::string png;
+    png.reserve(8 + (12 + ihdr.size()) + (12 + palette.size()) + (12 + transparency.size()) +
+                (12 + idat.size()) + 12);
+    png.append(preamble, 8);
+    addChunk(png, "IHDR", ihdr);
+    if (!palette.empty()) {
+        addChunk(png, "PLTE", palette);
+    }
+    if (!transparency.empty()) {
+        addChunk(png, "tRNS", transparency);
+    }
+    addChunk(png, "IDAT", idat);
+    addChunk(png, "IEND");
+    return png;
+}
+
+std::string encodeRGBA(const PremultipliedImage& image, const ImageEncoderOptions& options, Scheduler& scheduler) {
+    const std::size_t stride = image.stride();
+
+    std::string raw;
+    fillScanlines(raw, image.size.height, stride, options.stripHeight, scheduler, [&](uint32_t y, uint8_t* row) {
+        std::memcpy(row, image.data.get() + y * stride, stride);
+        util::unpremultiply(row, image.size.width);
+    });
+
+    return assemblePNG(image.size, colorTypeRGBA,
+                       deflateStrips(raw, options.stripHeight * (stride + 1), options.compressionLevel, scheduler));
+}
+
+// Returns an empty string if the image has more than 256 distinct colors.
+std::string encodePaletted(const PremultipliedImage& image, const ImageEncoderOptions& options, Scheduler& scheduler) {
+    std::unordered_map<uint32_t, uint8_t> indices;
+    std::string palette;
+    std::string transparency;
+    bool translucent = false;
+
+    const UnassociatedImage unassociated = util::unpremultiply(image.clone());
+    const uint8_t* data = unassociated.data.get();
+    for (std::size_t i = 0; i < unassociated.bytes(); i += 4) {
+        if (indices.count(color(data + i))) {
+            continue;
+        }
+        if (indices.size() == 256) {
+            return {};
+        }
+        indices.emplace(color(data + i), uint8_t(indices.size()));
+
+        const uint8_t* rgba = data + i;
+        palette.append(reinterpret_cast<const char*>(rgba), 3);
+        transparency.append(1, char(rgba[3]));
+        translucent = translucent || rgba[3] != 255;
+    }
+
+    if (!translucent) {
+        transparency.clear();
+    }
+
+    std::string raw;
+    fillScanlines(raw, image.size.height, image.size.width, options.stripHeight, scheduler, [&](uint32_t y, uint8_t* row) {
+        const uint8_t* src = data + y * unassociated.stride();
+        for (uint32_t x = 0; x < unassociated.size.width; x++) {
+            row[x] = indices.find(color(src + x * 4))->second;
+        }
+    });
+
+    return assemblePNG(image.size, colorTypePalette,
+                       deflateStrips(raw, options.stripHeight * (image.size.width + 1), options.compressionLevel, scheduler),
+                       palette, transparency);
+}
+
+} // namespace
+
+std::string encodeImage(const PremultipliedImage& image, const ImageEncoderOptions& options, Scheduler& scheduler) {
+    if (options.stripHeight == 0) {
+        throw std::invalid_argument("strip height must not be zero");
+    }
+
+    switch (options.encoding) {
+    case ImageEncoding::WebP:
+        return encodeWebP(image, options.quality);
+    case ImageEncoding::PalettedPNG: {
+        std::string png = encodePaletted(image, options, scheduler);
+        if (!png.empty()) {
+            return png;
+        }
+        return encodeRGBA(image, options, scheduler);
+    }
+    case ImageEncoding::PNG:
+    default:
+        return encodeRGBA(image, options, scheduler);
+    }
+}
+
+class ImageEncoder::Impl {
+public:
+    Impl(ActorRef<Impl>, Scheduler& scheduler_, ImageEncoderOptions options_)
+        : scheduler(scheduler_), options(std::move(options_)) {
+    }
+
+    void encode(PremultipliedImage image, Callback callback) {
+        std::string data;
+        try {
+            data = encodeImage(image, options, scheduler);
+        } catch (...) {
+            callback(std::current_exception(), {});
+            return;
+        }
+        callback(nullptr, std::move(data));
+    }
+
+private:
+    Scheduler& scheduler;
+    const ImageEncoderOptions options;
+};
+
+ImageEncoder::ImageEncoder(Scheduler& scheduler, ImageEncoderOptions options)
+    : impl(std::make_unique<Actor<Impl>>(scheduler, scheduler, std::move(options))) {
+}
+
+ImageEncoder::~ImageEncoder() = default;
+
+void ImageEncoder::encode(PremultipliedImage image, Callback callback) {
+    impl->invoke(&Impl::encode, std::move(image), std::move(callback));
+}
+
+} // namespace mbgl
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <mbgl/util/image.hpp>
+
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace mbgl {
+
+class Scheduler;
+
+template <class>
+class Actor;
+
+enum class ImageEncoding : uint8_t {
+    PNG,
+    // 8-bit paletted PNG. Images with more than 256 distinct colors are stored as RGBA PNGs.
+    PalettedPNG,
+    WebP,
+};
+
+class ImageEncoderOptions {
+public:
+    ImageEncoding encoding = ImageEncoding::PNG;
+
+    // zlib compression level of PNG images, from 0 (none) to 9 (best).
+    int compressionLevel = 6;
+
+    // Number of image rows per PNG strip. Strips are unpremultiplied and deflated in parallel
+    // and joined into a single zlib stream.
+    uint32_t stripHeight = 128;
+
+    // Quality of WebP images, from 0 to 100. A quality of 100 selects lossless compression.
+    float quality = 90;
+};
+
+/*
+ * Encodes an image, spreading the work for PNG images over `scheduler` and the calling thread.
+ * Returns once the image is encoded.
+ */
+std::string encodeImage(const PremultipliedImage&, const ImageEncoderOptions&, Scheduler&);
+
+/*
+ * Encoder stage that runs on a scheduler, which keeps encoding off the rendering thread. Images
+ * are encoded in the order they're passed in.
+ */
+class ImageEncoder {
+public:
+    // Called on a thread of the scheduler, with either an error or the encoded image.
+    using Callback = std::function<void (std::exception_ptr, std::string)>;
+
+    ImageEncoder(Scheduler&, ImageEncoderOptions);
+    ~ImageEncoder();
+
+    void encode(PremultipliedImage, Callback);
+
+private:
+    class Impl;
+    const std::unique_ptr<Actor<Impl>> impl;
+};
+
+} // namespace mbgl
@@ -16,15 +16,27 @@
 #include <mbgl/util/run_loop.hpp>
 #include <mbgl/util/timer.hpp>
 #include <mbgl/util/http_timeout.hpp>
+#include <mbgl/util/http_concurrency.hpp>
+#include <mbgl/util/url.hpp>
 
 #include <algorithm>
 #include <cassert>
-#include <list>
+#include <limits>
+#include <map>
 #include <unordered_set>
 #include <unordered_map>
 
 namespace mbgl {
 
+namespace {
+
+std::string hostOf(const std::string& url) {
+    const util::URL parsed(url);
+    return url.substr(parsed.domain.first, parsed.domain.second);
+}
+
+} // namespace
+
 class OnlineFileRequest : public AsyncRequest {
 public:
     using Callback = std::function<void (Response)>;
@@ -33,6 +45,7 @@ public:
     ~OnlineFileRequest() override;
 
     void networkIsReachableAgain();
+    void setPriority(Resource::Priority) override;
     void schedule();
     void schedule(optional<Timestamp> expires);
     void completed(Response);
@@ -42,6 +55,10 @@ public:
 
     OnlineFileSource::Impl& impl;
     Resource resource;
+
+    // The host of the resource URL, which the per-host limit is counted by.
+    std::string host;
+
     std::unique_ptr<AsyncRequest> request;
     util::Timer timer;
     Callback callback;
@@ -87,15 +104,16 @@ public:
     void remove(OnlineFileRequest* request) {
         allRequests.erase(request);
         if (activeRequests.erase(request)) {
-            activatePendingRequest();
+            releaseHost(request);
+            activatePendingRequests();
         } else {
             auto it = pendingRequestsMap.find(request);
             if (it != pendingRequestsMap.end()) {
-                pendingRequestsList.erase(it->second);
+                pendingRequestsQueue.erase(it->second);
                 pendingRequestsMap.erase(it);
             }
         }
-        assert(pendingRequestsMap.size() == pendingRequestsList.size());
+        assert(pendingRequestsMap.size() == pendingRequestsQueue.size());
     }
 
     void activateOrQueueRequest(OnlineFileRequest* request) {
@@ -103,42 +121,74 @@ public:
         assert(activeRequests.find(request) == activeRequests.end());
         assert(!request->request);
 
-        if (activeRequests.size() >= HTTPFileSource::maximumConcurrentRequests()) {
+        if (activeRequests.size() >= concurrency.get() || !hostHasCapacity(request)) {
             queueRequest(request);
         } else {
             activateRequest(request);
         }
     }
 
+    // Moves a pending request to its place for the new priority of its resource, ahead of
+    // requests with the same priority that were queued after it. Active requests are left alone.
+    void reprioritize(OnlineFileRequest* request) {
+        auto it = pendingRequestsMap.find(request);
+        if (it == pendingRequestsMap.end()) {
+            return;
+        }
+
+        const PendingKey key { priority(request->resource), it->second->first.second };
+        if (key != it->second->first) {
+            pendingRequestsQueue.erase(it->second);
+            it->second = pendingRequestsQueue.emplace(key, request).first;
+        }
+        assert(pendingRequestsMap.size() == pendingRequestsQueue.size());
+    }
+
     void queueRequest(OnlineFileRequest* request) {
-        auto it = pendingRequestsList.insert(pendingRequestsList.end(), request);
+        auto it = pendingRequestsQueue.emplace(PendingKey { priority(request->resource), pendingSequence++ }, request).first;
         pendingRequestsMap.emplace(request, std::move(it));
-        assert(pendingRequestsMap.size() == pendingRequestsList.size());
+        assert(pendingRequestsMap.size() == pendingRequestsQueue.size());
     }
 
     void activateRequest(OnlineFileRequest* request) {
         activeRequests.insert(request);
+        activeRequestsPerHost[request->host]++;
+        const Timestamp start = util::now();
         request->request = httpFileSource.request(request->resource, [=] (Response response) {
             activeRequests.erase(request);
-            activatePendingRequest();
+            releaseHost(request);
+            concurrency.completed(util::now() - start,
+                response.error ? response.error->reason : Response::Error::Reason::Success);
+            activatePendingRequests();
             request->request.reset();
             request->completed(response);
         });
-        assert(pendingRequestsMap.size() == pendingRequestsList.size());
+        assert(pendingRequestsMap.size() == pendingRequestsQueue.size());
     }
 
-    void activatePendingRequest() {
-        if (pendingRequestsList.empty()) {
-            return;
-        }
+    // Activates pending requests in priority order until the concurrency limit is reached,
+    // skipping requests to hosts that are already at their own limit.
+    void activatePendingRequests() {
+        auto it = pendingRequestsQueue.begin();
+        while (it != pendingRequestsQueue.end() && activeRequests.size() < concurrency.get()) {
+            OnlineFileRequest* request = it->second;
+            if (!hostHasCapacity(request)) {
+                ++it;
+                continue;
+            }
 
-        OnlineFileRequest* request = pendingRequestsList.front();
-        pendingRequestsList.pop_front();
+            it = pendingRequestsQueue.erase(it);
+            pendingRequestsMap.erase(request);
 
-        pendingRequestsMap.erase(request);
+            activateRequest(request);
+        }
+        assert(pendingRequestsMap.size() == pendingRequestsQueue.size());
+    }
 
-        activateRequest(request);
-        assert(pendingRequestsMap.size() == pendingRequestsList.size());
+    void setMaximumConcurrentRequests(uint32_t total, uint32_t perHost) {
+        concurrency.setMaximum(total);
+        maximumRequestsPerHost = std::max(perHost, 1u);
+        activatePendingRequests();
     }
 
     bool isPending(OnlineFileRequest* request) {
@@ -154,6 +204,32 @@ public:
     }
 
 private:
+    // Lower values are activated first: resources that block rendering entirely (styles,
+    // sources, sprites, glyphs) come before tiles, required requests before optional ones,
+    // and regular priority requests before low priority ones.
+    static uint8_t priority(const Resource& resource) {
+        const bool tile = resource.kind == Resource::Kind::Tile || resource.kind == Resource::Kind::Unknown;
+        return (tile ? 4 : 0) +
+               (resource.necessity == Resource::Required ? 0 : 2) +
+               (resource.priority == Resource::Regular ? 0 : 1);
+    }
+
+    bool hostHasCapacity(OnlineFileRequest* request) {
+        if (maximumRequestsPerHost == std::numeric_limits<uint32_t>::max()) {
+            return true;
+        }
+        auto it = activeRequestsPerHost.find(request->host);
+        return it == activeRequestsPerHost.end() || it->second < maximumRequestsPerHost;
+    }
+
+    void releaseHost(OnlineFileRequest* request) {
+        auto it = activeRequestsPerHost.find(request->host);
+        assert(it != activeRequestsPerHost.end());
+        if (--it->second == 0) {
+            activeRequestsPerHost.erase(it);
+        }
+    }
+
     void networkIsReachableAgain() {
         for (auto& request : allRequests) {
             request->networkIsReachableAgain();
@@ -171,12 +247,25 @@ private:
      * 4. Back to #1
      *
      * Requests in any state are in `allRequests`. Requests in the pending state are in
-     * `pendingRequests`. Requests in the active state are in `activeRequests`.
+     * `pendingRequestsQueue`, ordered by priority and then by the time they were queued.
+     * Requests in the active state are in `activeRequests`.
      */
+    using PendingKey = std::pair<uint8_t, uint64_t>;
+    using PendingQueue = std::map<PendingKey, OnlineFileRequest*>;
+
     std::unordered_set<OnlineFileRequest*> allRequests;
-    std::list<OnlineFileRequest*> pendingRequestsList;
-    std::unordered_map<OnlineFileRequest*, std::list<OnlineFileRequest*>::iterator> pendingRequestsMap;
+    PendingQueue pendingRequestsQueue;
+    std::unordered_map<OnlineFileRequest*, PendingQueue::iterator> pendingRequestsMap;
+    uint64_t pendingSequence = 0;
     std::unordered_set<OnlineFileRequest*> activeRequests;
+    std::unordered_map<std::string, uint32_t> activeRequestsPerHost;
+
+    // The platform's default limit is both the starting point and the ceiling, until raised
+    // with setMaximumConcurrentRequests().
+    http::ConcurrencyLimit concurrency { 2,
+                                         HTTPFileSource::maximumConcurrentRequests(),
+                                         HTTPFileSource::maximumConcurrentRequests() };
+    uint32_t maximumRequestsPerHost = std::numeric_limits<uint32_t>::max();
 
     HTTPFileSource httpFileSource;
     util::AsyncTask reachability { std::bind(&Impl::networkIsReachableAgain, this) };
@@ -225,9 +314,14 @@ void OnlineFileSource::setResourceTransform(optional<ActorRef<ResourceTransform>
     impl->setResourceTransform(std::move(transform));
 }
 
+void OnlineFileSource::setMaximumConcurrentRequests(uint32_t total, uint32_t perHost) {
+    impl->setMaximumConcurrentRequests(total, perHost);
+}
+
 OnlineFileRequest::OnlineFileRequest(Resource resource_, Callback callback_, OnlineFileSource::Impl& impl_)
     : impl(impl_),
       resource(std::move(resource_)),
+      host(hostOf(resource.url)),
       callback(std::move(callback_)) {
     impl.add(this);
 }
@@ -245,6 +339,12 @@ OnlineFileRequest::~OnlineFileRequest() {
     impl.remove(this);
 }
 
+void OnlineFileRequest::setPriority(Resource::Priority priority) {
+    // Requests that aren't queued yet are queued with the new priority once they are made.
+    resource.priority = priority;
+    impl.reprioritize(this);
+}
+
 Timestamp interpolateExpiration(const Timestamp& current,
                                 optional<Timestamp> prior,
                                 bool& expired) {
@@ -368,6 +468,7 @@ void OnlineFileRequest::networkIsReachableAgain() {
 
 void OnlineFileRequest::setTransformedURL(const std::string&& url) {
      resource.url = std::move(url);
+     host = hostOf(resource.url);
      schedule();
 }
 
@@ -1,10 +1,9 @@
 #include <mbgl/util/image.hpp>
+#include <mbgl/util/image_buffer_pool.hpp>
 #include <mbgl/util/premultiply.hpp>
-#include <mbgl/util/char_array_buffer.hpp>
 #include <mbgl/util/logging.hpp>
 
-#include <istream>
-#include <sstream>
+#include <cstring>
 
 extern "C"
 {
@@ -39,14 +38,20 @@ static void user_warning_fn(png_structp, png_const_charp warning_msg) {
     Log::Warning(Event::Image, "ImageReader (PNG): %s", warning_msg);
 }
 
+struct png_memory_source {
+    const uint8_t* data;
+    size_t size;
+    size_t offset;
+};
+
 static void png_read_data(png_structp png_ptr, png_bytep data, png_size_t length) {
-    auto* fin = reinterpret_cast<std::istream*>(png_get_io_ptr(png_ptr));
-    fin->read(reinterpret_cast<char*>(data), length);
-    std::streamsize read_count = fin->gcount();
-    if (read_count < 0 || static_cast<png_size_t>(read_count) != length)
+    auto* source = reinterpret_cast<png_memory_source*>(png_get_io_ptr(png_ptr));
+    if (length > source->size - source->offset)
     {
         png_error(png_ptr, "Read Error");
     }
+    std::memcpy(data, source->data + source->offset, length);
+    source->offset += length;
 }
 
 struct png_struct_guard {
@@ -62,16 +67,11 @@ struct png_struct_guard {
     png_infopp i_;
 };
 
-PremultipliedImage decodePNG(const uint8_t* data, size_t size) {
-    util::CharArrayBuffer dataBuffer { reinterpret_cast<const char*>(data), size };
-    std::istream stream(&dataBuffer);
-
-    png_byte header[8] = { 0 };
-    stream.read(reinterpret_cast<char*>(header), 8);
-    if (stream.gcount() != 8)
+PremultipliedImage decodePNG(const uint8_t* data, size_t size, ImageBufferPool* pool) {
+    if (size < 8)
         throw std::runtime_error("PNG reader: Could not read image");
 
-    int is_png = !png_sig_cmp(header, 0, 8);
+    int is_png = !png_sig_cmp(data, 0, 8);
     if (!is_png)
         throw std::runtime_error("File or stream is not a png");
 
@@ -88,7 +88,9 @@ PremultipliedImage decodePNG(const uint8_t* data, size_t size) {
     if (!info_ptr)
         throw std::runtime_error("failed to create info_ptr");
 
-    png_set_read_fn(png_ptr, &stream, png_read_data);
+    // Reads straight from the encoded buffer, past the signature checked above.
+    png_memory_source source { data, size, 8 };
+    png_set_read_fn(png_ptr, &source, png_read_data);
     png_set_sig_bytes(png_ptr, 8);
     png_read_info(png_ptr, info_ptr);
 
@@ -98,7 +100,8 @@ PremultipliedImage decodePNG(const uint8_t* data, size_t size) {
     int color_type = 0;
     png_get_IHDR(png_ptr, info_ptr, &width, &height, &bit_depth, &color_type, nullptr, nullptr, nullptr);
 
-    UnassociatedImage image({ static_cast<uint32_t>(width), static_cast<uint32_t>(height) });
+    // Images without an alpha channel or transparent color are opaque and need no premultiplication.
+    const bool opaque = !(color_type & PNG_COLOR_MASK_ALPHA) && !png_get_valid(png_ptr, info_ptr, PNG_INFO_tRNS);
 
     if (color_type == PNG_COLOR_TYPE_PALETTE)
         png_set_expand(png_ptr);
@@ -118,25 +121,39 @@ PremultipliedImage decodePNG(const uint8_t* data, size_t size) {
 
     png_set_add_alpha(png_ptr, 0xff, PNG_FILLER_AFTER);
 
-    if (png_get_interlace_type(png_ptr,info_ptr) == PNG_INTERLACE_ADAM7) {
-        png_set_interlace_handling(png_ptr); // FIXME: libpng bug?
-        // according to docs png_read_image
-        // "..automatically handles interlacing,
-        // so you don't need to call png_set_interlace_handling()"
+    const bool interlaced = png_get_interlace_type(png_ptr, info_ptr) == PNG_INTERLACE_ADAM7;
+    if (interlaced) {
+        png_set_interlace_handling(png_ptr);
     }
 
     png_read_update_info(png_ptr, info_ptr);
 
-    // we can read whole image at once
-    // alloc row pointers
-    const std::unique_ptr<png_bytep[]> rows(new png_bytep[height]);
-    for (unsigned row = 0; row < height; ++row)
-        rows[row] = image.data.get() + row * width * 4;
-    png_read_image(png_ptr, rows.get());
+    const Size imageSize { static_cast<uint32_t>(width), static_cast<uint32_t>(height) };
+    const size_t bytes = size_t(width) * height * 4;
+    PremultipliedImage image(imageSize, pool ? pool->acquire(bytes) : std::unique_ptr<uint8_t[]>(new uint8_t[bytes]));
+    const size_t stride = image.stride();
+
+    if (interlaced) {
+        // Interlaced passes revisit every row, so rows are only complete at the end.
+        const std::unique_ptr<png_bytep[]> rows(new png_bytep[height]);
+        for (unsigned row = 0; row < height; ++row)
+            rows[row] = image.data.get() + row * stride;
+        png_read_image(png_ptr, rows.get());
+        if (!opaque)
+            util::premultiply(image.data.get(), imageSize.area());
+    } else {
+        // Premultiply each row while it is still in the cache.
+        for (unsigned row = 0; row < height; ++row) {
+            png_bytep rowData = image.data.get() + row * stride;
+            png_read_row(png_ptr, rowData, nullptr);
+            if (!opaque)
+                util::premultiply(rowData, width);
+        }
+    }
 
     png_read_end(png_ptr, nullptr);
 
-    return util::premultiply(std::move(image));
+    return image;
 }
 
 } // namespace mbgl
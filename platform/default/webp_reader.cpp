@@ -1,4 +1,5 @@
 #include <mbgl/util/image.hpp>
+#include <mbgl/util/image_buffer_pool.hpp>
 #include <mbgl/util/premultiply.hpp>
 #include <mbgl/util/logging.hpp>
 
@@ -9,23 +10,32 @@ extern "C"
 
 namespace mbgl {
 
-PremultipliedImage decodeWebP(const uint8_t* data, size_t size) {
-    int width = 0, height = 0;
-    if (WebPGetInfo(data, size, &width, &height) == 0) {
+PremultipliedImage decodeWebP(const uint8_t* data, size_t size, ImageBufferPool* pool) {
+    WebPBitstreamFeatures features;
+    if (WebPGetFeatures(data, size, &features) != VP8_STATUS_OK) {
         throw std::runtime_error("failed to retrieve WebP basic header information");
     }
 
+    const int width = features.width;
+    const int height = features.height;
     int stride = width * 4;
     size_t webpSize = stride * height;
-    auto webp = std::make_unique<uint8_t[]>(webpSize);
+    auto webp = pool ? pool->acquire(webpSize) : std::unique_ptr<uint8_t[]>(new uint8_t[webpSize]);
 
     if (!WebPDecodeRGBAInto(data, size, webp.get(), webpSize, stride)) {
         throw std::runtime_error("failed to decode WebP data");
     }
 
-    UnassociatedImage image({ static_cast<uint32_t>(width), static_cast<uint32_t>(height) },
-                            std::move(webp));
-    return util::premultiply(std::move(image));
+    PremultipliedImage image({ static_cast<uint32_t>(width), static_cast<uint32_t>(height) },
+                             std::move(webp));
+
+    // libwebp can premultiply while decoding, but with different rounding than ours. Opaque
+    // images, which most raster tiles are, need no premultiplication at all.
+    if (features.has_alpha) {
+        util::premultiply(image.data.get(), image.size.area());
+    }
+
+    return image;
 }
 
 } // namespace mbgl
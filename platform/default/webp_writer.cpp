@@ -0,0 +1,34 @@
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/premultiply.hpp>
+
+extern "C"
+{
+#include <webp/encode.h>
+}
+
+#include <cstdlib>
+#include <stdexcept>
+
+namespace mbgl {
+
+std::string encodeWebP(const PremultipliedImage& pre, float quality) {
+    const auto src = util::unpremultiply(pre.clone());
+    const int width = src.size.width;
+    const int height = src.size.height;
+    const int stride = src.stride();
+
+    uint8_t* output = nullptr;
+    const size_t size = quality >= 100
+        ? WebPEncodeLosslessRGBA(src.data.get(), width, height, stride, &output)
+        : WebPEncodeRGBA(src.data.get(), width, height, stride, quality, &output);
+
+    if (size == 0) {
+        throw std::runtime_error("failed to encode WebP image");
+    }
+
+    std::string webp(reinterpret_cast<const char*>(output), size);
+    std::free(output);
+    return webp;
+}
+
+} // namespace mbgl
@@ -26,6 +26,8 @@ macro(mbgl_platform_core)
 
         # Offline
         PRIVATE platform/default/mbgl/storage/offline.cpp
+        PRIVATE platform/default/mbgl/storage/offline_bulk.cpp
+        PRIVATE platform/default/mbgl/storage/offline_bulk.hpp
         PRIVATE platform/default/mbgl/storage/offline_database.cpp
         PRIVATE platform/default/mbgl/storage/offline_database.hpp
         PRIVATE platform/default/mbgl/storage/offline_download.cpp
@@ -47,6 +49,8 @@ macro(mbgl_platform_core)
         PRIVATE platform/darwin/mbgl/util/image+MGLAdditions.hpp
         PRIVATE platform/darwin/src/image.mm
         PRIVATE platform/default/png_writer.cpp
+        PRIVATE platform/default/mbgl/util/image_encoder.cpp
+        PRIVATE platform/default/mbgl/util/image_encoder.hpp
 
         # Headless view
         PRIVATE platform/default/mbgl/gl/headless_backend.cpp
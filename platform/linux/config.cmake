@@ -57,6 +57,8 @@ macro(mbgl_platform_core)
 
         # Offline
         PRIVATE platform/default/mbgl/storage/offline.cpp
+        PRIVATE platform/default/mbgl/storage/offline_bulk.cpp
+        PRIVATE platform/default/mbgl/storage/offline_bulk.hpp
         PRIVATE platform/default/mbgl/storage/offline_database.cpp
         PRIVATE platform/default/mbgl/storage/offline_database.hpp
         PRIVATE platform/default/mbgl/storage/offline_download.cpp
@@ -76,8 +78,11 @@ macro(mbgl_platform_core)
         PRIVATE platform/default/image.cpp
         PRIVATE platform/default/jpeg_reader.cpp
         PRIVATE platform/default/png_writer.cpp
+        PRIVATE platform/default/mbgl/util/image_encoder.cpp
+        PRIVATE platform/default/mbgl/util/image_encoder.hpp
         PRIVATE platform/default/png_reader.cpp
         PRIVATE platform/default/webp_reader.cpp
+        PRIVATE platform/default/webp_writer.cpp
 
         # Headless view
         PRIVATE platform/default/mbgl/gl/headless_backend.cpp
@@ -29,6 +29,15 @@ struct NodeMap::RenderOptions {
     unsigned int width = 512;
     unsigned int height = 512;
     std::vector<std::string> classes;
+    bool tile = false;
+    uint32_t tileZ = 0;
+    uint32_t tileX = 0;
+    uint32_t tileY = 0;
+    uint32_t metatile = 1;
+    uint32_t tileSize = 256;
+    uint32_t buffer = 0;
+    std::string format;
+    float quality = 90;
     mbgl::MapDebugOptions debugOptions = mbgl::MapDebugOptions::NoDebug;
 };
 
@@ -107,6 +116,8 @@ void NodeMap::Init(v8::Local<v8::Object> target) {
  * over the internet
  * @param {Function} [options.cancel]
  * @param {number} options.ratio pixel ratio
+ * @param {string} [options.mode='still'] `'tile'` to render tiles and
+ * metatiles for tile servers
  * @example
  * var map = new mbgl.Map({ request: function() {} });
  * map.load(require('./test/fixtures/style.json'));
@@ -143,6 +154,14 @@ void NodeMap::New(const Nan::FunctionCallbackInfo<v8::Value>& info) {
         return Nan::ThrowError("Options object 'ratio' property must be a number");
     }
 
+    if (Nan::Has(options, Nan::New("mode").ToLocalChecked()).FromJust()) {
+        auto mode = Nan::Get(options, Nan::New("mode").ToLocalChecked()).ToLocalChecked();
+        if (!mode->IsString() || (std::string(*Nan::Utf8String(mode)) != "still" &&
+                                  std::string(*Nan::Utf8String(mode)) != "tile")) {
+            return Nan::ThrowError("Options object 'mode' property must be 'still' or 'tile'");
+        }
+    }
+
     info.This()->SetInternalField(1, options);
 
     try {
@@ -265,6 +284,37 @@ NodeMap::RenderOptions NodeMap::ParseOptions(v8::Local<v8::Object> obj) {
         options.height = Nan::Get(obj, Nan::New("height").ToLocalChecked()).ToLocalChecked()->IntegerValue();
     }
 
+    if (Nan::Has(obj, Nan::New("tile").ToLocalChecked()).FromJust()) {
+        auto tileObj = Nan::Get(obj, Nan::New("tile").ToLocalChecked()).ToLocalChecked();
+        if (tileObj->IsArray() && tileObj.As<v8::Array>()->Length() == 3) {
+            auto tile = tileObj.As<v8::Array>();
+            options.tile = true;
+            options.tileZ = Nan::Get(tile, 0).ToLocalChecked()->Uint32Value();
+            options.tileX = Nan::Get(tile, 1).ToLocalChecked()->Uint32Value();
+            options.tileY = Nan::Get(tile, 2).ToLocalChecked()->Uint32Value();
+        }
+    }
+
+    if (Nan::Has(obj, Nan::New("metatile").ToLocalChecked()).FromJust()) {
+        options.metatile = Nan::Get(obj, Nan::New("metatile").ToLocalChecked()).ToLocalChecked()->Uint32Value();
+    }
+
+    if (Nan::Has(obj, Nan::New("tileSize").ToLocalChecked()).FromJust()) {
+        options.tileSize = Nan::Get(obj, Nan::New("tileSize").ToLocalChecked()).ToLocalChecked()->Uint32Value();
+    }
+
+    if (Nan::Has(obj, Nan::New("buffer").ToLocalChecked()).FromJust()) {
+        options.buffer = Nan::Get(obj, Nan::New("buffer").ToLocalChecked()).ToLocalChecked()->Uint32Value();
+    }
+
+    if (Nan::Has(obj, Nan::New("format").ToLocalChecked()).FromJust()) {
+        options.format = *Nan::Utf8String(Nan::Get(obj, Nan::New("format").ToLocalChecked()).ToLocalChecked());
+    }
+
+    if (Nan::Has(obj, Nan::New("quality").ToLocalChecked()).FromJust()) {
+        options.quality = Nan::Get(obj, Nan::New("quality").ToLocalChecked()).ToLocalChecked()->NumberValue();
+    }
+
     if (Nan::Has(obj, Nan::New("classes").ToLocalChecked()).FromJust()) {
         auto classes = Nan::To<v8::Object>(Nan::Get(obj, Nan::New("classes").ToLocalChecked()).ToLocalChecked()).ToLocalChecked().As<v8::Array>();
         const int length = classes->Length();
@@ -318,6 +368,20 @@ NodeMap::RenderOptions NodeMap::ParseOptions(v8::Local<v8::Object> obj) {
  * of the map
  * @param {number} [options.bearing=0] rotation
  * @param {Array<string>} [options.classes=[]] style classes
+ * @param {Array<number>} [options.tile] zoom, x and y of a tile. Only in tile
+ * mode: renders the metatile that contains this tile instead of the camera
+ * and size options, and calls back with an array of `{ z, x, y, pixels }`
+ * objects, one per tile of the metatile
+ * @param {number} [options.metatile=1] number of tiles per row and column of
+ * the metatile
+ * @param {number} [options.tileSize=256] tile size in pixels
+ * @param {number} [options.buffer=0] margin in pixels rendered around the
+ * metatile to avoid cutting off labels along its edges
+ * @param {string} [options.format] `png`, `png8` (paletted when possible) or
+ * `webp`. Encodes the image on the thread pool and calls back with the encoded
+ * data instead of raw pixels; tiles of a metatile carry it as `data`
+ * @param {number} [options.quality=90] WebP quality from 0 to 100, where 100
+ * is lossless
  * @param {Function} callback
  * @returns {undefined} calls callback
  * @throws {Error} if stylesheet is not loaded or if map is already rendering
@@ -344,10 +408,40 @@ void NodeMap::Render(const Nan::FunctionCallbackInfo<v8::Value>& info) {
 
     auto options = ParseOptions(Nan::To<v8::Object>(info[0]).ToLocalChecked());
 
+    mbgl::ImageEncoderOptions encoderOptions;
+    if (options.format == "png8") {
+        encoderOptions.encoding = mbgl::ImageEncoding::PalettedPNG;
+    } else if (options.format == "webp") {
+        encoderOptions.encoding = mbgl::ImageEncoding::WebP;
+        encoderOptions.quality = options.quality;
+    } else if (!options.format.empty() && options.format != "png") {
+        return Nan::ThrowTypeError("format must be one of 'png', 'png8' or 'webp'");
+    }
+
+    if (options.tile) {
+        if (nodeMap->mode != mbgl::MapMode::Tile) {
+            return Nan::ThrowError("Map is not in tile mode");
+        }
+        if (options.tileZ > 255) {
+            return Nan::ThrowError("metatile zoom level is out of range");
+        }
+        try {
+            nodeMap->metatile = std::make_unique<mbgl::Metatile>(options.tileZ, options.tileX, options.tileY,
+                                                                 options.metatile, options.tileSize, options.buffer);
+        } catch (const std::exception& ex) {
+            return Nan::ThrowError(ex.what());
+        }
+    }
+
     assert(!nodeMap->callback);
     assert(!nodeMap->image.data);
+    assert(!nodeMap->encoder);
     nodeMap->callback = std::make_unique<Nan::Callback>(info[1].As<v8::Function>());
 
+    if (!options.format.empty()) {
+        nodeMap->encoder = std::make_unique<mbgl::ImageEncoder>(nodeMap->threadpool, encoderOptions);
+    }
+
     try {
         nodeMap->startRender(std::move(options));
     } catch (mbgl::util::Exception &ex) {
@@ -358,6 +452,14 @@ void NodeMap::Render(const Nan::FunctionCallbackInfo<v8::Value>& info) {
 }
 
 void NodeMap::startRender(NodeMap::RenderOptions options) {
+    // Completions of a canceled render carry an older generation, so they can't finish this one.
+    const uint64_t generation = ++renderGeneration;
+
+    if (metatile) {
+        options.width = metatile->renderSize().width;
+        options.height = metatile->renderSize().height;
+    }
+
     map->setSize({ options.width, options.height });
 
     const mbgl::Size fbSize{ static_cast<uint32_t>(options.width * pixelRatio),
@@ -368,35 +470,41 @@ void NodeMap::startRender(NodeMap::RenderOptions options) {
         view = std::make_unique<mbgl::OffscreenView>(backend.getContext(), fbSize);
     }
 
-    if (map->getZoom() != options.zoom) {
-        map->setZoom(options.zoom);
-    }
+    if (metatile) {
+        map->jumpTo(metatile->camera());
+    } else {
+        if (map->getZoom() != options.zoom) {
+            map->setZoom(options.zoom);
+        }
 
-    mbgl::LatLng latLng(options.latitude, options.longitude);
-    if (map->getLatLng() != latLng) {
-        map->setLatLng(latLng);
-    }
+        mbgl::LatLng latLng(options.latitude, options.longitude);
+        if (map->getLatLng() != latLng) {
+            map->setLatLng(latLng);
+        }
 
-    if (map->getBearing() != options.bearing) {
-        map->setBearing(options.bearing);
-    }
+        if (map->getBearing() != options.bearing) {
+            map->setBearing(options.bearing);
+        }
 
-    if (map->getPitch() != options.pitch) {
-        map->setPitch(options.pitch);
+        if (map->getPitch() != options.pitch) {
+            map->setPitch(options.pitch);
+        }
     }
 
     if (map->getDebug() != options.debugOptions) {
         map->setDebug(options.debugOptions);
     }
 
-    map->renderStill([this](const std::exception_ptr eptr) {
+    map->renderStill([this, generation](const std::exception_ptr eptr) {
         if (eptr) {
             error = std::move(eptr);
-            uv_async_send(async);
+            signalRenderFinished(generation);
+        } else if (encoder) {
+            encodeImages(generation);
         } else {
-            assert(!image.data);
-            image = view->readStillImage();
-            uv_async_send(async);
+            assert(!pendingImage.valid());
+            pendingImage = view->readStillImageAsync();
+            signalRenderFinished(generation);
         }
     });
 
@@ -409,6 +517,49 @@ void NodeMap::startRender(NodeMap::RenderOptions options) {
     uv_ref(reinterpret_cast<uv_handle_t *>(async));
 }
 
+// Encodes the rendered image, or each tile of the metatile, on the thread pool. The encoder
+// calls back one image at a time, possibly on different threads, so every image has its own
+// result and error. The last one signals completion.
+void NodeMap::encodeImages(uint64_t generation) {
+    std::vector<mbgl::PremultipliedImage> images;
+    if (metatile) {
+        try {
+            tiles = metatile->slice(view->readStillImage(), pixelRatio);
+        } catch (...) {
+            error = std::current_exception();
+            signalRenderFinished(generation);
+            return;
+        }
+        for (auto& tile : tiles) {
+            images.push_back(std::move(tile.image));
+        }
+    } else {
+        images.push_back(view->readStillImage());
+    }
+
+    encoded.resize(images.size());
+    encodeErrors.resize(images.size());
+    pendingEncodes = images.size();
+    for (std::size_t i = 0; i < images.size(); i++) {
+        encoder->encode(std::move(images[i]), [this, i, generation](std::exception_ptr eptr, std::string data) {
+            if (eptr) {
+                encodeErrors[i] = std::move(eptr);
+            } else {
+                encoded[i] = std::move(data);
+            }
+            if (--pendingEncodes == 0) {
+                signalRenderFinished(generation);
+            }
+        });
+    }
+}
+
+// May be called on any thread.
+void NodeMap::signalRenderFinished(uint64_t generation) {
+    finishedGeneration = generation;
+    uv_async_send(async);
+}
+
 void NodeMap::renderFinished() {
     Nan::HandleScope scope;
 
@@ -419,14 +570,42 @@ void NodeMap::renderFinished() {
     // of scope.
     Unref();
 
-    // Move the callback and image out of the way so that the callback can start a new render call.
+    // The pixels were transferred while the loop got around to calling us.
+    if (pendingImage.valid()) {
+        mbgl::BackendScope backendScope { backend };
+        image = pendingImage.get();
+    }
+
+    // Move the callback and images out of the way so that the callback can start a new render call.
+    // Destroying the encoder waits for an image that is still being encoded after a cancelation.
+    encoder.reset();
+    for (auto& encodeError : encodeErrors) {
+        if (encodeError && !error) {
+            error = std::move(encodeError);
+        }
+    }
+    encodeErrors.clear();
     auto cb = std::move(callback);
     auto img = std::move(image);
+    auto data = std::move(encoded);
+    auto slices = std::move(tiles);
     assert(cb);
 
+    if (metatile && img.data && !error) {
+        try {
+            slices = metatile->slice(img, pixelRatio);
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }
+    metatile.reset();
+
     // These have to be empty to be prepared for the next render call.
     assert(!callback);
     assert(!image.data);
+    assert(encoded.empty());
+    assert(encodeErrors.empty());
+    assert(tiles.empty());
 
     if (error) {
         std::string errorMessage;
@@ -446,6 +625,45 @@ void NodeMap::renderFinished() {
         assert(!error);
 
         cb->Call(1, argv);
+    } else if (!slices.empty()) {
+        auto array = Nan::New<v8::Array>();
+        for (uint32_t i = 0; i < slices.size(); i++) {
+            auto& tile = slices[i];
+            auto result = Nan::New<v8::Object>();
+            Nan::Set(result, Nan::New("z").ToLocalChecked(), Nan::New<v8::Uint32>(uint32_t(tile.z)));
+            Nan::Set(result, Nan::New("x").ToLocalChecked(), Nan::New<v8::Uint32>(tile.x));
+            Nan::Set(result, Nan::New("y").ToLocalChecked(), Nan::New<v8::Uint32>(tile.y));
+
+            if (!data.empty()) {
+                Nan::Set(result, Nan::New("data").ToLocalChecked(),
+                         Nan::CopyBuffer(data[i].data(), data[i].size()).ToLocalChecked());
+            } else {
+                v8::Local<v8::Object> pixels = Nan::NewBuffer(
+                    reinterpret_cast<char *>(tile.image.data.get()), tile.image.bytes(),
+                    // Retain the data until the buffer is deleted.
+                    [](char *, void * hint) {
+                        delete [] reinterpret_cast<uint8_t*>(hint);
+                    },
+                    tile.image.data.get()
+                ).ToLocalChecked();
+                tile.image.data.release();
+                Nan::Set(result, Nan::New("pixels").ToLocalChecked(), pixels);
+            }
+
+            Nan::Set(array, i, result);
+        }
+
+        v8::Local<v8::Value> argv[] = {
+            Nan::Null(),
+            array
+        };
+        cb->Call(2, argv);
+    } else if (!data.empty()) {
+        v8::Local<v8::Value> argv[] = {
+            Nan::Null(),
+            Nan::CopyBuffer(data.front().data(), data.front().size()).ToLocalChecked()
+        };
+        cb->Call(2, argv);
     } else if (img.data) {
         v8::Local<v8::Object> pixels = Nan::NewBuffer(
             reinterpret_cast<char *>(img.data.get()), img.bytes(),
@@ -528,7 +746,7 @@ void NodeMap::cancel() {
     auto renderer = std::make_unique<mbgl::Renderer>(backend, pixelRatio, *this, threadpool);
     rendererFrontend = std::make_unique<NodeRendererFrontend>(std::move(renderer), [this] { return view.get(); });
     map = std::make_unique<mbgl::Map>(*rendererFrontend, mapObserver, mbgl::Size{ 256, 256 }, pixelRatio,
-                                      *this, threadpool, mbgl::MapMode::Still);
+                                      *this, threadpool, mode);
 
     // FIXME: Reload the style after recreating the map. We need to find
     // a better way of canceling an ongoing rendering on the core level
@@ -984,6 +1202,14 @@ NodeMap::NodeMap(v8::Local<v8::Object> options)
                            ->NumberValue()
                      : 1.0;
       }())
+    , mode([&] {
+          Nan::HandleScope scope;
+          return Nan::Has(options, Nan::New("mode").ToLocalChecked()).FromJust() &&
+                         std::string(*Nan::Utf8String(Nan::Get(options, Nan::New("mode").ToLocalChecked())
+                                                          .ToLocalChecked())) == "tile"
+                     ? mbgl::MapMode::Tile
+                     : mbgl::MapMode::Still;
+      }())
     , mapObserver(NodeMapObserver())
     , rendererFrontend(std::make_unique<NodeRendererFrontend>(std::make_unique<mbgl::Renderer>(backend, pixelRatio, *this, threadpool), [this] { return view.get(); }))
     , map(std::make_unique<mbgl::Map>(*rendererFrontend,
@@ -992,12 +1218,17 @@ NodeMap::NodeMap(v8::Local<v8::Object> options)
                                       pixelRatio,
                                       *this,
                                       threadpool,
-                                      mbgl::MapMode::Still)),
+                                      mode)),
       async(new uv_async_t) {
 
     async->data = this;
     uv_async_init(uv_default_loop(), async, [](uv_async_t* h) {
-        reinterpret_cast<NodeMap *>(h->data)->renderFinished();
+        auto nodeMap = reinterpret_cast<NodeMap *>(h->data);
+        // The last image of a canceled render may finish encoding while it's being canceled, and
+        // its notification may only arrive once the next render has started.
+        if (nodeMap->callback && nodeMap->finishedGeneration == nodeMap->renderGeneration) {
+            nodeMap->renderFinished();
+        }
     });
 
     // Make sure the async handle doesn't keep the loop alive.
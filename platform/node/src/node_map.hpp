@@ -3,11 +3,18 @@
 #include "node_thread_pool.hpp"
 
 #include <mbgl/map/map.hpp>
+#include <mbgl/map/metatile.hpp>
 #include <mbgl/storage/file_source.hpp>
 #include <mbgl/gl/headless_backend.hpp>
 #include <mbgl/gl/offscreen_view.hpp>
+#include <mbgl/util/image_encoder.hpp>
 
+#include <atomic>
+#include <cstdint>
 #include <exception>
+#include <future>
+#include <string>
+#include <vector>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-parameter"
@@ -63,6 +70,8 @@ public:
     static void QueryRenderedFeatures(const Nan::FunctionCallbackInfo<v8::Value>&);
 
     void startRender(RenderOptions options);
+    void encodeImages(uint64_t generation);
+    void signalRenderFinished(uint64_t generation);
     void renderFinished();
 
     void release();
@@ -73,6 +82,7 @@ public:
     std::unique_ptr<mbgl::AsyncRequest> request(const mbgl::Resource&, mbgl::FileSource::Callback);
 
     const float pixelRatio;
+    const mbgl::MapMode mode;
     NodeBackend backend;
     std::unique_ptr<mbgl::OffscreenView> view;
     NodeThreadPool threadpool;
@@ -82,8 +92,23 @@ public:
 
     std::exception_ptr error;
     mbgl::PremultipliedImage image;
+    std::future<mbgl::PremultipliedImage> pendingImage;
+    std::unique_ptr<mbgl::Metatile> metatile;
     std::unique_ptr<Nan::Callback> callback;
 
+    // Only set while rendering with an image format. Tiles of a metatile are kept for their
+    // coordinates while their images are being encoded.
+    std::unique_ptr<mbgl::ImageEncoder> encoder;
+    std::vector<mbgl::Metatile::Tile> tiles;
+    std::vector<std::string> encoded;
+    std::vector<std::exception_ptr> encodeErrors;
+    std::atomic<std::size_t> pendingEncodes { 0 };
+
+    // Incremented by every render call. A render only finishes when the latest notification
+    // carries its generation.
+    uint64_t renderGeneration = 0;
+    std::atomic<uint64_t> finishedGeneration { 0 };
+
     // Async for delivering the notifications of render completion.
     uv_async_t *async;
 
@@ -3,6 +3,9 @@
 
 #include <mbgl/actor/mailbox.hpp>
 
+#include <algorithm>
+#include <cstdlib>
+
 namespace node_mbgl {
 
 NodeThreadPool::NodeThreadPool()
@@ -18,6 +21,15 @@ NodeThreadPool::~NodeThreadPool() {
     queue->stop();
 }
 
+std::size_t NodeThreadPool::getThreadCount() const {
+    // Workers run on the libuv thread pool, which sizes itself like this when it starts.
+    const char* size = std::getenv("UV_THREADPOOL_SIZE");
+    if (!size) {
+        return 4;
+    }
+    return std::min<std::size_t>(std::max(std::atoi(size), 1), 128);
+}
+
 void NodeThreadPool::schedule(std::weak_ptr<mbgl::Mailbox> mailbox) {
     queue->send(std::move(mailbox));
 }
@@ -54,6 +54,37 @@ test('Cancel', function(t) {
         map.render({ zoom: 16 }, renderCallback);
     });
 
+    t.test('render after canceling an encoded render', function(t) {
+        var map = new mbgl.Map(Object.assign({ mode: 'tile' }, options));
+        var firstCallbacks = 0;
+
+        map.load(mockfs.style_vector);
+
+        map.render({ tile: [2, 3, 1], metatile: 2, format: 'png' }, function() {
+            firstCallbacks++;
+        });
+
+        // Cancel while the tiles may still be encoding; the render may have finished already.
+        setImmediate(function() {
+            try {
+                map.cancel();
+            } catch (err) {
+                t.equal(err.message, 'No render in progress');
+            }
+
+            map.render({ tile: [2, 3, 1], metatile: 2, format: 'png' }, function(err, tiles) {
+                t.error(err);
+                t.equal(firstCallbacks, 1);
+                t.equal(tiles.length, 4);
+                tiles.forEach(function(tile) {
+                    t.equal(tile.data.toString('binary', 1, 4), 'PNG');
+                });
+                map.release();
+                t.end();
+            });
+        });
+    });
+
     t.test('cancel after cancel', function(t) {
         var cancelCount  = 0;
         var map = new mbgl.Map(options);
@@ -89,6 +89,25 @@ test('Map', function(t) {
         t.end();
     });
 
+    t.test('optional mode property must be still or tile', function(t) {
+        var options = {
+            request: function() {}
+        };
+
+        options.mode = 'continuous';
+        t.throws(function() {
+            new mbgl.Map(options);
+        }, /Options object 'mode' property must be 'still' or 'tile'/);
+
+        options.mode = 'tile';
+        t.doesNotThrow(function() {
+            var map = new mbgl.Map(options);
+            map.release();
+        });
+
+        t.end();
+    });
+
     t.test('instanceof mbgl.Map', function(t) {
         var options = {
             request: function() {},
@@ -494,6 +513,74 @@ test('Map', function(t) {
             });
         });
 
+        t.test('requires tile mode to render tiles', function(t) {
+            var map = new mbgl.Map(options);
+            map.load(style);
+
+            t.throws(function() {
+                map.render({ tile: [2, 1, 1] }, function() {});
+            }, /Map is not in tile mode/);
+
+            map.release();
+            t.end();
+        });
+
+        t.test('returns the tiles of a metatile', function(t) {
+            var map = new mbgl.Map(Object.assign({ mode: 'tile' }, options));
+            map.load(style);
+            map.render({ tile: [2, 3, 1], metatile: 2, buffer: 32 }, function(err, tiles) {
+                t.error(err);
+                map.release();
+                t.equal(tiles.length, 4);
+                t.deepEqual(tiles.map(function(tile) { return [tile.z, tile.x, tile.y]; }),
+                            [[2, 2, 0], [2, 3, 0], [2, 2, 1], [2, 3, 1]]);
+                tiles.forEach(function(tile) {
+                    t.ok(tile.pixels instanceof Buffer);
+                    t.equal(tile.pixels.length, 256 * 256 * 4);
+                });
+                t.end();
+            });
+        });
+
+        t.test('returns an encoded image', function(t) {
+            var map = new mbgl.Map(options);
+            map.load(style);
+            map.render({ format: 'png' }, function(err, data) {
+                t.error(err);
+                map.release();
+                t.ok(data instanceof Buffer);
+                t.equal(data.toString('binary', 1, 4), 'PNG');
+                t.end();
+            });
+        });
+
+        t.test('rejects unknown image formats', function(t) {
+            var map = new mbgl.Map(options);
+            map.load(style);
+
+            t.throws(function() {
+                map.render({ format: 'gif' }, function() {});
+            }, /format must be one of 'png', 'png8' or 'webp'/);
+
+            map.release();
+            t.end();
+        });
+
+        t.test('returns the encoded tiles of a metatile', function(t) {
+            var map = new mbgl.Map(Object.assign({ mode: 'tile' }, options));
+            map.load(style);
+            map.render({ tile: [2, 3, 1], metatile: 2, format: 'png8' }, function(err, tiles) {
+                t.error(err);
+                map.release();
+                t.equal(tiles.length, 4);
+                tiles.forEach(function(tile) {
+                    t.ok(tile.data instanceof Buffer);
+                    t.equal(tile.data.toString('binary', 1, 4), 'PNG');
+                });
+                t.end();
+            });
+        });
+
         t.test('can be called several times in serial', function(t) {
             var completed = 0;
             var remaining = 10;
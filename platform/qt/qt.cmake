@@ -21,6 +21,8 @@ set(MBGL_QT_FILES
 
     # Offline
     PRIVATE platform/default/mbgl/storage/offline.cpp
+    PRIVATE platform/default/mbgl/storage/offline_bulk.cpp
+    PRIVATE platform/default/mbgl/storage/offline_bulk.hpp
     PRIVATE platform/default/mbgl/storage/offline_database.cpp
     PRIVATE platform/default/mbgl/storage/offline_database.hpp
     PRIVATE platform/default/mbgl/storage/offline_download.cpp
@@ -35,6 +37,8 @@ set(MBGL_QT_FILES
     PRIVATE platform/default/mbgl/util/shared_thread_pool.hpp
     PRIVATE platform/default/mbgl/util/default_thread_pool.cpp
     PRIVATE platform/default/mbgl/util/default_thread_pool.hpp
+    PRIVATE platform/default/mbgl/util/image_encoder.cpp
+    PRIVATE platform/default/mbgl/util/image_encoder.hpp
 
     # Thread
     PRIVATE platform/qt/src/thread_local.cpp
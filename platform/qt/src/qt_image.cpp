@@ -1,4 +1,5 @@
 #include <mbgl/util/image.hpp>
+#include <mbgl/util/image_buffer_pool.hpp>
 
 #include <QBuffer>
 #include <QByteArray>
@@ -19,12 +20,28 @@ std::string encodePNG(const PremultipliedImage& pre) {
     return std::string(array.constData(), array.size());
 }
 
+std::string encodeWebP(const PremultipliedImage& pre, float quality) {
+    QImage image(pre.data.get(), pre.size.width, pre.size.height,
+        QImage::Format_ARGB32_Premultiplied);
+
+    QByteArray array;
+    QBuffer buffer(&array);
+
+    // Requires the WebP plugin of the Qt Image Formats module.
+    buffer.open(QIODevice::WriteOnly);
+    if (!image.rgbSwapped().save(&buffer, "WEBP", static_cast<int>(quality))) {
+        throw std::runtime_error("failed to encode WebP image");
+    }
+
+    return std::string(array.constData(), array.size());
+}
+
 #if !defined(QT_IMAGE_DECODERS)
-PremultipliedImage decodeJPEG(const uint8_t*, size_t);
-PremultipliedImage decodeWebP(const uint8_t*, size_t);
+PremultipliedImage decodeJPEG(const uint8_t*, size_t, ImageBufferPool*);
+PremultipliedImage decodeWebP(const uint8_t*, size_t, ImageBufferPool*);
 #endif
 
-PremultipliedImage decodeImage(const std::string& string) {
+static PremultipliedImage decodeImage(const std::string& string, ImageBufferPool* pool) {
     const uint8_t* data = reinterpret_cast<const uint8_t*>(string.data());
     const size_t size = string.size();
 
@@ -33,14 +50,14 @@ PremultipliedImage decodeImage(const std::string& string) {
         uint32_t riff_magic = (data[0] << 24) | (data[1] << 16) | (data[2] << 8) | data[3];
         uint32_t webp_magic = (data[8] << 24) | (data[9] << 16) | (data[10] << 8) | data[11];
         if (riff_magic == 0x52494646 && webp_magic == 0x57454250) {
-            return decodeWebP(data, size);
+            return decodeWebP(data, size, pool);
         }
     }
 
     if (size >= 2) {
         uint16_t magic = ((data[0] << 8) | data[1]) & 0xffff;
         if (magic == 0xFFD8) {
-            return decodeJPEG(data, size);
+            return decodeJPEG(data, size, pool);
         }
     }
 #endif
@@ -54,10 +71,18 @@ PremultipliedImage decodeImage(const std::string& string) {
         throw std::runtime_error("Unsupported image type");
     }
 
-    auto img = std::make_unique<uint8_t[]>(image.byteCount());
+    auto img = pool ? pool->acquire(image.byteCount()) : std::make_unique<uint8_t[]>(image.byteCount());
     memcpy(img.get(), image.constBits(), image.byteCount());
 
     return { { static_cast<uint32_t>(image.width()), static_cast<uint32_t>(image.height()) },
              std::move(img) };
 }
+
+PremultipliedImage decodeImage(const std::string& string) {
+    return decodeImage(string, nullptr);
+}
+
+PremultipliedImage decodeImage(const std::string& string, ImageBufferPool& pool) {
+    return decodeImage(string, &pool);
+}
 }
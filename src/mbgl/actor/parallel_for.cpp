@@ -0,0 +1,106 @@
+#include <mbgl/actor/parallel_for.hpp>
+#include <mbgl/actor/actor.hpp>
+#include <mbgl/actor/scheduler.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+namespace mbgl {
+
+namespace {
+
+class ParallelForState {
+public:
+    ParallelForState(std::size_t count_, const std::function<void (std::size_t)>& task_)
+        : count(count_), task(task_) {
+    }
+
+    // Makes calls until there are none left.
+    void run() {
+        std::size_t i;
+        while ((i = next++) < count) {
+            try {
+                task(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+
+            if (++finished == count) {
+                std::lock_guard<std::mutex> lock(mutex);
+                done.notify_all();
+            }
+        }
+    }
+
+    // Waits for calls that are still being made on other threads.
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [&] { return finished == count; });
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    const std::size_t count;
+    const std::function<void (std::size_t)>& task;
+
+    std::atomic<std::size_t> next { 0 };
+    std::atomic<std::size_t> finished { 0 };
+
+    std::mutex mutex;
+    std::condition_variable done;
+    std::exception_ptr error;
+};
+
+class ParallelForHelper {
+public:
+    ParallelForHelper(ActorRef<ParallelForHelper>, ParallelForState& state_)
+        : state(state_) {
+    }
+
+    void run() {
+        state.run();
+    }
+
+private:
+    ParallelForState& state;
+};
+
+} // namespace
+
+void parallelFor(Scheduler& scheduler, std::size_t count, const std::function<void (std::size_t)>& task) {
+    if (count == 0) {
+        return;
+    }
+
+    ParallelForState state(count, task);
+
+    // The calling thread does its share, so at most count - 1 helpers are useful, and there's no
+    // point in scheduling more helpers than the scheduler has threads to run them.
+    const std::size_t helperCount = std::min(count - 1, scheduler.getThreadCount());
+
+    std::vector<std::unique_ptr<Actor<ParallelForHelper>>> helpers;
+    helpers.reserve(helperCount);
+    for (std::size_t i = 0; i < helperCount; i++) {
+        helpers.push_back(std::make_unique<Actor<ParallelForHelper>>(scheduler, state));
+        helpers.back()->invoke(&ParallelForHelper::run);
+    }
+
+    state.run();
+
+    // Closing the helpers' mailboxes waits for helpers that are still running, and keeps the
+    // ones that haven't started yet from ever touching `state`.
+    helpers.clear();
+
+    state.wait();
+}
+
+} // namespace mbgl
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace mbgl {
+
+class Scheduler;
+
+/*
+    Calls `task` once for every index in [0, count), spreading the calls over the calling thread
+    and helpers scheduled on `scheduler`, at most one per thread of the scheduler, and returns
+    once all calls have completed.
+
+    The calling thread doesn't block while there are calls left to make; it keeps making them
+    itself. Helpers that are only scheduled after all calls have been made do nothing. This makes
+    it safe to use from within a message processed by the same scheduler, even if all of its
+    threads are busy.
+
+    Calls may happen in any order and concurrently, so `task` must only write to state owned by
+    its index. If any call throws, the first exception is rethrown after all calls completed.
+*/
+void parallelFor(Scheduler&, std::size_t count, const std::function<void (std::size_t)>& task);
+
+} // namespace mbgl
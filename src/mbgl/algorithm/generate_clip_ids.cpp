@@ -14,7 +14,7 @@
 namespace mbgl {
 namespace algorithm {
 
-ClipIDGenerator::Leaf::Leaf(ClipID& clip_) : clip(clip_) {
+ClipIDGenerator::Leaf::Leaf(std::size_t update_) : update(update_) {
 }
 
 void ClipIDGenerator::Leaf::add(const CanonicalTileID& p) {
@@ -31,14 +31,58 @@ bool ClipIDGenerator::Leaf::operator==(const Leaf& other) const {
     return children == other.children;
 }
 
-std::map<UnwrappedTileID, ClipID> ClipIDGenerator::getClipIDs() const {
-    std::map<UnwrappedTileID, ClipID> clipIDs;
+void ClipIDGenerator::reset() {
+    if (reusing && updates.size() != previousUpdates.size()) {
+        stopReusing();
+    }
+    if (!reusing) {
+        previousPool = std::move(pool);
+    }
+    previousUpdates = std::move(updates);
+
+    bit_offset = 0;
+    pool.clear();
+    updates.clear();
+    reusing = true;
+}
+
+void ClipIDGenerator::stopReusing() {
+    if (!reusing) {
+        return;
+    }
+
+    // Add the leaves of the updates that were reused so far.
+    for (const auto& pair : previousPool) {
+        if (pair.second.update < updates.size()) {
+            pool.emplace(pair.first, pair.second);
+        }
+    }
+    reusing = false;
+    clipIDs = {};
+}
+
+bool ClipIDGenerator::hasOverlaps() const {
+    return std::any_of(updates.begin(), updates.end(),
+                       [](const auto& update) { return update.overlapping; });
+}
+
+const std::map<UnwrappedTileID, ClipID>& ClipIDGenerator::getClipIDs() {
+    if (reusing && updates.size() != previousUpdates.size()) {
+        stopReusing();
+    }
+    if (clipIDs) {
+        return *clipIDs;
+    }
+    stopReusing();
+
+    clipIDs.emplace();
+    auto& result = *clipIDs;
 
     // Merge everything.
     for (auto& pair : pool) {
         auto& id = pair.first;
         auto& leaf = pair.second;
-        auto res = clipIDs.emplace(id, leaf.clip);
+        auto res = result.emplace(id, leaf.clip);
         if (!res.second) {
             // Merge with the existing ClipID when there was already an element with the
             // same tile ID.
@@ -46,14 +90,14 @@ std::map<UnwrappedTileID, ClipID> ClipIDGenerator::getClipIDs() const {
         }
     }
 
-    for (auto it = clipIDs.begin(); it != clipIDs.end(); ++it) {
+    for (auto it = result.begin(); it != result.end(); ++it) {
         auto& childId = it->first;
         auto& childClip = it->second;
 
         // Loop through all preceding stencils, and find all parents.
 
         for (auto parentIt = std::reverse_iterator<decltype(it)>(it);
-             parentIt != clipIDs.rend(); ++parentIt) {
+             parentIt != result.rend(); ++parentIt) {
             auto& parentId = parentIt->first;
             if (childId.isChildOf(parentId)) {
                 // Once we have a parent, we add the bits  that this ID hasn't set yet.
@@ -66,11 +110,11 @@ std::map<UnwrappedTileID, ClipID> ClipIDGenerator::getClipIDs() const {
     }
 
     // Remove tiles that are entirely covered by children.
-    util::erase_if(clipIDs, [&](const auto& stencil) {
-        return algorithm::coveredByChildren(stencil.first, clipIDs);
+    util::erase_if(result, [&](const auto& stencil) {
+        return algorithm::coveredByChildren(stencil.first, result);
     });
 
-    return clipIDs;
+    return result;
 }
 
 } // namespace algorithm
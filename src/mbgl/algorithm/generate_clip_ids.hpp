@@ -2,6 +2,7 @@
 
 #include <mbgl/tile/tile_id.hpp>
 #include <mbgl/util/clip_id.hpp>
+#include <mbgl/util/optional.hpp>
 
 #include <set>
 #include <vector>
@@ -13,22 +14,51 @@ namespace algorithm {
 class ClipIDGenerator {
 private:
     struct Leaf {
-        Leaf(ClipID&);
+        Leaf(std::size_t update);
         void add(const CanonicalTileID &p);
         bool operator==(const Leaf &other) const;
 
         std::set<CanonicalTileID> children;
-        ClipID& clip;
+        ClipID clip;
+
+        // The index of the update within the frame that added this leaf.
+        std::size_t update;
+    };
+
+    // The renderables passed to an update, in sorted order, and the clip IDs they got.
+    struct Update {
+        std::vector<UnwrappedTileID> ids;
+        std::vector<bool> used;
+        std::vector<ClipID> clips;
+        uint8_t bit_offset;
+        bool overlapping;
     };
 
     uint8_t bit_offset = 0;
     std::multimap<UnwrappedTileID, Leaf> pool;
+    std::vector<Update> updates;
+
+    // The updates of the previous frame. As long as every update of this frame gets the same
+    // renderables as the previous frame did, their clip IDs are reused and the pool stays empty.
+    std::vector<Update> previousUpdates;
+    std::multimap<UnwrappedTileID, Leaf> previousPool;
+    bool reusing = true;
+
+    optional<std::map<UnwrappedTileID, ClipID>> clipIDs;
+
+    void stopReusing();
 
 public:
+    // Starts a new frame. Clip IDs of the previous frame are reused for unchanged renderables.
+    void reset();
+
     template <typename Renderable>
     void update(std::vector<std::reference_wrapper<Renderable>> renderables);
 
-    std::map<UnwrappedTileID, ClipID> getClipIDs() const;
+    const std::map<UnwrappedTileID, ClipID>& getClipIDs();
+
+    // Whether the renderables of any update overlap each other.
+    bool hasOverlaps() const;
 };
 
 } // namespace algorithm
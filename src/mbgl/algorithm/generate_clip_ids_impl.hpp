@@ -14,15 +14,51 @@ void ClipIDGenerator::update(std::vector<std::reference_wrapper<Renderable>> ren
     std::sort(renderables.begin(), renderables.end(),
               [](const auto& a, const auto& b) { return a.get().id < b.get().id; });
 
+    // Reuse the clip IDs of the previous frame when it had the same renderables at this point.
+    const std::size_t index = updates.size();
+    const auto unchanged = [&] (const Update& previous) {
+        if (previous.ids.size() != renderables.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < renderables.size(); i++) {
+            const auto& renderable = renderables[i].get();
+            if (!(renderable.id == previous.ids[i]) || renderable.used != previous.used[i]) {
+                return false;
+            }
+        }
+        return true;
+    };
+    if (reusing && index < previousUpdates.size() && unchanged(previousUpdates[index])) {
+        Update& previous = previousUpdates[index];
+        auto clip = previous.clips.begin();
+        for (auto& it : renderables) {
+            auto& renderable = it.get();
+            if (renderable.used) {
+                renderable.clip = *clip++;
+            }
+        }
+        bit_offset = previous.bit_offset;
+        updates.push_back(std::move(previous));
+        return;
+    }
+
+    stopReusing();
+    clipIDs = {};
+
+    Update current;
+    current.overlapping = false;
+    std::vector<typename decltype(pool)::iterator> leaves;
+
     const auto end = renderables.end();
     for (auto it = renderables.begin(); it != end; it++) {
         auto& renderable = it->get();
+        current.ids.push_back(renderable.id);
+        current.used.push_back(renderable.used);
         if (!renderable.used) {
             continue;
         }
 
-        renderable.clip = {};
-        Leaf leaf{ renderable.clip };
+        Leaf leaf{ index };
 
         // Try to add all remaining ids as children. We sorted the tile list
         // by z earlier, so all preceding items cannot be children of the current
@@ -38,6 +74,9 @@ void ClipIDGenerator::update(std::vector<std::reference_wrapper<Renderable>> ren
                 leaf.add(childTileID.canonical);
             }
         }
+        if (!leaf.children.empty()) {
+            current.overlapping = true;
+        }
 
         // Find a leaf with matching children.
         for (auto its = pool.equal_range(renderable.id); its.first != its.second; ++its.first) {
@@ -52,7 +91,8 @@ void ClipIDGenerator::update(std::vector<std::reference_wrapper<Renderable>> ren
             size++;
         }
 
-        pool.emplace(renderable.id, std::move(leaf));
+        renderable.clip = leaf.clip;
+        leaves.push_back(pool.emplace(renderable.id, std::move(leaf)));
     }
 
     if (size > 0) {
@@ -62,6 +102,7 @@ void ClipIDGenerator::update(std::vector<std::reference_wrapper<Renderable>> ren
         // We are starting our count with 1 since we need at least 1 bit set to distinguish between
         // areas without any tiles whatsoever and the current area.
         uint8_t count = 1;
+        auto leaf = leaves.begin();
         for (auto& it : renderables) {
             auto& renderable = it.get();
             if (!renderable.used) {
@@ -73,11 +114,20 @@ void ClipIDGenerator::update(std::vector<std::reference_wrapper<Renderable>> ren
             if (renderable.clip.reference.none()) {
                 renderable.clip.reference = uint32_t(count++) << bit_offset;
             }
+            (*leaf++)->second.clip = renderable.clip;
         }
 
         bit_offset += bit_count;
     }
 
+    for (auto& it : renderables) {
+        if (it.get().used) {
+            current.clips.push_back(it.get().clip);
+        }
+    }
+    current.bit_offset = bit_offset;
+    updates.push_back(std::move(current));
+
     // Prevent this warning from firing on every frame,
     // which can be expensive in some platforms.
     static bool warned = false;
@@ -9,6 +9,9 @@
 namespace mbgl {
 namespace algorithm {
 
+// Parent tiles in `checked` have already been visited while looking for a replacement of another
+// ideal tile, and are not visited again. Sharing the set between calls for ideal tiles of different
+// zoom levels makes sure that a parent they have in common is rendered only once.
 template <typename GetTileFn,
           typename CreateTileFn,
           typename RetainTileFn,
@@ -20,8 +23,8 @@ void updateRenderables(GetTileFn getTile,
                        RenderTileFn renderTile,
                        const IdealTileIDs& idealTileIDs,
                        const Range<uint8_t>& zoomRange,
-                       const uint8_t dataTileZoom) {
-    std::unordered_set<UnwrappedTileID> checked;
+                       const uint8_t dataTileZoom,
+                       std::unordered_set<UnwrappedTileID>& checked) {
     bool covered;
     int32_t overscaledZ;
 
@@ -117,5 +120,22 @@ void updateRenderables(GetTileFn getTile,
     }
 }
 
+template <typename GetTileFn,
+          typename CreateTileFn,
+          typename RetainTileFn,
+          typename RenderTileFn,
+          typename IdealTileIDs>
+void updateRenderables(GetTileFn getTile,
+                       CreateTileFn createTile,
+                       RetainTileFn retainTile,
+                       RenderTileFn renderTile,
+                       const IdealTileIDs& idealTileIDs,
+                       const Range<uint8_t>& zoomRange,
+                       const uint8_t dataTileZoom) {
+    std::unordered_set<UnwrappedTileID> checked;
+    updateRenderables(getTile, createTile, retainTile, renderTile, idealTileIDs, zoomRange,
+                      dataTileZoom, checked);
+}
+
 } // namespace algorithm
 } // namespace mbgl
@@ -12,6 +12,9 @@
 
 #include <boost/function_output_iterator.hpp>
 
+#include <algorithm>
+#include <array>
+
 namespace mbgl {
 
 using namespace style;
@@ -19,6 +22,31 @@ using namespace style;
 const std::string AnnotationManager::SourceID = "com.mapbox.annotations";
 const std::string AnnotationManager::PointLayerID = "com.mapbox.annotations.points";
 
+namespace {
+
+// Beyond this many changes, tracking each of them costs more than refreshing a few extra tiles.
+const std::size_t maxDirtyBounds = 256;
+
+// Returns the bounds of the tile in the world copy to the west, its own and the one to the east,
+// since geojson-vt wraps shapes that cross the antimeridian into tiles on the other side.
+std::array<ShapeAnnotationBox, 3> wrappedTileBounds(const CanonicalTileID& tileID) {
+    const ShapeAnnotationBox bounds = ShapeAnnotationImpl::tileBounds(tileID);
+    std::array<ShapeAnnotationBox, 3> result {{ bounds, bounds, bounds }};
+    for (int i = 0; i < 3; i++) {
+        const double shift = i - 1;
+        boost::geometry::set<boost::geometry::min_corner, 0>(result[i], bounds.min_corner().get<0>() + shift);
+        boost::geometry::set<boost::geometry::max_corner, 0>(result[i], bounds.max_corner().get<0>() + shift);
+    }
+    return result;
+}
+
+ShapeAnnotationBox symbolBounds(const SymbolAnnotation& annotation) {
+    const ShapeAnnotationPoint point = ShapeAnnotationImpl::project(annotation.geometry);
+    return { point, point };
+}
+
+} // namespace
+
 AnnotationManager::AnnotationManager(Style& style_)
         : style(style_) {
 };
@@ -54,21 +82,58 @@ void AnnotationManager::removeAnnotation(const AnnotationID& id) {
     remove(id);
 }
 
+AnnotationIDs AnnotationManager::addAnnotations(const std::vector<Annotation>& annotations, const uint8_t maxZoom) {
+    std::lock_guard<std::mutex> lock(mutex);
+    AnnotationIDs ids;
+    ids.reserve(annotations.size());
+    for (const auto& annotation : annotations) {
+        AnnotationID id = nextID++;
+        Annotation::visit(annotation, [&] (const auto& annotation_) {
+            this->add(id, annotation_, maxZoom);
+        });
+        ids.push_back(id);
+    }
+    return ids;
+}
+
+Update AnnotationManager::updateAnnotations(const std::vector<std::pair<AnnotationID, Annotation>>& annotations, const uint8_t maxZoom) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Update result = Update::Nothing;
+    for (const auto& annotation : annotations) {
+        result |= Annotation::visit(annotation.second, [&] (const auto& annotation_) {
+            return this->update(annotation.first, annotation_, maxZoom);
+        });
+    }
+    return result;
+}
+
+void AnnotationManager::removeAnnotations(const AnnotationIDs& ids) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& id : ids) {
+        remove(id);
+    }
+}
+
 void AnnotationManager::add(const AnnotationID& id, const SymbolAnnotation& annotation, const uint8_t) {
     auto impl = std::make_shared<SymbolAnnotationImpl>(id, annotation);
     symbolTree.insert(impl);
     symbolAnnotations.emplace(id, impl);
+    invalidate(symbolBounds(annotation));
 }
 
 void AnnotationManager::add(const AnnotationID& id, const LineAnnotation& annotation, const uint8_t maxZoom) {
     ShapeAnnotationImpl& impl = *shapeAnnotations.emplace(id,
         std::make_unique<LineAnnotationImpl>(id, annotation, maxZoom)).first->second;
+    shapeTree.insert({ impl.bounds, &impl });
+    invalidate(impl.bounds);
     impl.updateStyle(*style.get().impl);
 }
 
 void AnnotationManager::add(const AnnotationID& id, const FillAnnotation& annotation, const uint8_t maxZoom) {
     ShapeAnnotationImpl& impl = *shapeAnnotations.emplace(id,
         std::make_unique<FillAnnotationImpl>(id, annotation, maxZoom)).first->second;
+    shapeTree.insert({ impl.bounds, &impl });
+    invalidate(impl.bounds);
     impl.updateStyle(*style.get().impl);
 }
 
@@ -100,6 +165,8 @@ Update AnnotationManager::update(const AnnotationID& id, const LineAnnotation& a
         return Update::Nothing;
     }
 
+    invalidate(it->second->bounds);
+    shapeTree.remove(std::make_pair(it->second->bounds, it->second.get()));
     shapeAnnotations.erase(it);
     add(id, annotation, maxZoom);
     return Update::AnnotationData;
@@ -112,6 +179,8 @@ Update AnnotationManager::update(const AnnotationID& id, const FillAnnotation& a
         return Update::Nothing;
     }
 
+    invalidate(it->second->bounds);
+    shapeTree.remove(std::make_pair(it->second->bounds, it->second.get()));
     shapeAnnotations.erase(it);
     add(id, annotation, maxZoom);
     return Update::AnnotationData;
@@ -119,11 +188,14 @@ Update AnnotationManager::update(const AnnotationID& id, const FillAnnotation& a
 
 void AnnotationManager::remove(const AnnotationID& id) {
     if (symbolAnnotations.find(id) != symbolAnnotations.end()) {
+        invalidate(symbolBounds(symbolAnnotations.at(id)->annotation));
         symbolTree.remove(symbolAnnotations.at(id));
         symbolAnnotations.erase(id);
     } else if (shapeAnnotations.find(id) != shapeAnnotations.end()) {
         auto it = shapeAnnotations.find(id);
         *style.get().impl->removeLayer(it->second->layerID);
+        invalidate(it->second->bounds);
+        shapeTree.remove(std::make_pair(it->second->bounds, it->second.get()));
         shapeAnnotations.erase(it);
     } else {
         assert(false); // Should never happen
@@ -145,8 +217,20 @@ std::unique_ptr<AnnotationTileData> AnnotationManager::getTileData(const Canonic
             val->updateLayer(tileID, *pointLayer);
         }));
 
-    for (const auto& shape : shapeAnnotations) {
-        shape.second->updateTileData(tileID, *tileData);
+    // Shapes are added in the order of their IDs, as they were before being indexed.
+    std::vector<ShapeAnnotationImpl*> shapes;
+    for (const auto& box : wrappedTileBounds(tileID)) {
+        shapeTree.query(boost::geometry::index::intersects(box),
+            boost::make_function_output_iterator([&](const auto& val) {
+                shapes.push_back(val.second);
+            }));
+    }
+
+    std::sort(shapes.begin(), shapes.end(), [](const auto* a, const auto* b) { return a->id < b->id; });
+    shapes.erase(std::unique(shapes.begin(), shapes.end()), shapes.end());
+
+    for (auto* shape : shapes) {
+        shape->updateTileData(tileID, *tileData);
     }
 
     return tileData;
@@ -185,11 +269,33 @@ void AnnotationManager::updateStyle() {
     }
 }
 
+void AnnotationManager::invalidate(const ShapeAnnotationBox& bounds) {
+    if (dirtyBounds.size() < maxDirtyBounds) {
+        dirtyBounds.push_back(bounds);
+    } else {
+        boost::geometry::expand(dirtyBounds.back(), bounds);
+    }
+}
+
+bool AnnotationManager::isDirty(const CanonicalTileID& tileID) const {
+    for (const auto& box : wrappedTileBounds(tileID)) {
+        for (const auto& dirty : dirtyBounds) {
+            if (boost::geometry::intersects(box, dirty)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 void AnnotationManager::updateData() {
     std::lock_guard<std::mutex> lock(mutex);
     for (auto& tile : tiles) {
-        tile->setData(getTileData(tile->id.canonical));
+        if (isDirty(tile->id.canonical)) {
+            tile->setData(getTileData(tile->id.canonical));
+        }
     }
+    dirtyBounds.clear();
 }
 
 void AnnotationManager::addTile(AnnotationTile& tile) {
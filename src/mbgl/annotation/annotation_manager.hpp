@@ -2,6 +2,7 @@
 
 #include <mbgl/annotation/annotation.hpp>
 #include <mbgl/annotation/symbol_annotation_impl.hpp>
+#include <mbgl/annotation/shape_annotation_impl.hpp>
 #include <mbgl/style/image.hpp>
 #include <mbgl/map/update.hpp>
 #include <mbgl/util/noncopyable.hpp>
@@ -33,6 +34,11 @@ public:
     Update updateAnnotation(const AnnotationID&, const Annotation&, const uint8_t maxZoom);
     void removeAnnotation(const AnnotationID&);
 
+    // Batched variants, which take the lock once for all annotations.
+    AnnotationIDs addAnnotations(const std::vector<Annotation>&, const uint8_t maxZoom);
+    Update updateAnnotations(const std::vector<std::pair<AnnotationID, Annotation>>&, const uint8_t maxZoom);
+    void removeAnnotations(const AnnotationIDs&);
+
     void addImage(std::unique_ptr<style::Image>);
     void removeImage(const std::string&);
     double getTopOffsetPixelsForImage(const std::string&);
@@ -40,6 +46,7 @@ public:
     void setStyle(style::Style&);
     void onStyleLoaded();
 
+    // Refreshes the data of the tiles that intersect annotations changed since the last call.
     void updateData();
 
     void addTile(AnnotationTile&);
@@ -59,6 +66,9 @@ private:
 
     void remove(const AnnotationID&);
 
+    void invalidate(const ShapeAnnotationBox&);
+    bool isDirty(const CanonicalTileID&) const;
+
     void updateStyle();
 
     std::unique_ptr<AnnotationTileData> getTileData(const CanonicalTileID&);
@@ -74,15 +84,22 @@ private:
     // <https://github.com/mapbox/mapbox-gl-native/issues/5691>
     using SymbolAnnotationMap = std::map<AnnotationID, std::shared_ptr<SymbolAnnotationImpl>>;
     using ShapeAnnotationMap = std::map<AnnotationID, std::unique_ptr<ShapeAnnotationImpl>>;
+    // Indexes shape annotations by their projected bounds, so that building a tile only visits
+    // the shapes that intersect it.
+    using ShapeAnnotationTree = boost::geometry::index::rtree<std::pair<ShapeAnnotationBox, ShapeAnnotationImpl*>, boost::geometry::index::rstar<16, 4>>;
     using ImageMap = std::unordered_map<std::string, style::Image>;
 
     SymbolAnnotationTree symbolTree;
     SymbolAnnotationMap symbolAnnotations;
     ShapeAnnotationMap shapeAnnotations;
+    ShapeAnnotationTree shapeTree;
     ImageMap images;
 
     std::unordered_set<AnnotationTile*> tiles;
 
+    // Projected bounds of the annotations added, updated or removed since the last updateData().
+    std::vector<ShapeAnnotationBox> dirtyBounds;
+
     friend class AnnotationTile;
 };
 
@@ -7,15 +7,55 @@
 #include <mbgl/util/constants.hpp>
 #include <mbgl/util/geometry.hpp>
 
+#include <mapbox/geometry/envelope.hpp>
+
+#include <cmath>
+
 namespace mbgl {
 
 using namespace style;
 namespace geojsonvt = mapbox::geojsonvt;
 
-ShapeAnnotationImpl::ShapeAnnotationImpl(const AnnotationID id_, const uint8_t maxZoom_)
+namespace {
+
+const uint16_t tileBuffer = 255;
+
+ShapeAnnotationBox projectedBounds(const ShapeAnnotationGeometry& geometry) {
+    const mapbox::geometry::box<double> box = mapbox::geometry::envelope(geometry);
+    if (box.min.x > box.max.x) {
+        // Without any points, the shape is empty in every tile it is queried for.
+        return { { 0, 0 }, { 0, 0 } };
+    }
+    // Northern latitudes have smaller projected y coordinates.
+    const ShapeAnnotationPoint northwest = ShapeAnnotationImpl::project({ box.min.x, box.max.y });
+    const ShapeAnnotationPoint southeast = ShapeAnnotationImpl::project({ box.max.x, box.min.y });
+    return { northwest, southeast };
+}
+
+} // namespace
+
+ShapeAnnotationImpl::ShapeAnnotationImpl(const AnnotationID id_, const uint8_t maxZoom_,
+                                         const ShapeAnnotationGeometry& geometry_)
     : id(id_),
       maxZoom(maxZoom_),
-      layerID("com.mapbox.annotations.shape." + util::toString(id)) {
+      layerID("com.mapbox.annotations.shape." + util::toString(id)),
+      bounds(projectedBounds(geometry_)) {
+}
+
+// Projects like geojson-vt does, so that the bounds match the tiled geometry.
+ShapeAnnotationPoint ShapeAnnotationImpl::project(const Point<double>& point) {
+    const double sine = std::sin(point.y * util::DEG2RAD);
+    const double y = 0.5 - 0.25 * std::log((1 + sine) / (1 - sine)) / M_PI;
+    return { point.x / 360 + 0.5, util::clamp(y, 0.0, 1.0) };
+}
+
+ShapeAnnotationBox ShapeAnnotationImpl::tileBounds(const CanonicalTileID& tileID) {
+    const double size = 1.0 / (1u << tileID.z);
+    const double buffer = size * tileBuffer / util::EXTENT;
+    return {
+        { tileID.x * size - buffer, tileID.y * size - buffer },
+        { (tileID.x + 1) * size + buffer, (tileID.y + 1) * size + buffer }
+    };
 }
 
 void ShapeAnnotationImpl::updateTileData(const CanonicalTileID& tileID, AnnotationTileData& data) {
@@ -28,7 +68,7 @@ void ShapeAnnotationImpl::updateTileData(const CanonicalTileID& tileID, Annotati
         }));
         mapbox::geojsonvt::Options options;
         options.maxZoom = maxZoom;
-        options.buffer = 255u;
+        options.buffer = tileBuffer;
         options.extent = util::EXTENT;
         options.tolerance = baseTolerance;
         shapeTiler = std::make_unique<mapbox::geojsonvt::GeoJSONVT>(features, options);
@@ -9,14 +9,40 @@
 #include <string>
 #include <memory>
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wshadow"
+#ifdef __clang__
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wpragmas"
+#pragma GCC diagnostic ignored "-Wdeprecated-register"
+#pragma GCC diagnostic ignored "-Wshorten-64-to-32"
+#pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+#ifndef __clang__
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wmisleading-indentation"
+#endif
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#pragma GCC diagnostic pop
+
 namespace mbgl {
 
 class AnnotationTileData;
 class CanonicalTileID;
 
+// Projected coordinates, in which the world spans from 0 to 1 like a tile at zoom level 0.
+using ShapeAnnotationPoint = boost::geometry::model::point<double, 2, boost::geometry::cs::cartesian>;
+using ShapeAnnotationBox = boost::geometry::model::box<ShapeAnnotationPoint>;
+
 class ShapeAnnotationImpl {
 public:
-    ShapeAnnotationImpl(const AnnotationID, const uint8_t maxZoom);
+    ShapeAnnotationImpl(const AnnotationID, const uint8_t maxZoom, const ShapeAnnotationGeometry&);
     virtual ~ShapeAnnotationImpl() = default;
 
     virtual void updateStyle(style::Style::Impl&) const = 0;
@@ -27,7 +53,16 @@ public:
     const AnnotationID id;
     const uint8_t maxZoom;
     const std::string layerID;
+    const ShapeAnnotationBox bounds;
     std::unique_ptr<mapbox::geojsonvt::GeoJSONVT> shapeTiler;
+
+    // Returns the projected area whose shapes may contribute to the given tile, which includes
+    // the tile buffer. Shapes near the antimeridian may also be wrapped into the tile from the
+    // world copies to either side.
+    static ShapeAnnotationBox tileBounds(const CanonicalTileID&);
+
+    // Projects a longitude and latitude into the coordinates of the bounds.
+    static ShapeAnnotationPoint project(const Point<double>&);
 };
 
 struct CloseShapeAnnotation {
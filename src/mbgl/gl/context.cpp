@@ -7,6 +7,7 @@
 #include <mbgl/util/traits.hpp>
 #include <mbgl/util/std.hpp>
 #include <mbgl/util/logging.hpp>
+#include <mbgl/util/premultiply.hpp>
 
 #include <cstring>
 
@@ -59,8 +60,17 @@ static_assert(std::is_same<RenderbufferID, GLuint>::value, "OpenGL type mismatch
 
 static_assert(std::is_same<std::underlying_type_t<TextureFormat>, GLenum>::value, "OpenGL type mismatch");
 static_assert(underlying_type(TextureFormat::RGBA) == GL_RGBA, "OpenGL type mismatch");
+static_assert(underlying_type(TextureFormat::RGB) == GL_RGB, "OpenGL type mismatch");
 static_assert(underlying_type(TextureFormat::Alpha) == GL_ALPHA, "OpenGL type mismatch");
 
+static_assert(underlying_type(TextureType::UnsignedByte) == GL_UNSIGNED_BYTE, "OpenGL type mismatch");
+static_assert(underlying_type(TextureType::UnsignedShort565) == GL_UNSIGNED_SHORT_5_6_5, "OpenGL type mismatch");
+
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+static_assert(underlying_type(CompressedTextureFormat::RGB_S3TC_DXT1) == GL_COMPRESSED_RGB_S3TC_DXT1_EXT, "OpenGL type mismatch");
+
 static_assert(underlying_type(UniformDataType::Float) == GL_FLOAT, "OpenGL type mismatch");
 static_assert(underlying_type(UniformDataType::FloatVec2) == GL_FLOAT_VEC2, "OpenGL type mismatch");
 static_assert(underlying_type(UniformDataType::FloatVec3) == GL_FLOAT_VEC3, "OpenGL type mismatch");
@@ -107,6 +117,10 @@ void Context::initializeExtensions(const std::function<gl::ProcAddress(const cha
             return nullptr;
         };
 
+        supportsS3TC = strstr(extensions, "GL_EXT_texture_compression_s3tc") != nullptr ||
+                       strstr(extensions, "GL_EXT_texture_compression_dxt1") != nullptr ||
+                       strstr(extensions, "GL_ANGLE_texture_compression_dxt1") != nullptr;
+
         debugging = std::make_unique<extension::Debugging>(fn);
         if (!disableVAOExtension) {
             vertexArray = std::make_unique<extension::VertexArray>(fn);
@@ -319,24 +333,50 @@ std::unique_ptr<uint8_t[]> Context::readFramebuffer(const Size size, const Textu
     // When reading data from the framebuffer, make sure that we are storing the values
     // tightly packed into the buffer to avoid buffer overruns.
     pixelStorePack = { 1 };
+#if not MBGL_USE_GLES2
+    pixelPackBuffer = 0;
+#endif // MBGL_USE_GLES2
 
     MBGL_CHECK_ERROR(glReadPixels(0, 0, size.width, size.height, static_cast<GLenum>(format),
                                   GL_UNSIGNED_BYTE, data.get()));
 
     if (flip) {
-        auto tmp = std::make_unique<uint8_t[]>(stride);
-        uint8_t* rgba = data.get();
-        for (int i = 0, j = size.height - 1; i < j; i++, j--) {
-            std::memcpy(tmp.get(), rgba + i * stride, stride);
-            std::memcpy(rgba + i * stride, rgba + j * stride, stride);
-            std::memcpy(rgba + j * stride, tmp.get(), stride);
-        }
+        util::flipRows(data.get(), stride, size.height);
     }
 
     return data;
 }
 
 #if not MBGL_USE_GLES2
+UniqueBuffer Context::createPixelPackBuffer(std::size_t size) {
+    BufferID id = 0;
+    MBGL_CHECK_ERROR(glGenBuffers(1, &id));
+    UniqueBuffer result { std::move(id), { this } };
+    pixelPackBuffer = result;
+    MBGL_CHECK_ERROR(glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ));
+    return result;
+}
+
+void Context::readFramebufferToBuffer(const UniqueBuffer& buffer, const Size size, const TextureFormat format) {
+    pixelStorePack = { 1 };
+    pixelPackBuffer = buffer;
+
+    // With a pixel pack buffer bound, the last argument is an offset into the buffer, and the
+    // call returns without waiting for rendering to finish.
+    MBGL_CHECK_ERROR(glReadPixels(0, 0, size.width, size.height, static_cast<GLenum>(format),
+                                  GL_UNSIGNED_BYTE, nullptr));
+}
+
+const uint8_t* Context::mapPixelPackBuffer(const UniqueBuffer& buffer) {
+    pixelPackBuffer = buffer;
+    return reinterpret_cast<const uint8_t*>(
+        MBGL_CHECK_ERROR(glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY)));
+}
+
+void Context::unmapPixelPackBuffer() {
+    MBGL_CHECK_ERROR(glUnmapBuffer(GL_PIXEL_PACK_BUFFER));
+}
+
 void Context::drawPixels(const Size size, const void* data, TextureFormat format) {
     pixelStoreUnpack = { 1 };
     if (format != TextureFormat::RGBA) {
@@ -453,10 +493,10 @@ Context::createFramebuffer(const Texture& color,
 }
 
 UniqueTexture
-Context::createTexture(const Size size, const void* data, TextureFormat format, TextureUnit unit) {
+Context::createTexture(const Size size, const void* data, TextureFormat format, TextureUnit unit, TextureType type) {
     auto obj = createTexture();
     pixelStoreUnpack = { 1 };
-    updateTexture(obj, size, data, format, unit);
+    updateTexture(obj, size, data, format, unit, type);
     // We are using clamp to edge here since OpenGL ES doesn't allow GL_REPEAT on NPOT textures.
     // We use those when the pixelRatio isn't a power of two, e.g. on iPhone 6 Plus.
     MBGL_CHECK_ERROR(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
@@ -467,12 +507,52 @@ Context::createTexture(const Size size, const void* data, TextureFormat format,
 }
 
 void Context::updateTexture(
-    TextureID id, const Size size, const void* data, TextureFormat format, TextureUnit unit) {
+    TextureID id, const Size size, const void* data, TextureFormat format, TextureUnit unit, TextureType type) {
     activeTexture = unit;
     texture[unit] = id;
     MBGL_CHECK_ERROR(glTexImage2D(GL_TEXTURE_2D, 0, static_cast<GLenum>(format), size.width,
-                                  size.height, 0, static_cast<GLenum>(format), GL_UNSIGNED_BYTE,
+                                  size.height, 0, static_cast<GLenum>(format), static_cast<GLenum>(type),
                                   data));
+
+    std::size_t bytesPerPixel = 4;
+    if (type == TextureType::UnsignedShort565) {
+        bytesPerPixel = 2;
+    } else if (format == TextureFormat::RGB) {
+        bytesPerPixel = 3;
+    } else if (format == TextureFormat::Alpha) {
+        bytesPerPixel = 1;
+    }
+    setTextureMemory(id, std::size_t(size.width) * size.height * bytesPerPixel);
+}
+
+Texture Context::createCompressedTexture(const Size size, const void* data, std::size_t length,
+                                         CompressedTextureFormat format, TextureUnit unit) {
+    assert(supportsCompressedTextureFormat(format));
+    auto obj = createTexture();
+    activeTexture = unit;
+    texture[unit] = obj.get();
+    MBGL_CHECK_ERROR(glCompressedTexImage2D(GL_TEXTURE_2D, 0, static_cast<GLenum>(format), size.width,
+                                            size.height, 0, static_cast<GLsizei>(length), data));
+    setTextureMemory(obj.get(), length);
+    MBGL_CHECK_ERROR(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+    MBGL_CHECK_ERROR(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+    MBGL_CHECK_ERROR(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
+    MBGL_CHECK_ERROR(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+    return { size, std::move(obj) };
+}
+
+bool Context::supportsCompressedTextureFormat(CompressedTextureFormat format) const {
+    switch (format) {
+    case CompressedTextureFormat::RGB_S3TC_DXT1:
+        return supportsS3TC;
+    }
+    return false;
+}
+
+void Context::setTextureMemory(TextureID id, std::size_t bytes) {
+    std::size_t& current = textureSizes[id];
+    textureMemory = textureMemory - current + bytes;
+    current = bytes;
 }
 
 void Context::bindTexture(Texture& obj,
@@ -531,6 +611,7 @@ void Context::setDirtyState() {
     stencilMask.setDirty();
     stencilTest.setDirty();
     stencilOp.setDirty();
+    scissor.setDirty();
     depthRange.setDirty();
     depthMask.setDirty();
     depthTest.setDirty();
@@ -549,6 +630,7 @@ void Context::setDirtyState() {
     pixelStorePack.setDirty();
     pixelStoreUnpack.setDirty();
 #if not MBGL_USE_GLES2
+    pixelPackBuffer.setDirty();
     pointSize.setDirty();
     pixelZoom.setDirty();
     rasterPos.setDirty();
@@ -634,6 +716,17 @@ void Context::setStencilMode(const StencilMode& stencil) {
             stencilFunc = { test.func, stencil.ref, test.mask };
         }, stencil.test);
     }
+
+    // The scissor test is otherwise left to the view, so only turn it off again when a stencil
+    // mode turned it on.
+    if (stencil.scissor) {
+        scissorTest = true;
+        scissor = *stencil.scissor;
+        scissorClipping = true;
+    } else if (scissorClipping) {
+        scissorTest = false;
+        scissorClipping = false;
+    }
 }
 
 void Context::setColorMode(const ColorMode& color) {
@@ -652,13 +745,16 @@ void Context::setColorMode(const ColorMode& color) {
 }
 
 void Context::draw(PrimitiveType primitiveType,
+                   DataType indexType,
                    std::size_t indexOffset,
                    std::size_t indexLength) {
+    assert(indexType == DataType::UnsignedShort || indexType == DataType::UnsignedInteger);
+    const std::size_t indexSize = indexType == DataType::UnsignedInteger ? sizeof(uint32_t) : sizeof(uint16_t);
     MBGL_CHECK_ERROR(glDrawElements(
         static_cast<GLenum>(primitiveType),
         static_cast<GLsizei>(indexLength),
-        GL_UNSIGNED_SHORT,
-        reinterpret_cast<GLvoid*>(sizeof(uint16_t) * indexOffset)));
+        static_cast<GLenum>(indexType),
+        reinterpret_cast<GLvoid*>(indexSize * indexOffset)));
 }
 
 void Context::performCleanup() {
@@ -682,6 +778,11 @@ void Context::performCleanup() {
             } else if (globalVertexArrayState.indexBuffer == id) {
                 globalVertexArrayState.indexBuffer.setDirty();
             }
+#if not MBGL_USE_GLES2
+            if (pixelPackBuffer == id) {
+                pixelPackBuffer.setDirty();
+            }
+#endif // MBGL_USE_GLES2
         }
         MBGL_CHECK_ERROR(glDeleteBuffers(int(abandonedBuffers.size()), abandonedBuffers.data()));
         abandonedBuffers.clear();
@@ -692,6 +793,11 @@ void Context::performCleanup() {
             if (activeTexture == id) {
                 activeTexture.setDirty();
             }
+            auto it = textureSizes.find(id);
+            if (it != textureSizes.end()) {
+                textureMemory -= it->second;
+                textureSizes.erase(it);
+            }
         }
         MBGL_CHECK_ERROR(glDeleteTextures(int(abandonedTextures.size()), abandonedTextures.data()));
         abandonedTextures.clear();
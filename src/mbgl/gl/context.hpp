@@ -20,6 +20,7 @@
 
 #include <functional>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 #include <array>
 #include <string>
@@ -80,7 +81,8 @@ public:
     template <class DrawMode>
     IndexBuffer<DrawMode> createIndexBuffer(IndexVector<DrawMode>&& v) {
         return IndexBuffer<DrawMode> {
-            createIndexBuffer(v.data(), v.byteSize())
+            createIndexBuffer(v.data(), v.byteSize()),
+            v.type()
         };
     }
 
@@ -112,6 +114,13 @@ public:
     }
 
 #if not MBGL_USE_GLES2
+    // Pixel pack buffers receive framebuffer reads on the GPU without stalling the pipeline.
+    // Mapping the buffer waits for pending reads into it to finish.
+    UniqueBuffer createPixelPackBuffer(std::size_t size);
+    void readFramebufferToBuffer(const UniqueBuffer&, Size, TextureFormat = TextureFormat::RGBA);
+    const uint8_t* mapPixelPackBuffer(const UniqueBuffer&);
+    void unmapPixelPackBuffer();
+
     template <typename Image>
     void drawPixels(const Image& image) {
         auto format = image.channels == 4 ? TextureFormat::RGBA : TextureFormat::Alpha;
@@ -140,6 +149,22 @@ public:
         return { size, createTexture(size, nullptr, format, unit) };
     }
 
+    // Creates a texture from tightly packed pixels of the given format and component type.
+    Texture createTexture(const Size size, const void* data, TextureFormat format, TextureType type,
+                          TextureUnit unit = 0) {
+        return { size, createTexture(size, data, format, unit, type) };
+    }
+
+    // Creates a texture from block-compressed data. Callers check for support first.
+    Texture createCompressedTexture(Size, const void* data, std::size_t length,
+                                    CompressedTextureFormat, TextureUnit = 0);
+    bool supportsCompressedTextureFormat(CompressedTextureFormat) const;
+
+    // Approximate size of the storage of all textures that haven't been deleted yet.
+    std::size_t getTextureMemory() const {
+        return textureMemory;
+    }
+
     void bindTexture(Texture&,
                      TextureUnit = 0,
                      TextureFilter = TextureFilter::Nearest,
@@ -162,6 +187,7 @@ public:
     void setColorMode(const ColorMode&);
 
     void draw(PrimitiveType,
+              DataType indexType,
               std::size_t indexOffset,
               std::size_t indexLength);
 
@@ -205,6 +231,7 @@ public:
     State<value::BindFramebuffer> bindFramebuffer;
     State<value::Viewport> viewport;
     State<value::ScissorTest> scissorTest;
+    State<value::Scissor> scissor;
     std::array<State<value::BindTexture>, 2> texture;
     State<value::Program> program;
     State<value::BindVertexBuffer> vertexBuffer;
@@ -216,6 +243,7 @@ public:
     State<value::PixelStoreUnpack> pixelStoreUnpack;
 
 #if not MBGL_USE_GLES2
+    State<value::BindPixelPackBuffer> pixelPackBuffer;
     State<value::PixelZoom> pixelZoom;
     State<value::RasterPos> rasterPos;
     State<value::PixelTransferDepth> pixelTransferDepth;
@@ -248,8 +276,11 @@ private:
     UniqueBuffer createVertexBuffer(const void* data, std::size_t size, const BufferUsage usage);
     void updateVertexBuffer(UniqueBuffer& buffer, const void* data, std::size_t size);
     UniqueBuffer createIndexBuffer(const void* data, std::size_t size);
-    UniqueTexture createTexture(Size size, const void* data, TextureFormat, TextureUnit);
-    void updateTexture(TextureID, Size size, const void* data, TextureFormat, TextureUnit);
+    UniqueTexture createTexture(Size size, const void* data, TextureFormat, TextureUnit,
+                                TextureType = TextureType::UnsignedByte);
+    void updateTexture(TextureID, Size size, const void* data, TextureFormat, TextureUnit,
+                       TextureType = TextureType::UnsignedByte);
+    void setTextureMemory(TextureID, std::size_t bytes);
     UniqueFramebuffer createFramebuffer();
     UniqueRenderbuffer createRenderbuffer(RenderbufferType, Size size);
     std::unique_ptr<uint8_t[]> readFramebuffer(Size, TextureFormat, bool flip);
@@ -277,6 +308,13 @@ private:
     std::vector<FramebufferID> abandonedFramebuffers;
     std::vector<RenderbufferID> abandonedRenderbuffers;
 
+    bool supportsS3TC = false;
+    std::unordered_map<TextureID, std::size_t> textureSizes;
+    std::size_t textureMemory = 0;
+
+    // Whether the scissor test was turned on by a stencil mode.
+    bool scissorClipping = false;
+
 public:
     // For testing
     bool disableVAOExtension = false;
@@ -5,3 +5,19 @@
 #else
     #define MBGL_HAS_BINARY_PROGRAMS 1
 #endif
+
+// 32-bit element indices are core in desktop OpenGL, but require OES_element_index_uint on
+// OpenGL ES 2. Buckets are built on worker threads before a context is available to query for
+// the extension, so OpenGL ES builds conservatively stick to 16-bit indices.
+#if __APPLE__
+    #include "TargetConditionals.h"
+    #if TARGET_OS_IPHONE || TARGET_IPHONE_SIMULATOR
+        #define MBGL_HAS_UINT32_INDICES 0
+    #else
+        #define MBGL_HAS_UINT32_INDICES 1
+    #endif
+#elif __ANDROID__ || MBGL_USE_GLES2 || QT_OPENGL_ES_2
+    #define MBGL_HAS_UINT32_INDICES 0
+#else
+    #define MBGL_HAS_UINT32_INDICES 1
+#endif
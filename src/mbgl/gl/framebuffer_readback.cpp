@@ -0,0 +1,105 @@
+#include <mbgl/gl/framebuffer_readback.hpp>
+#include <mbgl/gl/context.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+namespace mbgl {
+namespace gl {
+
+FramebufferReadback::FramebufferReadback(Context& context_, const Size size_)
+    : size(size_), context(context_) {
+}
+
+FramebufferReadback::~FramebufferReadback() {
+    for (auto& slot : slots) {
+        if (slot.promise) {
+            slot.promise->set_exception(
+                std::make_exception_ptr(std::runtime_error("framebuffer readback was abandoned")));
+        }
+    }
+}
+
+std::future<PremultipliedImage> FramebufferReadback::read() {
+#if not MBGL_USE_GLES2
+    Slot& slot = slots[next];
+    next = (next + 1) % slots.size();
+
+    // Only two reads can be in flight; the oldest one has to be copied out before its buffer
+    // can be reused. This only happens if the previous read was never completed by finish().
+    if (slot.promise) {
+        complete(slot);
+    }
+
+    if (!slot.buffer) {
+        slot.buffer = context.createPixelPackBuffer(size.area() * PremultipliedImage::channels);
+    }
+    context.readFramebufferToBuffer(*slot.buffer, size);
+    slot.promise.emplace();
+    std::future<PremultipliedImage> result = slot.promise->get_future();
+
+    // Copy out the previous frame while the GPU transfers the current one.
+    Slot& previous = slots[next];
+    if (previous.promise) {
+        complete(previous);
+    }
+
+    // Waiting on a read that nothing else completed yet copies it out right away, rather than
+    // waiting for a read() or finish() that may never come.
+    return std::async(std::launch::deferred,
+                      [readback = std::weak_ptr<FramebufferReadback*>(self), result = std::move(result)] () mutable {
+        if (result.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            if (auto owner = readback.lock()) {
+                (*owner)->finish();
+            }
+        }
+        return result.get();
+    });
+#else
+    std::promise<PremultipliedImage> promise;
+    promise.set_value(context.readFramebuffer<PremultipliedImage>(size));
+    return promise.get_future();
+#endif // MBGL_USE_GLES2
+}
+
+void FramebufferReadback::finish() {
+    // Complete the reads in the order in which they were queued.
+    for (std::size_t i = 0; i < slots.size(); i++) {
+        Slot& slot = slots[(next + i) % slots.size()];
+        if (slot.promise) {
+            complete(slot);
+        }
+    }
+}
+
+void FramebufferReadback::complete(Slot& slot) {
+    auto promise = std::move(*slot.promise);
+    slot.promise = {};
+
+#if not MBGL_USE_GLES2
+    try {
+        const uint8_t* data = context.mapPixelPackBuffer(*slot.buffer);
+        if (!data) {
+            context.unmapPixelPackBuffer();
+            throw std::runtime_error("failed to map pixel pack buffer");
+        }
+
+        PremultipliedImage image(size);
+        const std::size_t stride = size.width * PremultipliedImage::channels;
+        for (uint32_t row = 0; row < size.height; row++) {
+            std::memcpy(image.data.get() + row * stride, data + (size.height - row - 1) * stride, stride);
+        }
+        context.unmapPixelPackBuffer();
+
+        promise.set_value(std::move(image));
+    } catch (...) {
+        promise.set_exception(std::current_exception());
+    }
+#else
+    (void)promise;
+#endif // MBGL_USE_GLES2
+}
+
+} // namespace gl
+} // namespace mbgl
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <mbgl/gl/object.hpp>
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/optional.hpp>
+#include <mbgl/util/size.hpp>
+
+#include <array>
+#include <future>
+#include <memory>
+
+namespace mbgl {
+namespace gl {
+
+class Context;
+
+// Reads the bound framebuffer through a pair of pixel pack buffers. read() only queues the
+// transfer on the GPU and returns immediately. The pixels of a read are copied out by the
+// following read(), by finish(), or by getting the result of its future, whichever comes
+// first, so the transfer of one frame overlaps with rendering the next. Futures must be
+// waited on by the thread that owns the context. Rows are copied out in reverse order, which
+// turns the bottom-up framebuffer rows into a top-down image without a separate flipping pass.
+//
+// OpenGL ES 2 has no pixel pack buffers; there, read() reads synchronously and returns a
+// future that is already satisfied.
+class FramebufferReadback {
+public:
+    FramebufferReadback(Context&, Size);
+    ~FramebufferReadback();
+
+    std::future<PremultipliedImage> read();
+
+    // Copies out all pending reads. Must be called before the framebuffer contents that were
+    // read from are needed by the caller, e.g. before the last image of a batch is used.
+    void finish();
+
+    const Size size;
+
+private:
+    struct Slot {
+        optional<UniqueBuffer> buffer;
+        optional<std::promise<PremultipliedImage>> promise;
+    };
+
+    void complete(Slot&);
+
+    Context& context;
+    std::array<Slot, 2> slots;
+    std::size_t next = 0;
+
+    // Lets futures tell whether the readback still exists when they are waited on.
+    std::shared_ptr<FramebufferReadback*> self = std::make_shared<FramebufferReadback*>(this);
+};
+
+} // namespace gl
+} // namespace mbgl
@@ -2,13 +2,28 @@
 
 #include <mbgl/gl/object.hpp>
 #include <mbgl/gl/draw_mode.hpp>
+#include <mbgl/gl/features.hpp>
+#include <mbgl/gl/types.hpp>
 #include <mbgl/util/ignore.hpp>
 
+#include <cassert>
+#include <cstdint>
+#include <limits>
 #include <vector>
 
 namespace mbgl {
 namespace gl {
 
+// The largest number of vertices that a single segment can address with its indices.
+#if MBGL_HAS_UINT32_INDICES
+constexpr std::size_t maxSegmentVertices = std::numeric_limits<uint32_t>::max();
+#else
+constexpr std::size_t maxSegmentVertices = std::numeric_limits<uint16_t>::max();
+#endif
+
+// Indices are stored as 16-bit values until the first index that doesn't fit, at which point
+// the whole vector is widened to 32-bit values. Most buckets never get there and keep their
+// compact index buffers, while oversized geometries can still be drawn from a single segment.
 template <class DrawMode>
 class IndexVector {
 public:
@@ -17,24 +32,44 @@ public:
     template <class... Args>
     void emplace_back(Args&&... args) {
         static_assert(sizeof...(args) == groupSize, "wrong buffer element count");
-        util::ignore({(v.emplace_back(std::forward<Args>(args)), 0)...});
+        util::ignore({(push(std::forward<Args>(args)), 0)...});
     }
 
-    std::size_t indexSize() const { return v.size(); }
-    std::size_t byteSize() const { return v.size() * sizeof(uint16_t); }
+    std::size_t indexSize() const { return wide ? v32.size() : v16.size(); }
+    std::size_t byteSize() const {
+        return wide ? v32.size() * sizeof(uint32_t) : v16.size() * sizeof(uint16_t);
+    }
 
-    bool empty() const { return v.empty(); }
-    void clear() { v.clear(); }
-    const uint16_t* data() const { return v.data(); }
+    bool empty() const { return indexSize() == 0; }
+    void clear() { v16.clear(); v32.clear(); wide = false; }
+    const void* data() const { return wide ? static_cast<const void*>(v32.data()) : v16.data(); }
+    DataType type() const { return wide ? DataType::UnsignedInteger : DataType::UnsignedShort; }
 
 private:
-    std::vector<uint16_t> v;
+    void push(std::size_t index) {
+        assert(index <= maxSegmentVertices);
+        if (!wide && index > std::numeric_limits<uint16_t>::max()) {
+            v32.assign(v16.begin(), v16.end());
+            v16 = {};
+            wide = true;
+        }
+        if (wide) {
+            v32.push_back(static_cast<uint32_t>(index));
+        } else {
+            v16.push_back(static_cast<uint16_t>(index));
+        }
+    }
+
+    std::vector<uint16_t> v16;
+    std::vector<uint32_t> v32;
+    bool wide = false;
 };
 
 template <class DrawMode>
 class IndexBuffer {
 public:
     UniqueBuffer buffer;
+    DataType type;
 };
 
 } // namespace gl
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <mbgl/util/variant.hpp>
+#include <mbgl/util/optional.hpp>
+#include <mbgl/util/size.hpp>
 
 namespace mbgl {
 namespace gl {
@@ -57,10 +59,23 @@ public:
     Op depthFail;
     Op pass;
 
+    // A rectangle in window coordinates to clip to with the scissor test.
+    struct Scissor {
+        int32_t x;
+        int32_t y;
+        Size size;
+    };
+
+    optional<Scissor> scissor;
+
     static StencilMode disabled() {
-       return StencilMode { Always(), 0, 0, Keep, Keep, Keep };
+       return StencilMode { Always(), 0, 0, Keep, Keep, Keep, {} };
     }
 };
 
+constexpr bool operator!=(const StencilMode::Scissor& a, const StencilMode::Scissor& b) {
+    return a.x != b.x || a.y != b.y || a.size != b.size;
+}
+
 } // namespace gl
 } // namespace mbgl
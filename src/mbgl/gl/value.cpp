@@ -267,6 +267,19 @@ Viewport::Type Viewport::Get() {
              { static_cast<uint32_t>(viewport[2]), static_cast<uint32_t>(viewport[3]) } };
 }
 
+const constexpr Scissor::Type Scissor::Default;
+
+void Scissor::Set(const Type& value) {
+    MBGL_CHECK_ERROR(glScissor(value.x, value.y, value.size.width, value.size.height));
+}
+
+Scissor::Type Scissor::Get() {
+    GLint scissor[4];
+    MBGL_CHECK_ERROR(glGetIntegerv(GL_SCISSOR_BOX, scissor));
+    return { static_cast<int32_t>(scissor[0]), static_cast<int32_t>(scissor[1]),
+             { static_cast<uint32_t>(scissor[2]), static_cast<uint32_t>(scissor[3]) } };
+}
+
 const constexpr ScissorTest::Type ScissorTest::Default;
 
 void ScissorTest::Set(const Type& value) {
@@ -425,6 +438,18 @@ PointSize::Type PointSize::Get() {
     return pointSize;
 }
 
+const constexpr BindPixelPackBuffer::Type BindPixelPackBuffer::Default;
+
+void BindPixelPackBuffer::Set(const Type& value) {
+    MBGL_CHECK_ERROR(glBindBuffer(GL_PIXEL_PACK_BUFFER, value));
+}
+
+BindPixelPackBuffer::Type BindPixelPackBuffer::Get() {
+    GLint binding;
+    MBGL_CHECK_ERROR(glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &binding));
+    return binding;
+}
+
 const constexpr PixelZoom::Type PixelZoom::Default;
 
 void PixelZoom::Set(const Type& value) {
@@ -183,6 +183,13 @@ struct Viewport {
     static Type Get();
 };
 
+struct Scissor {
+    using Type = StencilMode::Scissor;
+    static const constexpr Type Default = { 0, 0, { 0, 0 } };
+    static void Set(const Type&);
+    static Type Get();
+};
+
 struct ScissorTest {
     using Type = bool;
     static const constexpr Type Default = false;
@@ -262,6 +269,13 @@ struct PixelStoreUnpack {
 
 #if not MBGL_USE_GLES2
 
+struct BindPixelPackBuffer {
+    using Type = gl::BufferID;
+    static const constexpr Type Default = 0;
+    static void Set(const Type&);
+    static Type Get();
+};
+
 struct PointSize {
     using Type = float;
     static const constexpr Type Default = 1;
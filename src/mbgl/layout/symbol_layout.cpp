@@ -343,9 +343,9 @@ void SymbolLayout::addFeature(const std::size_t index,
         // |                  ||
         // |                  || In continuous mode, to avoid overdraw we
         // |                  || skip symbols located on the extent edges.
-        // |       Tile       || In still mode, we include the features in
-        // |                  || the buffers for both tiles and clip them
-        // |                  || at draw time.
+        // |       Tile       || In still and tile mode, we include the
+        // |                  || features in the buffers for both tiles
+        // |                  || and clip them at draw time.
         // |                  ||
         // +-------------------| In this scenario, the inner bounding box
         // +-------------------+ is called 'withinPlus0', and the outer
@@ -355,7 +355,7 @@ void SymbolLayout::addFeature(const std::size_t index,
 
         if (avoidEdges && !inside) return;
 
-        const bool addToBuffers = mode == MapMode::Still || withinPlus0;
+        const bool addToBuffers = mode != MapMode::Continuous || withinPlus0;
 
         symbolInstances.emplace_back(anchor, line, shapedTextOrientations, shapedIcon,
                 layout.evaluate(zoom, feature), layoutTextSize,
@@ -573,15 +573,15 @@ void SymbolLayout::addSymbol(Buffer& buffer,
         if ((symbol.writingMode == WritingModeType::Vertical) != placedSymbol.useVerticalMode) return;
     }
 
-    if (buffer.segments.empty() || buffer.segments.back().vertexLength + vertexLength > std::numeric_limits<uint16_t>::max()) {
+    if (buffer.segments.empty() || buffer.segments.back().vertexLength + vertexLength > gl::maxSegmentVertices) {
         buffer.segments.emplace_back(buffer.vertices.vertexSize(), buffer.triangles.indexSize());
     }
 
     // We're generating triangle fans, so we always start with the first
     // coordinate in this polygon.
     auto& segment = buffer.segments.back();
-    assert(segment.vertexLength <= std::numeric_limits<uint16_t>::max());
-    uint16_t index = segment.vertexLength;
+    assert(segment.vertexLength <= gl::maxSegmentVertices);
+    std::size_t index = segment.vertexLength;
 
     // coordinates (2 triangles)
     buffer.vertices.emplace_back(SymbolLayoutAttributes::vertex(labelAnchor.point, tl, symbol.glyphOffset.y, tex.x, tex.y, sizeData));
@@ -635,12 +635,12 @@ void SymbolLayout::addToDebugBuffers(CollisionTile& collisionTile, SymbolBucket&
                 static constexpr std::size_t vertexLength = 4;
                 static constexpr std::size_t indexLength = 8;
 
-                if (collisionBox.segments.empty() || collisionBox.segments.back().vertexLength + vertexLength > std::numeric_limits<uint16_t>::max()) {
+                if (collisionBox.segments.empty() || collisionBox.segments.back().vertexLength + vertexLength > gl::maxSegmentVertices) {
                     collisionBox.segments.emplace_back(collisionBox.vertices.vertexSize(), collisionBox.lines.indexSize());
                 }
 
                 auto& segment = collisionBox.segments.back();
-                uint16_t index = segment.vertexLength;
+                std::size_t index = segment.vertexLength;
 
                 collisionBox.vertices.emplace_back(CollisionBoxProgram::vertex(anchor, symbolInstance.anchor.point, tl, maxZoom, placementZoom));
                 collisionBox.vertices.emplace_back(CollisionBoxProgram::vertex(anchor, symbolInstance.anchor.point, tr, maxZoom, placementZoom));
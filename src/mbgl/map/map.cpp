@@ -19,6 +19,7 @@
 #include <mbgl/actor/scheduler.hpp>
 #include <mbgl/util/logging.hpp>
 #include <mbgl/math/log2.hpp>
+#include <limits>
 #include <utility>
 
 namespace mbgl {
@@ -33,6 +34,26 @@ struct StillImageRequest {
     Map::StillImageCallback callback;
 };
 
+struct StillImageBatch {
+    StillImageBatch(std::vector<Map::StillImageOptions> images_,
+                    std::vector<TransformState> states_,
+                    Map::StillImageBatchCallback&& callback_)
+        : images(std::move(images_)),
+          states(std::move(states_)),
+          callback(std::move(callback_)) {
+    }
+
+    const std::vector<Map::StillImageOptions> images;
+
+    // Camera states of all images, used for loading the tiles of upcoming images in advance.
+    const std::vector<TransformState> states;
+
+    Map::StillImageBatchCallback callback;
+
+    // Index of the image that is rendered next.
+    std::size_t next = 0;
+};
+
 class Map::Impl : public style::Observer,
                   public RendererObserver {
 public:
@@ -63,6 +84,8 @@ public:
     void onWillStartRenderingMap() override;
     void onDidFinishRenderingMap() override;
 
+    void renderNextStill();
+
     Map& map;
     MapObserver& observer;
     RendererFrontend& rendererFrontend;
@@ -82,10 +105,12 @@ public:
     bool cameraMutated = false;
 
     uint8_t prefetchZoomDelta = util::DEFAULT_PREFETCH_ZOOM_DELTA;
+    uint32_t prefetchTileBudget = util::DEFAULT_PREFETCH_TILE_BUDGET;
 
     bool loading = false;
     bool rendererFullyLoaded;
     std::unique_ptr<StillImageRequest> stillImageRequest;
+    std::unique_ptr<StillImageBatch> stillImageBatch;
 };
 
 Map::Map(RendererFrontend& rendererFrontend,
@@ -123,8 +148,10 @@ Map::Impl::Impl(Map& map_,
       rendererFrontend(frontend),
       fileSource(fileSource_),
       scheduler(scheduler_),
+      // Tiles are rendered with a camera that is aligned to the tile grid, which must
+      // not be moved to keep the world in view at low zoom levels.
       transform(observer,
-                constrainMode_,
+                mode_ == MapMode::Tile ? ConstrainMode::None : constrainMode_,
                 viewportMode_),
       mode(mode_),
       pixelRatio(pixelRatio_),
@@ -149,12 +176,12 @@ void Map::renderStill(StillImageCallback callback) {
         return;
     }
 
-    if (impl->mode != MapMode::Still) {
+    if (impl->mode == MapMode::Continuous) {
         callback(std::make_exception_ptr(util::MisuseException("Map is not in still image render mode")));
         return;
     }
 
-    if (impl->stillImageRequest) {
+    if (impl->stillImageRequest || impl->stillImageBatch) {
         callback(std::make_exception_ptr(util::MisuseException("Map is currently rendering an image")));
         return;
     }
@@ -169,6 +196,68 @@ void Map::renderStill(StillImageCallback callback) {
     impl->onUpdate(Update::Repaint);
 }
 
+void Map::renderStills(std::vector<StillImageOptions> images, StillImageBatchCallback callback) {
+    if (!callback) {
+        Log::Error(Event::General, "StillImageBatchCallback not set");
+        return;
+    }
+
+    if (images.empty()) {
+        return;
+    }
+
+    if (impl->mode == MapMode::Continuous) {
+        callback(0, std::make_exception_ptr(util::MisuseException("Map is not in still image render mode")));
+        return;
+    }
+
+    if (impl->stillImageRequest || impl->stillImageBatch) {
+        callback(0, std::make_exception_ptr(util::MisuseException("Map is currently rendering an image")));
+        return;
+    }
+
+    if (impl->style->impl->getLastError()) {
+        callback(0, impl->style->impl->getLastError());
+        return;
+    }
+
+    std::vector<TransformState> states;
+    states.reserve(images.size());
+    for (const auto& image : images) {
+        Transform shallow { impl->transform.getState() };
+        shallow.resize(image.size);
+        shallow.jumpTo(image.camera);
+        states.push_back(shallow.getState());
+    }
+
+    impl->stillImageBatch = std::make_unique<StillImageBatch>(std::move(images), std::move(states), std::move(callback));
+    impl->renderNextStill();
+}
+
+void Map::Impl::renderNextStill() {
+    assert(stillImageBatch && stillImageBatch->next < stillImageBatch->images.size());
+
+    const std::size_t index = stillImageBatch->next++;
+    const auto& image = stillImageBatch->images[index];
+
+    cameraMutated = true;
+    transform.resize(image.size);
+    transform.jumpTo(image.camera);
+
+    stillImageRequest = std::make_unique<StillImageRequest>([this, index] (std::exception_ptr error) {
+        auto batch = std::move(stillImageBatch);
+        batch->callback(index, error);
+
+        // Continue unless the callback failed or started rendering another image on its own.
+        if (!error && batch->next < batch->images.size() && !stillImageRequest && !stillImageBatch) {
+            stillImageBatch = std::move(batch);
+            renderNextStill();
+        }
+    });
+
+    onUpdate(Update::Repaint);
+}
+
 void Map::triggerRepaint() {
     impl->onUpdate(Update::Repaint);
 }
@@ -226,6 +315,7 @@ void Map::setStyle(std::unique_ptr<Style> style) {
     assert(style);
     impl->onStyleLoading();
     impl->style = std::move(style);
+    impl->style->impl->setObserver(impl.get());
     impl->annotationManager.setStyle(*impl->style);
 }
 
@@ -631,6 +721,21 @@ void Map::removeAnnotation(AnnotationID annotation) {
     impl->onUpdate(Update::AnnotationData);
 }
 
+AnnotationIDs Map::addAnnotations(const std::vector<Annotation>& annotations) {
+    auto result = impl->annotationManager.addAnnotations(annotations, getMaxZoom());
+    impl->onUpdate(Update::AnnotationData);
+    return result;
+}
+
+void Map::updateAnnotations(const std::vector<std::pair<AnnotationID, Annotation>>& annotations) {
+    impl->onUpdate(impl->annotationManager.updateAnnotations(annotations, getMaxZoom()));
+}
+
+void Map::removeAnnotations(const AnnotationIDs& annotations) {
+    impl->annotationManager.removeAnnotations(annotations);
+    impl->onUpdate(Update::AnnotationData);
+}
+
 #pragma mark - Toggles
 
 void Map::setDebug(MapDebugOptions debugOptions) {
@@ -674,6 +779,14 @@ uint8_t Map::getPrefetchZoomDelta() const {
     return impl->prefetchZoomDelta;
 }
 
+void Map::setPrefetchTileBudget(uint32_t budget) {
+    impl->prefetchTileBudget = budget;
+}
+
+uint32_t Map::getPrefetchTileBudget() const {
+    return impl->prefetchTileBudget;
+}
+
 bool Map::isFullyLoaded() const {
     return impl->style->impl->isLoaded() && impl->rendererFullyLoaded;
 }
@@ -695,6 +808,16 @@ void Map::Impl::onUpdate(Update flags) {
         annotationManager.updateData();
     }
 
+    // Still images of a batch are all going to be rendered, so all of their tiles are loaded.
+    std::vector<TransformState> prefetchStates;
+    uint32_t budget = std::numeric_limits<uint32_t>::max();
+    if (stillImageBatch) {
+        prefetchStates.assign(stillImageBatch->states.begin() + stillImageBatch->next, stillImageBatch->states.end());
+    } else if (prefetchTileBudget) {
+        prefetchStates = transform.getTransitionStates(timePoint);
+        budget = prefetchTileBudget;
+    }
+
     UpdateParameters params = {
         style->impl->isLoaded(),
         mode,
@@ -713,7 +836,9 @@ void Map::Impl::onUpdate(Update flags) {
         fileSource,
         annotationManager,
         prefetchZoomDelta,
-        bool(stillImageRequest)
+        bool(stillImageRequest),
+        std::move(prefetchStates),
+        budget
     };
 
     rendererFrontend.update(std::make_shared<UpdateParameters>(std::move(params)));
@@ -743,7 +868,7 @@ void Map::Impl::onStyleError(std::exception_ptr error) {
 }
 
 void Map::Impl::onResourceError(std::exception_ptr error) {
-    if (mode == MapMode::Still && stillImageRequest) {
+    if (mode != MapMode::Continuous && stillImageRequest) {
         auto request = std::move(stillImageRequest);
         request->callback(error);
     }
@@ -0,0 +1,85 @@
+#include <mbgl/map/metatile.hpp>
+#include <mbgl/util/constants.hpp>
+#include <mbgl/util/projection.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace mbgl {
+
+namespace {
+
+uint32_t metatileSize(uint8_t z, uint32_t size) {
+    if (size == 0) {
+        throw std::invalid_argument("metatile size must be positive");
+    }
+    if (z > util::MAX_ZOOM) {
+        throw std::domain_error("metatile zoom level is out of range");
+    }
+    return std::min<uint64_t>(size, uint64_t(1) << z);
+}
+
+} // namespace
+
+Metatile::Metatile(uint8_t z_, uint32_t x_, uint32_t y_,
+                   uint32_t size_, uint32_t tileSize_, uint32_t buffer_)
+    : z(z_),
+      x(x_ / metatileSize(z_, size_) * metatileSize(z_, size_)),
+      y(y_ / metatileSize(z_, size_) * metatileSize(z_, size_)),
+      size(metatileSize(z_, size_)),
+      tileSize(tileSize_),
+      buffer(buffer_) {
+    if (tileSize == 0) {
+        throw std::invalid_argument("tile size must be positive");
+    }
+    if (*camera().zoom < util::MIN_ZOOM) {
+        throw std::domain_error("tile size is too small to be rendered at this zoom level");
+    }
+    if (uint64_t(x_) >= (uint64_t(1) << z) || uint64_t(y_) >= (uint64_t(1) << z)) {
+        throw std::domain_error("tile coordinates are out of range");
+    }
+}
+
+Size Metatile::renderSize() const {
+    const uint32_t extent = size * tileSize + 2 * buffer;
+    return { extent, extent };
+}
+
+CameraOptions Metatile::camera() const {
+    // Tiles are laid out on a grid of `tileSize` pixels, while the map's zoom level is based on
+    // util::tileSize; a zoom offset lines up the map with the requested tile grid.
+    const double scale = std::pow(2.0, z) * tileSize / util::tileSize;
+    const Point<double> center { (x + size / 2.0) * tileSize, (y + size / 2.0) * tileSize };
+
+    CameraOptions camera;
+    camera.center = Projection::unproject(center, scale);
+    camera.zoom = std::log2(scale);
+    camera.angle = 0.0;
+    camera.pitch = 0.0;
+    return camera;
+}
+
+std::vector<Metatile::Tile> Metatile::slice(const PremultipliedImage& image, float pixelRatio) const {
+    const auto tilePixels = static_cast<uint32_t>(tileSize * pixelRatio);
+    const auto bufferPixels = static_cast<uint32_t>(buffer * pixelRatio);
+    if (image.size.width < size * tilePixels + 2 * bufferPixels ||
+        image.size.height < size * tilePixels + 2 * bufferPixels) {
+        throw std::invalid_argument("image is too small for the metatile");
+    }
+
+    std::vector<Tile> tiles;
+    tiles.reserve(size * size);
+    for (uint32_t row = 0; row < size; row++) {
+        for (uint32_t column = 0; column < size; column++) {
+            PremultipliedImage tile({ tilePixels, tilePixels });
+            PremultipliedImage::copy(image, tile,
+                                     { bufferPixels + column * tilePixels, bufferPixels + row * tilePixels },
+                                     { 0, 0 }, tile.size);
+            tiles.push_back({ z, x + column, y + row, std::move(tile) });
+        }
+    }
+    return tiles;
+}
+
+} // namespace mbgl
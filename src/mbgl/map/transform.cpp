@@ -552,6 +552,23 @@ void Transform::startTransition(const CameraOptions& camera,
     transitionStart = Clock::now();
     transitionDuration = duration;
 
+    // Sample the path ahead of time, so that tiles along the way can be loaded before the camera
+    // arrives. Frames are applied to the current state, which is restored afterwards.
+    transitionStates.clear();
+    if (isAnimated) {
+        const TransformState current = state;
+        const util::UnitBezier ease = animation.easing ? *animation.easing : util::DEFAULT_TRANSITION_EASE;
+        for (uint8_t i = 1; i <= util::PREFETCH_TRANSITION_SAMPLES; i++) {
+            const double t = double(i) / util::PREFETCH_TRANSITION_SAMPLES;
+            frame(i == util::PREFETCH_TRANSITION_SAMPLES ? 1.0 : ease.solve(t, 0.001));
+            if (anchor) state.moveLatLng(anchorLatLng, *anchor);
+            transitionStates.emplace_back(
+                transitionStart + std::chrono::duration_cast<Duration>(std::chrono::duration<double>(duration) * t),
+                state);
+            state = current;
+        }
+    }
+
     transitionFrameFn = [isAnimated, animation, frame, anchor, anchorLatLng, this](const TimePoint now) {
         float t = isAnimated ? (std::chrono::duration<float>(now - transitionStart) / transitionDuration) : 1.0;
         if (t >= 1.0) {
@@ -580,6 +597,7 @@ void Transform::startTransition(const CameraOptions& camera,
     };
 
     transitionFinishFn = [isAnimated, animation, this] {
+        transitionStates.clear();
         state.panning = false;
         state.scaling = false;
         state.rotating = false;
@@ -594,6 +612,20 @@ void Transform::startTransition(const CameraOptions& camera,
     }
 }
 
+std::vector<TransformState> Transform::getTransitionStates(const TimePoint& now) const {
+    std::vector<TransformState> result;
+    if (transitionStates.empty()) {
+        return result;
+    }
+    result.push_back(transitionStates.back().second);
+    for (auto it = transitionStates.begin(); it + 1 != transitionStates.end(); ++it) {
+        if (it->first > now) {
+            result.push_back(it->second);
+        }
+    }
+    return result;
+}
+
 bool Transform::inTransition() const {
     return transitionFrameFn != nullptr;
 }
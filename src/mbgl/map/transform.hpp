@@ -12,6 +12,8 @@
 #include <cstdint>
 #include <cmath>
 #include <functional>
+#include <utility>
+#include <vector>
 
 namespace mbgl {
 
@@ -132,6 +134,10 @@ public:
     Duration getTransitionDuration() const { return transitionDuration; }
     void cancelTransitions();
 
+    // Camera states on the remaining path of the current animation: the destination first,
+    // followed by the states along the way in the order in which they are reached.
+    std::vector<TransformState> getTransitionStates(const TimePoint& now) const;
+
     // Gesture
     void setGestureInProgress(bool);
     bool isGestureInProgress() const { return state.isGestureInProgress(); }
@@ -159,6 +165,10 @@ private:
     Duration transitionDuration;
     std::function<void(const TimePoint)> transitionFrameFn;
     std::function<void()> transitionFinishFn;
+
+    // Camera states sampled along the path of the current animation, with the time at which
+    // they are reached.
+    std::vector<std::pair<TimePoint, TransformState>> transitionStates;
 };
 
 } // namespace mbgl
@@ -156,7 +156,7 @@ public:
     
     ConstantSymbolSizeBinder(const float tileZoom, const style::CameraFunction<float>& function_, const float /*defaultValue*/)
       : layoutSize(function_.evaluate(tileZoom + 1)) {
-        function_.stops.match(
+        function_.getStops().match(
             [&] (const style::ExponentialStops<float>& stops) {
                 const auto& zoomLevels = getCoveringStops(stops, tileZoom, tileZoom + 1);
                 coveringRanges = std::make_tuple(
@@ -237,7 +237,7 @@ public:
         : function(function_),
           defaultValue(defaultValue_),
           layoutZoom(tileZoom + 1),
-          coveringZoomStops(function.stops.match(
+          coveringZoomStops(function.getStops().match(
             [&] (const auto& stops) {
             return getCoveringStops(stops, tileZoom, tileZoom + 1); }))
     {}
@@ -47,12 +47,12 @@ void CircleBucket::addFeature(const GeometryTileFeature& feature,
             auto y = point.y;
 
             // Do not include points that are outside the tile boundaries.
-            // Include all points in Still mode. You need to include points from
+            // Include all points in Still and Tile mode. You need to include points from
             // neighbouring tiles so that they are not clipped at tile boundaries.
-            if ((mode != MapMode::Still) &&
+            if ((mode == MapMode::Continuous) &&
                 (x < 0 || x >= util::EXTENT || y < 0 || y >= util::EXTENT)) continue;
 
-            if (segments.empty() || segments.back().vertexLength + vertexLength > std::numeric_limits<uint16_t>::max()) {
+            if (segments.empty() || segments.back().vertexLength + vertexLength > gl::maxSegmentVertices) {
                 // Move to a new segments because the old one can't hold the geometry.
                 segments.emplace_back(vertices.vertexSize(), triangles.indexSize());
             }
@@ -72,8 +72,8 @@ void CircleBucket::addFeature(const GeometryTileFeature& feature,
             vertices.emplace_back(CircleProgram::vertex(point, -1,  1)); // 4
 
             auto& segment = segments.back();
-            assert(segment.vertexLength <= std::numeric_limits<uint16_t>::max());
-            uint16_t index = segment.vertexLength;
+            assert(segment.vertexLength <= gl::maxSegmentVertices);
+            std::size_t index = segment.vertexLength;
 
             // 1, 2, 3
             // 1, 4, 3
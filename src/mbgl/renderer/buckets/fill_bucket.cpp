@@ -48,7 +48,7 @@ void FillBucket::addFeature(const GeometryTileFeature& feature,
 
         for (const auto& ring : polygon) {
             totalVertices += ring.size();
-            if (totalVertices > std::numeric_limits<uint16_t>::max())
+            if (totalVertices > gl::maxSegmentVertices)
                 throw GeometryTooLongException();
         }
 
@@ -60,13 +60,13 @@ void FillBucket::addFeature(const GeometryTileFeature& feature,
             if (nVertices == 0)
                 continue;
 
-            if (lineSegments.empty() || lineSegments.back().vertexLength + nVertices > std::numeric_limits<uint16_t>::max()) {
+            if (lineSegments.empty() || lineSegments.back().vertexLength + nVertices > gl::maxSegmentVertices) {
                 lineSegments.emplace_back(vertices.vertexSize(), lines.indexSize());
             }
 
             auto& lineSegment = lineSegments.back();
-            assert(lineSegment.vertexLength <= std::numeric_limits<uint16_t>::max());
-            uint16_t lineIndex = lineSegment.vertexLength;
+            assert(lineSegment.vertexLength <= gl::maxSegmentVertices);
+            std::size_t lineIndex = lineSegment.vertexLength;
 
             vertices.emplace_back(FillProgram::layoutVertex(ring[0]));
             lines.emplace_back(lineIndex + nVertices - 1, lineIndex);
@@ -85,13 +85,13 @@ void FillBucket::addFeature(const GeometryTileFeature& feature,
         std::size_t nIndicies = indices.size();
         assert(nIndicies % 3 == 0);
 
-        if (triangleSegments.empty() || triangleSegments.back().vertexLength + totalVertices > std::numeric_limits<uint16_t>::max()) {
+        if (triangleSegments.empty() || triangleSegments.back().vertexLength + totalVertices > gl::maxSegmentVertices) {
             triangleSegments.emplace_back(startVertices, triangles.indexSize());
         }
 
         auto& triangleSegment = triangleSegments.back();
-        assert(triangleSegment.vertexLength <= std::numeric_limits<uint16_t>::max());
-        uint16_t triangleIndex = triangleSegment.vertexLength;
+        assert(triangleSegment.vertexLength <= gl::maxSegmentVertices);
+        std::size_t triangleIndex = triangleSegment.vertexLength;
 
         for (uint32_t i = 0; i < nIndicies; i += 3) {
             triangles.emplace_back(triangleIndex + indices[i],
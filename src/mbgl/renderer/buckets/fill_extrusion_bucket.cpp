@@ -54,7 +54,7 @@ void FillExtrusionBucket::addFeature(const GeometryTileFeature& feature,
 
         for (const auto& ring : polygon) {
             totalVertices += ring.size();
-            if (totalVertices > std::numeric_limits<uint16_t>::max())
+            if (totalVertices > gl::maxSegmentVertices)
                 throw GeometryTooLongException();
         }
 
@@ -67,16 +67,16 @@ void FillExtrusionBucket::addFeature(const GeometryTileFeature& feature,
 
         if (triangleSegments.empty() ||
             triangleSegments.back().vertexLength + (5 * (totalVertices - 1) + 1) >
-                std::numeric_limits<uint16_t>::max()) {
+                gl::maxSegmentVertices) {
             triangleSegments.emplace_back(startVertices, triangles.indexSize());
         }
 
         auto& triangleSegment = triangleSegments.back();
-        assert(triangleSegment.vertexLength <= std::numeric_limits<uint16_t>::max());
-        uint16_t triangleIndex = triangleSegment.vertexLength;
+        assert(triangleSegment.vertexLength <= gl::maxSegmentVertices);
+        std::size_t triangleIndex = triangleSegment.vertexLength;
 
         assert(triangleIndex + (5 * (totalVertices - 1) + 1) <=
-               std::numeric_limits<uint16_t>::max());
+               gl::maxSegmentVertices);
 
         for (const auto& ring : polygon) {
             std::size_t nVertices = ring.size();
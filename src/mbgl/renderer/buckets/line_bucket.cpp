@@ -370,13 +370,13 @@ void LineBucket::addGeometry(const GeometryCoordinates& coordinates, FeatureType
     const std::size_t endVertex = vertices.vertexSize();
     const std::size_t vertexCount = endVertex - startVertex;
 
-    if (segments.empty() || segments.back().vertexLength + vertexCount > std::numeric_limits<uint16_t>::max()) {
+    if (segments.empty() || segments.back().vertexLength + vertexCount > gl::maxSegmentVertices) {
         segments.emplace_back(startVertex, triangles.indexSize());
     }
 
     auto& segment = segments.back();
-    assert(segment.vertexLength <= std::numeric_limits<uint16_t>::max());
-    uint16_t index = segment.vertexLength;
+    assert(segment.vertexLength <= gl::maxSegmentVertices);
+    std::size_t index = segment.vertexLength;
 
     for (const auto& triangle : triangleStore) {
         triangles.emplace_back(index + triangle.a, index + triangle.b, index + triangle.c);
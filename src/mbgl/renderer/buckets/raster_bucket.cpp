@@ -2,6 +2,7 @@
 #include <mbgl/renderer/layers/render_raster_layer.hpp>
 #include <mbgl/programs/raster_program.hpp>
 #include <mbgl/gl/context.hpp>
+#include <mbgl/util/texture_compression.hpp>
 
 namespace mbgl {
 
@@ -20,7 +21,19 @@ void RasterBucket::upload(gl::Context& context) {
         return;
     }
     if (!texture) {
-        texture = context.createTexture(*image);
+        switch (textureFormat) {
+        case RasterTextureFormat::RGB565:
+            texture = context.createTexture(encodedSize, encodedImage.data(), gl::TextureFormat::RGB,
+                                            gl::TextureType::UnsignedShort565);
+            break;
+        case RasterTextureFormat::DXT1:
+            texture = context.createCompressedTexture(encodedSize, encodedImage.data(), encodedImage.size(),
+                                                      gl::CompressedTextureFormat::RGB_S3TC_DXT1);
+            break;
+        case RasterTextureFormat::RGBA:
+            texture = context.createTexture(*image);
+            break;
+        }
     }
     if (!vertices.empty()) {
         vertexBuffer = context.createVertexBuffer(std::move(vertices));
@@ -41,12 +54,26 @@ void RasterBucket::clear() {
 
 void RasterBucket::setImage(std::shared_ptr<PremultipliedImage> image_) {
     image = std::move(image_);
+    textureFormat = RasterTextureFormat::RGBA;
+    encodedSize = {};
+    encodedImage = {};
     texture = {};
     uploaded = false;
 }
 
+void RasterBucket::encode(RasterTextureFormat format) {
+    if (format == RasterTextureFormat::RGBA || !image || !image->valid() || !util::isOpaque(*image)) {
+        return;
+    }
+
+    encodedImage = format == RasterTextureFormat::DXT1 ? util::encodeDXT1(*image) : util::encodeRGB565(*image);
+    encodedSize = image->size;
+    textureFormat = format;
+    image.reset();
+}
+
 bool RasterBucket::hasData() const {
-    return !!image;
+    return image || textureFormat != RasterTextureFormat::RGBA;
 }
 
 } // namespace mbgl
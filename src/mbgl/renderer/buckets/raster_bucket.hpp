@@ -3,12 +3,15 @@
 #include <mbgl/gl/index_buffer.hpp>
 #include <mbgl/gl/texture.hpp>
 #include <mbgl/gl/vertex_buffer.hpp>
+#include <mbgl/map/mode.hpp>
 #include <mbgl/programs/raster_program.hpp>
 #include <mbgl/renderer/bucket.hpp>
 #include <mbgl/util/image.hpp>
 #include <mbgl/util/mat4.hpp>
 #include <mbgl/util/optional.hpp>
 
+#include <vector>
+
 namespace mbgl {
 
 class RasterBucket : public Bucket {
@@ -21,7 +24,15 @@ public:
 
     void clear();
     void setImage(std::shared_ptr<PremultipliedImage>);
+
+    // Re-encodes an opaque image in the given texture format and releases the RGBA pixels. Images
+    // with transparent pixels are kept as they are. Meant to run on the worker thread.
+    void encode(RasterTextureFormat);
+
     std::shared_ptr<PremultipliedImage> image;
+    RasterTextureFormat textureFormat = RasterTextureFormat::RGBA;
+    Size encodedSize;
+    std::vector<uint8_t> encodedImage;
     optional<gl::Texture> texture;
 
     // Bucket specific vertices are used for Image Sources only
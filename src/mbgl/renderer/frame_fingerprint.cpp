@@ -0,0 +1,45 @@
+#include <mbgl/renderer/frame_fingerprint.hpp>
+#include <mbgl/renderer/paint_parameters.hpp>
+#include <mbgl/renderer/render_item.hpp>
+#include <mbgl/renderer/render_source.hpp>
+#include <mbgl/renderer/render_tile.hpp>
+#include <mbgl/tile/tile.hpp>
+#include <mbgl/map/transform_state.hpp>
+
+#include <algorithm>
+
+namespace mbgl {
+
+FrameFingerprint::FrameFingerprint(const PaintParameters& parameters,
+                                   const RenderData& renderData,
+                                   uint64_t epoch_)
+    : view(&parameters.view),
+      mode(parameters.mapMode),
+      size(parameters.state.getSize()),
+      projMatrix(parameters.projMatrix),
+      epoch(epoch_) {
+    // Sources are visited in layer order, which doesn't depend on how the set of sources hashes.
+    std::vector<RenderSource*> sources;
+    layers.reserve(renderData.order.size());
+    for (const RenderItem& item : renderData.order) {
+        layers.push_back(&item.layer);
+        if (item.source && std::find(sources.begin(), sources.end(), item.source) == sources.end()) {
+            sources.push_back(item.source);
+            for (const RenderTile& renderTile : item.source->getRenderTiles()) {
+                tiles.push_back({ renderTile.id, renderTile.tile.generation });
+            }
+        }
+    }
+}
+
+bool FrameFingerprint::operator==(const FrameFingerprint& other) const {
+    return view == other.view &&
+           mode == other.mode &&
+           size == other.size &&
+           epoch == other.epoch &&
+           projMatrix == other.projMatrix &&
+           layers == other.layers &&
+           tiles == other.tiles;
+}
+
+} // namespace mbgl
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <mbgl/map/mode.hpp>
+#include <mbgl/tile/tile_id.hpp>
+#include <mbgl/util/mat4.hpp>
+#include <mbgl/util/size.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace mbgl {
+
+class PaintParameters;
+class RenderData;
+class RenderLayer;
+class View;
+
+// Everything a frame is drawn from, cheap enough to compare on every frame: the view, the camera,
+// the layers and tiles to render and the epoch of the style that evaluated them. Frames with equal
+// fingerprints look the same as long as nothing animates.
+class FrameFingerprint {
+public:
+    FrameFingerprint(const PaintParameters&, const RenderData&, uint64_t epoch);
+
+    bool operator==(const FrameFingerprint&) const;
+
+private:
+    struct RenderedTile {
+        UnwrappedTileID id;
+        uint64_t generation;
+
+        bool operator==(const RenderedTile& other) const {
+            return id == other.id && generation == other.generation;
+        }
+    };
+
+    const View* view;
+    MapMode mode;
+    Size size;
+    mat4 projMatrix;
+    uint64_t epoch;
+    std::vector<const RenderLayer*> layers;
+    std::vector<RenderedTile> tiles;
+};
+
+} // namespace mbgl
@@ -29,6 +29,7 @@ std::unique_ptr<Bucket> RenderBackgroundLayer::createBucket(const BucketParamete
 
 void RenderBackgroundLayer::transition(const TransitionParameters &parameters) {
     unevaluated = impl().paint.transitioned(parameters, std::move(unevaluated));
+    zoomDependent = !unevaluated.isZoomConstant();
 }
 
 void RenderBackgroundLayer::evaluate(const PropertyEvaluationParameters &parameters) {
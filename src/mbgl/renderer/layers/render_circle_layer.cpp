@@ -29,6 +29,7 @@ std::unique_ptr<Bucket> RenderCircleLayer::createBucket(const BucketParameters&
 
 void RenderCircleLayer::transition(const TransitionParameters& parameters) {
     unevaluated = impl().paint.transitioned(parameters, std::move(unevaluated));
+    zoomDependent = !unevaluated.isZoomConstant();
 }
 
 void RenderCircleLayer::evaluate(const PropertyEvaluationParameters& parameters) {
@@ -63,8 +64,8 @@ void RenderCircleLayer::render(PaintParameters& parameters, RenderSource*) {
             parameters.context,
             gl::Triangles(),
             parameters.depthModeForSublayer(0, gl::DepthMode::ReadOnly),
-            parameters.mapMode == MapMode::Still
-                ? parameters.stencilModeForClipping(tile.clip)
+            parameters.mapMode != MapMode::Continuous
+                ? parameters.stencilModeForClipping(tile)
                 : gl::StencilMode::disabled(),
             parameters.colorModeForRenderPass(),
             CircleProgram::UniformValues {
@@ -30,6 +30,7 @@ std::unique_ptr<Bucket> RenderFillLayer::createBucket(const BucketParameters& pa
 
 void RenderFillLayer::transition(const TransitionParameters& parameters) {
     unevaluated = impl().paint.transitioned(parameters, std::move(unevaluated));
+    zoomDependent = !unevaluated.isZoomConstant();
 }
 
 void RenderFillLayer::evaluate(const PropertyEvaluationParameters& parameters) {
@@ -73,7 +74,7 @@ void RenderFillLayer::render(PaintParameters& parameters, RenderSource*) {
                     parameters.context,
                     drawMode,
                     parameters.depthModeForSublayer(sublayer, gl::DepthMode::ReadWrite),
-                    parameters.stencilModeForClipping(tile.clip),
+                    parameters.stencilModeForClipping(tile),
                     parameters.colorModeForRenderPass(),
                     FillProgram::UniformValues {
                         uniforms::u_matrix::Value{
@@ -147,7 +148,7 @@ void RenderFillLayer::render(PaintParameters& parameters, RenderSource*) {
                     parameters.context,
                     drawMode,
                     parameters.depthModeForSublayer(sublayer, gl::DepthMode::ReadWrite),
-                    parameters.stencilModeForClipping(tile.clip),
+                    parameters.stencilModeForClipping(tile),
                     parameters.colorModeForRenderPass(),
                     FillPatternUniforms::values(
                         tile.translatedMatrix(evaluated.get<FillTranslate>(),
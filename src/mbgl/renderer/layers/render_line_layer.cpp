@@ -31,6 +31,7 @@ std::unique_ptr<Bucket> RenderLineLayer::createBucket(const BucketParameters& pa
 
 void RenderLineLayer::transition(const TransitionParameters& parameters) {
     unevaluated = impl().paint.transitioned(parameters, std::move(unevaluated));
+    zoomDependent = !unevaluated.isZoomConstant();
 }
 
 void RenderLineLayer::evaluate(const PropertyEvaluationParameters& parameters) {
@@ -66,7 +67,7 @@ void RenderLineLayer::render(PaintParameters& parameters, RenderSource*) {
                 parameters.context,
                 gl::Triangles(),
                 parameters.depthModeForSublayer(0, gl::DepthMode::ReadOnly),
-                parameters.stencilModeForClipping(tile.clip),
+                parameters.stencilModeForClipping(tile),
                 parameters.colorModeForRenderPass(),
                 std::move(uniformValues),
                 *bucket.vertexBuffer,
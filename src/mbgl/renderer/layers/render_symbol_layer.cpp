@@ -51,6 +51,7 @@ std::unique_ptr<SymbolLayout> RenderSymbolLayer::createLayout(const BucketParame
 
 void RenderSymbolLayer::transition(const TransitionParameters& parameters) {
     unevaluated = impl().paint.transitioned(parameters, std::move(unevaluated));
+    zoomDependent = !unevaluated.isZoomConstant();
 }
 
 void RenderSymbolLayer::evaluate(const PropertyEvaluationParameters& parameters) {
@@ -91,8 +92,8 @@ void RenderSymbolLayer::render(PaintParameters& parameters, RenderSource*) {
                          const auto& binders,
                          const auto& paintProperties)
         {
-            // We clip symbols to their tile extent in still mode.
-            const bool needsClipping = parameters.mapMode == MapMode::Still;
+            // We clip symbols to their tile extent in still and tile mode.
+            const bool needsClipping = parameters.mapMode != MapMode::Continuous;
 
             program.get(paintProperties).draw(
                 parameters.context,
@@ -101,7 +102,7 @@ void RenderSymbolLayer::render(PaintParameters& parameters, RenderSource*) {
                     ? parameters.depthModeForSublayer(0, gl::DepthMode::ReadOnly)
                     : gl::DepthMode::disabled(),
                 needsClipping
-                    ? parameters.stencilModeForClipping(tile.clip)
+                    ? parameters.stencilModeForClipping(tile)
                     : gl::StencilMode::disabled(),
                 parameters.colorModeForRenderPass(),
                 std::move(uniformValues),
@@ -233,7 +234,7 @@ void RenderSymbolLayer::render(PaintParameters& parameters, RenderSource*) {
                 parameters.context,
                 gl::Lines { 1.0f },
                 gl::DepthMode::disabled(),
-                parameters.stencilModeForClipping(tile.clip),
+                parameters.stencilModeForClipping(tile),
                 parameters.colorModeForRenderPass(),
                 CollisionBoxProgram::UniformValues {
                     uniforms::u_matrix::Value{ tile.matrix },
@@ -2,7 +2,12 @@
 #include <mbgl/renderer/update_parameters.hpp>
 #include <mbgl/renderer/render_style.hpp>
 #include <mbgl/renderer/render_static_data.hpp>
+#include <mbgl/renderer/render_tile.hpp>
 #include <mbgl/map/transform_state.hpp>
+#include <mbgl/util/constants.hpp>
+
+#include <algorithm>
+#include <cmath>
 
 namespace mbgl {
 
@@ -13,7 +18,8 @@ PaintParameters::PaintParameters(gl::Context& context_,
                     const UpdateParameters& updateParameters,
                     RenderStyle& style,
                     RenderStaticData& staticData_,
-                    FrameHistory& frameHistory_)
+                    FrameHistory& frameHistory_,
+                    algorithm::ClipIDGenerator& clipIDGenerator_)
     : context(context_),
     view(view_),
     state(updateParameters.transformState),
@@ -27,6 +33,7 @@ PaintParameters::PaintParameters(gl::Context& context_,
     contextMode(contextMode_),
     timePoint(updateParameters.timePoint),
     pixelRatio(pixelRatio_),
+    clipIDGenerator(clipIDGenerator_),
 #ifndef NDEBUG
     programs((debugOptions & MapDebugOptions::Overdraw) ? staticData_.overdrawPrograms : staticData_.programs)
 #else
@@ -61,14 +68,50 @@ gl::DepthMode PaintParameters::depthModeForSublayer(uint8_t n, gl::DepthMode::Ma
     return gl::DepthMode { gl::DepthMode::LessEqual, mask, { nearDepth, farDepth } };
 }
 
-gl::StencilMode PaintParameters::stencilModeForClipping(const ClipID& id) const {
+gl::StencilMode PaintParameters::stencilModeForClipping(const RenderTile& tile) const {
+    if (!stencilClipping) {
+        return gl::StencilMode {
+            gl::StencilMode::Always(),
+            0,
+            0,
+            gl::StencilMode::Keep,
+            gl::StencilMode::Keep,
+            gl::StencilMode::Keep,
+            scissorForTile(tile)
+        };
+    }
+
     return gl::StencilMode {
-        gl::StencilMode::Equal { static_cast<uint32_t>(id.mask.to_ulong()) },
-        static_cast<int32_t>(id.reference.to_ulong()),
+        gl::StencilMode::Equal { static_cast<uint32_t>(tile.clip.mask.to_ulong()) },
+        static_cast<int32_t>(tile.clip.reference.to_ulong()),
         0,
         gl::StencilMode::Keep,
         gl::StencilMode::Keep,
-        gl::StencilMode::Replace
+        gl::StencilMode::Replace,
+        {}
+    };
+}
+
+gl::StencilMode::Scissor PaintParameters::scissorForTile(const RenderTile& tile) const {
+    vec4 a, b;
+    matrix::transformMat4(a, {{ 0, 0, 0, 1 }}, tile.matrix);
+    matrix::transformMat4(b, {{ util::EXTENT, util::EXTENT, 0, 1 }}, tile.matrix);
+
+    // Round to the pixels whose centers are inside the tile, like the clipping mask would be
+    // rasterized, so that neighboring tiles neither overlap nor leave gaps.
+    const auto viewport = context.viewport.getCurrentValue();
+    const auto window = [&] (double ndc, int32_t offset, uint32_t size) {
+        return offset + static_cast<int32_t>(std::ceil((ndc + 1) / 2 * size - 0.5));
+    };
+    const int32_t x0 = window(a[0] / a[3], viewport.x, viewport.size.width);
+    const int32_t x1 = window(b[0] / b[3], viewport.x, viewport.size.width);
+    const int32_t y0 = window(a[1] / a[3], viewport.y, viewport.size.height);
+    const int32_t y1 = window(b[1] / b[3], viewport.y, viewport.size.height);
+
+    return {
+        std::min(x0, x1),
+        std::min(y0, y1),
+        { static_cast<uint32_t>(std::abs(x1 - x0)), static_cast<uint32_t>(std::abs(y1 - y0)) }
     };
 }
 
@@ -23,6 +23,7 @@ class TransformState;
 class ImageManager;
 class LineAtlas;
 class UnwrappedTileID;
+class RenderTile;
 
 class PaintParameters {
 public:
@@ -33,7 +34,8 @@ public:
                     const UpdateParameters&,
                     RenderStyle&,
                     RenderStaticData&,
-                    FrameHistory&);
+                    FrameHistory&,
+                    algorithm::ClipIDGenerator&);
 
     gl::Context& context;
     View& view;
@@ -54,12 +56,17 @@ public:
 
     float pixelRatio;
     std::array<float, 2> pixelsToGLUnits;
-    algorithm::ClipIDGenerator clipIDGenerator;
+    algorithm::ClipIDGenerator& clipIDGenerator;
+
+    // Whether tiles are clipped with the stencil masks of their clip IDs. Otherwise they are
+    // clipped to their bounds with the scissor test, which only works when no tiles overlap and
+    // the map is neither rotated nor pitched.
+    bool stencilClipping = true;
 
     Programs& programs;
 
     gl::DepthMode depthModeForSublayer(uint8_t n, gl::DepthMode::Mask) const;
-    gl::StencilMode stencilModeForClipping(const ClipID&) const;
+    gl::StencilMode stencilModeForClipping(const RenderTile&) const;
     gl::ColorMode colorModeForRenderPass() const;
 
     mat4 matrixForTile(const UnwrappedTileID&);
@@ -71,6 +78,9 @@ public:
     uint32_t currentLayer;
     float depthRangeSize;
     const float depthEpsilon = 1.0f / (1 << 16);
+
+private:
+    gl::StencilMode::Scissor scissorForTile(const RenderTile&) const;
 };
 
 } // namespace mbgl
@@ -38,6 +38,12 @@ public:
     // Returns true if any paint properties have active transitions.
     virtual bool hasTransition() const = 0;
 
+    // Returns true if evaluating the paint properties at another zoom level may give different
+    // results. Layers that aren't don't need to be evaluated again when the zoom level changes.
+    bool isZoomDependent() const {
+        return zoomDependent;
+    }
+
     // Check whether this layer is of the given subtype.
     template <class T>
     bool is() const;
@@ -86,6 +92,9 @@ protected:
     // evaluated StyleProperties object and is updated accordingly.
     RenderPass passes = RenderPass::None;
 
+    // Set on transition, from the paint properties transitioned to.
+    bool zoomDependent = true;
+
     //Stores current set of tiles to be rendered for this layer.
     std::vector<std::reference_wrapper<RenderTile>> renderTiles;
 
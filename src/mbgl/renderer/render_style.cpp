@@ -36,10 +36,10 @@ using namespace style;
 
 RenderStyleObserver nullObserver;
 
-RenderStyle::RenderStyle(Scheduler& scheduler_, FileSource& fileSource_)
+RenderStyle::RenderStyle(Scheduler& scheduler_, FileSource& fileSource_, const optional<std::string>& decodedCacheDir)
     : scheduler(scheduler_),
       fileSource(fileSource_),
-      glyphManager(std::make_unique<GlyphManager>(fileSource)),
+      glyphManager(std::make_unique<GlyphManager>(fileSource, decodedCacheDir)),
       imageManager(std::make_unique<ImageManager>()),
       lineAtlas(std::make_unique<LineAtlas>(Size{ 256, 512 })),
       imageImpls(makeMutable<std::vector<Immutable<style::Image::Impl>>>()),
@@ -86,6 +86,10 @@ void RenderStyle::update(const UpdateParameters& parameters) {
 
     const bool zoomChanged = zoomHistory.update(parameters.transformState.getZoom(), parameters.timePoint);
 
+    bool changed = imageImpls.get() != parameters.images.get() ||
+                   sourceImpls.get() != parameters.sources.get() ||
+                   layerImpls.get() != parameters.layers.get();
+
     const TransitionParameters transitionParameters {
         parameters.timePoint,
         parameters.mode == MapMode::Continuous ? parameters.transitionOptions : TransitionOptions()
@@ -107,7 +111,10 @@ void RenderStyle::update(const UpdateParameters& parameters) {
         parameters.annotationManager,
         *imageManager,
         *glyphManager,
-        parameters.prefetchZoomDelta
+        parameters.prefetchZoomDelta,
+        parameters.prefetchStates,
+        parameters.prefetchTileBudget,
+        rasterTextureFormat
     };
 
     glyphManager->setURL(parameters.glyphURL);
@@ -122,6 +129,7 @@ void RenderStyle::update(const UpdateParameters& parameters) {
 
     if (lightChanged || zoomChanged || renderLight.hasTransition()) {
         renderLight.evaluate(evaluationParameters);
+        changed = true;
     }
 
 
@@ -145,6 +153,7 @@ void RenderStyle::update(const UpdateParameters& parameters) {
 
     if (parameters.spriteLoaded && !imageManager->isLoaded()) {
         imageManager->onSpriteLoaded();
+        changed = true;
     }
 
 
@@ -167,6 +176,7 @@ void RenderStyle::update(const UpdateParameters& parameters) {
     }
 
     // Update layers for class and zoom changes.
+    evaluatedLayerCount = 0;
     for (const auto& entry : renderLayers) {
         RenderLayer& layer = *entry.second;
         const bool layerAdded = layerDiff.added.count(entry.first);
@@ -176,11 +186,16 @@ void RenderStyle::update(const UpdateParameters& parameters) {
             layer.transition(transitionParameters);
         }
 
-        if (layerAdded || layerChanged || zoomChanged || layer.hasTransition()) {
+        if (layerAdded || layerChanged || (zoomChanged && layer.isZoomDependent()) || layer.hasTransition()) {
             layer.evaluate(evaluationParameters);
+            evaluatedLayerCount++;
         }
     }
 
+    if (changed || evaluatedLayerCount > 0) {
+        epoch++;
+    }
+
 
     const SourceDifference sourceDiff = diffSources(sourceImpls, parameters.sources);
     sourceImpls = parameters.sources;
@@ -436,11 +451,30 @@ void RenderStyle::onTileError(RenderSource& source, const OverscaledTileID& tile
     observer->onResourceError(error);
 }
 
-void RenderStyle::onTileChanged(RenderSource&, const OverscaledTileID&) {
+void RenderStyle::onTileChanged(RenderSource& source, const OverscaledTileID& tileID) {
+    // Tiles that aren't rendered yet only show up once they are, which changes the render tiles.
+    for (const RenderTile& renderTile : source.getRenderTiles()) {
+        if (renderTile.tile.id == tileID) {
+            epoch++;
+            break;
+        }
+    }
+
     observer->onInvalidate();
 }
 
+std::size_t RenderStyle::getEvaluatedLayerCount() const {
+    return evaluatedLayerCount;
+}
+
+uint64_t RenderStyle::getEpoch() const {
+    return epoch;
+}
+
 void RenderStyle::dumpDebugLogs() const {
+    Log::Info(Event::General, "RenderStyle::evaluatedLayerCount: %zu of %zu",
+              evaluatedLayerCount, renderLayers.size());
+
     for (const auto& entry : renderSources) {
         entry.second->dumpDebugLogs();
     }
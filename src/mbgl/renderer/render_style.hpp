@@ -8,6 +8,7 @@
 #include <mbgl/text/glyph_manager_observer.hpp>
 #include <mbgl/map/zoom_history.hpp>
 #include <mbgl/map/mode.hpp>
+#include <mbgl/util/optional.hpp>
 
 #include <memory>
 #include <string>
@@ -35,7 +36,7 @@ class Layer;
 class RenderStyle : public GlyphManagerObserver,
                     public RenderSourceObserver {
 public:
-    RenderStyle(Scheduler&, FileSource&);
+    RenderStyle(Scheduler&, FileSource&, const optional<std::string>& decodedCacheDir = {});
     ~RenderStyle() final;
 
     void setObserver(RenderStyleObserver*);
@@ -61,6 +62,14 @@ public:
 
     void onLowMemory();
 
+    // The number of layers whose paint properties were evaluated by the last update, for profiling.
+    std::size_t getEvaluatedLayerCount() const;
+
+    // Changes whenever layers, sources, images, the light or the contents of rendered tiles change
+    // what the style renders. Together with the camera and the render tiles, this determines what
+    // a frame looks like.
+    uint64_t getEpoch() const;
+
     void dumpDebugLogs() const;
 
     Scheduler& scheduler;
@@ -69,6 +78,9 @@ public:
     std::unique_ptr<ImageManager> imageManager;
     std::unique_ptr<LineAtlas> lineAtlas;
 
+    // Texture format of opaque raster tiles parsed from now on, as supported by the context.
+    RasterTextureFormat rasterTextureFormat = RasterTextureFormat::RGBA;
+
 private:
     Immutable<std::vector<Immutable<style::Image::Impl>>> imageImpls;
     Immutable<std::vector<Immutable<style::Source::Impl>>> sourceImpls;
@@ -87,6 +99,8 @@ private:
 
     RenderStyleObserver* observer;
     ZoomHistory zoomHistory;
+    std::size_t evaluatedLayerCount = 0;
+    uint64_t epoch = 0;
 };
 
 } // namespace mbgl
@@ -75,7 +75,7 @@ void RenderTile::finishRender(PaintParameters& parameters) {
             parameters.context,
             drawMode,
             gl::DepthMode::disabled(),
-            parameters.stencilModeForClipping(clip),
+            parameters.stencilModeForClipping(*this),
             gl::ColorMode::unblended(),
             DebugProgram::UniformValues {
                 uniforms::u_matrix::Value{ matrix },
@@ -10,9 +10,12 @@ Renderer::Renderer(RendererBackend& backend,
                    FileSource& fileSource_,
                    Scheduler& scheduler_,
                    GLContextMode contextMode_,
-                   const optional<std::string> programCacheDir_)
+                   const optional<std::string> programCacheDir_,
+                   const optional<std::string> decodedCacheDir_,
+                   RasterTextureFormat rasterTextureFormat_)
         : impl(std::make_unique<Impl>(backend, pixelRatio_, fileSource_, scheduler_,
-                                      contextMode_, std::move(programCacheDir_))) {
+                                      contextMode_, std::move(programCacheDir_),
+                                      std::move(decodedCacheDir_), rasterTextureFormat_)) {
 }
 
 Renderer::~Renderer() = default;
@@ -71,6 +74,10 @@ void Renderer::dumpDebugLogs() {
     impl->dumDebugLogs();
 }
 
+std::size_t Renderer::getSkippedFrameCount() const {
+    return impl->skippedFrameCount;
+}
+
 void Renderer::onLowMemory() {
     impl->onLowMemory();
 }
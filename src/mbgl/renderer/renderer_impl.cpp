@@ -6,9 +6,12 @@
 #include <mbgl/renderer/paint_parameters.hpp>
 #include <mbgl/renderer/backend_scope.hpp>
 #include <mbgl/renderer/image_manager.hpp>
+#include <mbgl/renderer/layers/render_custom_layer.hpp>
 #include <mbgl/gl/debugging.hpp>
 #include <mbgl/geometry/line_atlas.hpp>
 
+#include <algorithm>
+
 namespace mbgl {
 
 using namespace style;
@@ -23,13 +26,16 @@ Renderer::Impl::Impl(RendererBackend& backend_,
                      FileSource& fileSource_,
                      Scheduler& scheduler_,
                      GLContextMode contextMode_,
-                     const optional<std::string> programCacheDir_)
+                     const optional<std::string> programCacheDir_,
+                     const optional<std::string> decodedCacheDir_,
+                     RasterTextureFormat rasterTextureFormat_)
         : backend(backend_)
         , observer(&nullObserver())
         , contextMode(contextMode_)
         , pixelRatio(pixelRatio_)
         , programCacheDir(programCacheDir_)
-        , renderStyle(std::make_unique<RenderStyle>(scheduler_, fileSource_)) {
+        , rasterTextureFormat(rasterTextureFormat_)
+        , renderStyle(std::make_unique<RenderStyle>(scheduler_, fileSource_, decodedCacheDir_)) {
 
     renderStyle->setObserver(this);
 }
@@ -46,10 +52,16 @@ void Renderer::Impl::setObserver(RendererObserver* observer_) {
 
 void Renderer::Impl::render(View& view, const UpdateParameters& updateParameters) {
     // Don't load/render anyting in still mode until explicitly requested.
-    if (updateParameters.mode == MapMode::Still && !updateParameters.stillImageRequest) return;
+    if (updateParameters.mode != MapMode::Continuous && !updateParameters.stillImageRequest) return;
 
     BackendScope guard { backend, backend.getScopeType() };
 
+    // Block-compressed textures need an extension; other contexts get RGB565 textures instead.
+    const bool compressible = backend.getContext().supportsCompressedTextureFormat(gl::CompressedTextureFormat::RGB_S3TC_DXT1);
+    renderStyle->rasterTextureFormat = rasterTextureFormat == RasterTextureFormat::DXT1 && !compressible
+        ? RasterTextureFormat::RGB565
+        : rasterTextureFormat;
+
     renderStyle->update(updateParameters);
     transformState = updateParameters.transformState;
 
@@ -65,7 +77,8 @@ void Renderer::Impl::render(View& view, const UpdateParameters& updateParameters
         updateParameters,
         *renderStyle,
         *staticData,
-        frameHistory
+        frameHistory,
+        clipIDGenerator
     };
 
     bool loaded = updateParameters.styleLoaded && renderStyle->isLoaded();
@@ -118,9 +131,32 @@ void Renderer::Impl::doRender(PaintParameters& parameters) {
     const std::vector<RenderItem>& order = renderData.order;
     const std::unordered_set<RenderSource*>& sources = renderData.sources;
 
-    frameHistory.record(parameters.timePoint,
-                        parameters.state.getZoom(),
-                        parameters.mapMode == MapMode::Continuous ? util::DEFAULT_TRANSITION_DURATION : Milliseconds(0));
+    const Duration fadeDuration = parameters.mapMode == MapMode::Continuous
+        ? util::DEFAULT_TRANSITION_DURATION
+        : Milliseconds(0);
+
+    // Skip drawing when the view still shows a frame drawn from the same inputs. Custom layers,
+    // debug overlays and contexts shared with other renderers can change it in ways we can't tell.
+    const bool reusable = parameters.view.preservesContents() &&
+        parameters.contextMode == GLContextMode::Unique &&
+        parameters.debugOptions == MapDebugOptions::NoDebug &&
+        !renderStyle->hasTransitions() &&
+        !frameHistory.needsAnimation(fadeDuration) &&
+        std::none_of(order.begin(), order.end(), [](const RenderItem& item) {
+            return item.layer.is<RenderCustomLayer>();
+        });
+
+    optional<FrameFingerprint> fingerprint;
+    if (reusable) {
+        fingerprint.emplace(parameters, renderData, renderStyle->getEpoch());
+        if (lastFrame && *lastFrame == *fingerprint) {
+            skippedFrameCount++;
+            return;
+        }
+    }
+    lastFrame = std::move(fingerprint);
+
+    frameHistory.record(parameters.timePoint, parameters.state.getZoom(), fadeDuration);
 
     // - UPLOAD PASS -------------------------------------------------------------------------------
     // Uploads all required buffers and images before we do any actual rendering.
@@ -151,41 +187,57 @@ void Renderer::Impl::doRender(PaintParameters& parameters) {
         MBGL_DEBUG_GROUP(parameters.context, "clip");
 
         // Update all clipping IDs.
+        parameters.clipIDGenerator.reset();
         for (const auto& source : sources) {
             source->startRender(parameters);
         }
 
-        MBGL_DEBUG_GROUP(parameters.context, "clipping masks");
-
-        static const style::FillPaintProperties::PossiblyEvaluated properties {};
-        static const FillProgram::PaintPropertyBinders paintAttibuteData(properties, 0);
-
-        for (const auto& clipID : parameters.clipIDGenerator.getClipIDs()) {
-            parameters.staticData.programs.fill.get(properties).draw(
-                parameters.context,
-                gl::Triangles(),
-                gl::DepthMode::disabled(),
-                gl::StencilMode {
-                    gl::StencilMode::Always(),
-                    static_cast<int32_t>(clipID.second.reference.to_ulong()),
-                    0b11111111,
-                    gl::StencilMode::Keep,
-                    gl::StencilMode::Keep,
-                    gl::StencilMode::Replace
-                },
-                gl::ColorMode::disabled(),
-                FillProgram::UniformValues {
-                    uniforms::u_matrix::Value{ parameters.matrixForTile(clipID.first) },
-                    uniforms::u_world::Value{ parameters.context.viewport.getCurrentValue().size },
-                },
-                parameters.staticData.tileVertexBuffer,
-                parameters.staticData.quadTriangleIndexBuffer,
-                parameters.staticData.tileTriangleSegments,
-                paintAttibuteData,
-                properties,
-                parameters.state.getZoom(),
-                "clipping"
-            );
+        // Tiles that don't overlap are clipped to their bounds with the scissor test instead,
+        // unless the view uses the scissor test itself.
+        parameters.stencilClipping = parameters.clipIDGenerator.hasOverlaps() ||
+                                     parameters.state.getAngle() != 0 ||
+                                     parameters.state.getPitch() != 0 ||
+                                     parameters.context.scissorTest.getCurrentValue();
+#if not MBGL_USE_GLES2 and not defined(NDEBUG)
+        if (parameters.debugOptions & MapDebugOptions::StencilClip) {
+            parameters.stencilClipping = true;
+        }
+#endif
+
+        if (parameters.stencilClipping) {
+            MBGL_DEBUG_GROUP(parameters.context, "clipping masks");
+
+            static const style::FillPaintProperties::PossiblyEvaluated properties {};
+            static const FillProgram::PaintPropertyBinders paintAttibuteData(properties, 0);
+
+            for (const auto& clipID : parameters.clipIDGenerator.getClipIDs()) {
+                parameters.staticData.programs.fill.get(properties).draw(
+                    parameters.context,
+                    gl::Triangles(),
+                    gl::DepthMode::disabled(),
+                    gl::StencilMode {
+                        gl::StencilMode::Always(),
+                        static_cast<int32_t>(clipID.second.reference.to_ulong()),
+                        0b11111111,
+                        gl::StencilMode::Keep,
+                        gl::StencilMode::Keep,
+                        gl::StencilMode::Replace,
+                        {}
+                    },
+                    gl::ColorMode::disabled(),
+                    FillProgram::UniformValues {
+                        uniforms::u_matrix::Value{ parameters.matrixForTile(clipID.first) },
+                        uniforms::u_world::Value{ parameters.context.viewport.getCurrentValue().size },
+                    },
+                    parameters.staticData.tileVertexBuffer,
+                    parameters.staticData.quadTriangleIndexBuffer,
+                    parameters.staticData.tileTriangleSegments,
+                    paintAttibuteData,
+                    properties,
+                    parameters.state.getZoom(),
+                    "clipping"
+                );
+            }
         }
     }
 
@@ -325,6 +377,9 @@ void Renderer::Impl::doRender(PaintParameters& parameters) {
         parameters.context.texture[0] = 0;
 
         parameters.context.bindVertexArray = 0;
+
+        // Hands the scissor test back to the view.
+        parameters.context.setStencilMode(gl::StencilMode::disabled());
     }
 }
 
@@ -355,6 +410,7 @@ void Renderer::Impl::onLowMemory() {
 }
 
 void Renderer::Impl::dumDebugLogs() {
+    Log::Info(Event::General, "Renderer::skippedFrameCount: %zu", skippedFrameCount);
     renderStyle->dumpDebugLogs();
 }
 
@@ -5,7 +5,9 @@
 #include <mbgl/renderer/renderer_observer.hpp>
 #include <mbgl/renderer/render_style_observer.hpp>
 #include <mbgl/renderer/frame_history.hpp>
+#include <mbgl/renderer/frame_fingerprint.hpp>
 #include <mbgl/map/transform_state.hpp>
+#include <mbgl/algorithm/generate_clip_ids.hpp>
 
 #include <memory>
 #include <string>
@@ -22,7 +24,9 @@ class RenderStaticData;
 class Renderer::Impl : public RenderStyleObserver {
 public:
     Impl(RendererBackend&, float pixelRatio_, FileSource&, Scheduler&, GLContextMode,
-         const optional<std::string> programCacheDir);
+         const optional<std::string> programCacheDir,
+         const optional<std::string> decodedCacheDir,
+         RasterTextureFormat);
     ~Impl() final;
 
     void setObserver(RendererObserver*);
@@ -50,6 +54,7 @@ private:
     const GLContextMode contextMode;
     const float pixelRatio;
     const optional<std::string> programCacheDir;
+    const RasterTextureFormat rasterTextureFormat;
 
     enum class RenderState {
         Never,
@@ -61,6 +66,13 @@ private:
     FrameHistory frameHistory;
     TransformState transformState;
 
+    // Kept across frames so that clip IDs are only generated again when render tiles change.
+    algorithm::ClipIDGenerator clipIDGenerator;
+
+    // The fingerprint of the frame the view still shows, if it keeps its contents.
+    optional<FrameFingerprint> lastFrame;
+    std::size_t skippedFrameCount = 0;
+
     std::unique_ptr<RenderStyle> renderStyle;
     std::unique_ptr<RenderStaticData> staticData;
 };
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <mbgl/map/mode.hpp>
+#include <mbgl/map/transform_state.hpp>
+
+#include <vector>
 
 namespace mbgl {
 
-class TransformState;
 class Scheduler;
 class FileSource;
 class AnnotationManager;
@@ -23,6 +25,9 @@ public:
     ImageManager& imageManager;
     GlyphManager& glyphManager;
     const uint8_t prefetchZoomDelta;
+    const std::vector<TransformState> prefetchStates;
+    const uint32_t prefetchTileBudget;
+    const RasterTextureFormat rasterTextureFormat;
 };
 
 } // namespace mbgl
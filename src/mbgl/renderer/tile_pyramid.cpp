@@ -16,6 +16,9 @@
 #include <mapbox/geometry/envelope.hpp>
 
 #include <algorithm>
+#include <functional>
+#include <map>
+#include <unordered_set>
 
 namespace mbgl {
 
@@ -86,33 +89,37 @@ void TilePyramid::update(const std::vector<Immutable<style::Layer::Impl>>& layer
     // Determine the overzooming/underzooming amounts and required tiles.
     int32_t overscaledZoom = util::coveringZoomLevel(parameters.transformState.getZoom(), type, tileSize);
     int32_t tileZoom = overscaledZoom;
+    int32_t idealZoom = overscaledZoom;
     int32_t panZoom = zoomRange.max;
 
     std::vector<UnwrappedTileID> idealTiles;
     std::vector<UnwrappedTileID> panTiles;
 
     if (overscaledZoom >= zoomRange.min) {
-        int32_t idealZoom = std::min<int32_t>(zoomRange.max, overscaledZoom);
+        idealZoom = std::min<int32_t>(zoomRange.max, overscaledZoom);
 
         // Make sure we're not reparsing overzoomed raster tiles.
         if (type == SourceType::Raster) {
             tileZoom = idealZoom;
+        }
 
-            // FIXME: Prefetching is only enabled for raster
-            // tiles until we fix #7026.
-
-            // Request lower zoom level tiles (if configure to do so) in an attempt
-            // to show something on the screen faster at the cost of a little of bandwidth.
+        // Request lower zoom level tiles (if configure to do so) in an attempt
+        // to show something on the screen faster at the cost of a little of bandwidth.
+        // Still images only show ideal tiles, so there, lower zoom level vector tiles
+        // would only be parsed to be thrown away.
+        if (type == SourceType::Raster ||
+            (type == SourceType::Vector && parameters.mode == MapMode::Continuous)) {
             if (parameters.prefetchZoomDelta) {
-                panZoom = std::max<int32_t>(tileZoom - parameters.prefetchZoomDelta, zoomRange.min);
+                panZoom = std::max<int32_t>(idealZoom - parameters.prefetchZoomDelta, zoomRange.min);
             }
 
-            if (panZoom < tileZoom) {
+            if (panZoom < idealZoom) {
                 panTiles = util::tileCover(parameters.transformState, panZoom);
             }
         }
 
-        idealTiles = util::tileCover(parameters.transformState, idealZoom);
+        // Pitched views use lower zoom levels for tiles far from the camera.
+        idealTiles = util::tileCover(parameters.transformState, idealZoom, zoomRange.min);
     }
 
     // Stores a list of all the tiles that we're definitely going to retain. There are two
@@ -121,11 +128,21 @@ void TilePyramid::update(const std::vector<Immutable<style::Layer::Impl>>& layer
     // we're actively using, e.g. as a replacement for tile that aren't loaded yet.
     std::set<OverscaledTileID> retain;
 
+    // Tiles retained for the ideal tile cover, as opposed to those only retained for prefetching.
+    std::set<OverscaledTileID> visible;
+    bool retainingVisible = false;
+
     auto retainTileFn = [&](Tile& tile, Resource::Necessity necessity) -> void {
         if (retain.emplace(tile.id).second) {
+            // Set the priority first, so that a new network request is queued accordingly.
+            tile.setPriority(retainingVisible ? Resource::Regular : Resource::Low);
             tile.setNecessity(necessity);
         }
 
+        if (retainingVisible) {
+            visible.emplace(tile.id);
+        }
+
         if (needsRelayout) {
             tile.setLayers(layers);
         }
@@ -159,8 +176,52 @@ void TilePyramid::update(const std::vector<Immutable<style::Layer::Impl>>& layer
                 [](const UnwrappedTileID&, Tile&) {}, panTiles, zoomRange, panZoom);
     }
 
-    algorithm::updateRenderables(getTileFn, createTileFn, retainTileFn, renderTileFn,
-                                 idealTiles, zoomRange, tileZoom);
+    // Load the ideal tiles of upcoming still images along with the current ones, so that the
+    // whole batch waits for its tiles only once and shared tiles are kept between images.
+    // During camera animations, this loads the tiles at the destination and along the way,
+    // so that they're parsed by the time the camera arrives.
+    uint32_t prefetchBudget = parameters.prefetchTileBudget;
+    for (const auto& state : parameters.prefetchStates) {
+        const int32_t prefetchOverscaledZoom = util::coveringZoomLevel(state.getZoom(), type, tileSize);
+        if (prefetchOverscaledZoom < zoomRange.min) {
+            continue;
+        }
+        const int32_t prefetchIdealZoom = std::min<int32_t>(zoomRange.max, prefetchOverscaledZoom);
+        const int32_t prefetchTileZoom = type == SourceType::Raster ? prefetchIdealZoom : prefetchOverscaledZoom;
+        for (const auto& tileID : util::tileCover(state, prefetchIdealZoom)) {
+            const OverscaledTileID dataTileID(prefetchTileZoom, tileID.wrap, tileID.canonical);
+            if (retain.count(dataTileID)) {
+                continue;
+            }
+            if (prefetchBudget == 0) {
+                break;
+            }
+            Tile* tile = getTileFn(dataTileID);
+            if (!tile) {
+                tile = createTileFn(dataTileID);
+            }
+            if (tile) {
+                retainTileFn(*tile, Resource::Necessity::Required);
+                prefetchBudget--;
+            }
+        }
+    }
+
+    // Ideal tiles at lower zoom levels are overscaled as much as those at the ideal zoom level,
+    // since they are drawn proportionally smaller. Parents are shared between the zoom levels, so
+    // that one replacing ideal tiles of several of them is only rendered once.
+    std::map<int32_t, std::vector<UnwrappedTileID>, std::greater<int32_t>> idealTilesByZoom;
+    for (const auto& tileID : idealTiles) {
+        idealTilesByZoom[tileID.canonical.z].push_back(tileID);
+    }
+
+    retainingVisible = true;
+    std::unordered_set<UnwrappedTileID> checked;
+    for (const auto& entry : idealTilesByZoom) {
+        algorithm::updateRenderables(getTileFn, createTileFn, retainTileFn, renderTileFn,
+                                     entry.second, zoomRange, tileZoom - (idealZoom - entry.first),
+                                     checked);
+    }
 
     if (type != SourceType::Annotations) {
         size_t conservativeCacheSize =
@@ -181,6 +242,7 @@ void TilePyramid::update(const std::vector<Immutable<style::Layer::Impl>>& layer
                                        parameters.debugOptions & MapDebugOptions::Collision };
 
         pair.second->setPlacementConfig(config);
+        pair.second->setPriority(visible.count(pair.first) ? Resource::Regular : Resource::Low);
     }
 }
 
@@ -42,6 +42,12 @@ public:
     
     // For still image requests, render requested
     const bool stillImageRequest;
+
+    // Camera states of still images that are going to be rendered after this one, or of the
+    // path of the current camera animation. Their tiles are loaded alongside the current ones,
+    // up to the given number of tiles per source.
+    const std::vector<TransformState> prefetchStates;
+    const uint32_t prefetchTileBudget;
 };
 
 } // namespace mbgl
@@ -20,21 +20,24 @@ namespace mbgl {
 static SpriteLoaderObserver nullObserver;
 
 struct SpriteLoader::Loader {
-    Loader(Scheduler& scheduler, SpriteLoader& imageManager)
+    Loader(Scheduler& scheduler, SpriteLoader& imageManager, const optional<std::string>& decodedCacheDir)
         : mailbox(std::make_shared<Mailbox>(*util::RunLoop::Get())),
-          worker(scheduler, ActorRef<SpriteLoader>(imageManager, mailbox)) {
+          worker(scheduler, ActorRef<SpriteLoader>(imageManager, mailbox), decodedCacheDir) {
     }
 
     std::shared_ptr<const std::string> image;
     std::shared_ptr<const std::string> json;
+    std::string imageURL;
+    optional<std::string> imageETag;
     std::unique_ptr<AsyncRequest> jsonRequest;
     std::unique_ptr<AsyncRequest> spriteRequest;
     std::shared_ptr<Mailbox> mailbox;
     Actor<SpriteLoaderWorker> worker;
 };
 
-SpriteLoader::SpriteLoader(float pixelRatio_)
+SpriteLoader::SpriteLoader(float pixelRatio_, optional<std::string> decodedCacheDir_)
         : pixelRatio(pixelRatio_)
+        , decodedCacheDir(std::move(decodedCacheDir_))
         , observer(&nullObserver) {
 }
 
@@ -47,7 +50,7 @@ void SpriteLoader::load(const std::string& url, Scheduler& scheduler, FileSource
         return;
     }
 
-    loader = std::make_unique<Loader>(scheduler, *this);
+    loader = std::make_unique<Loader>(scheduler, *this, decodedCacheDir);
 
     loader->jsonRequest = fileSource.request(Resource::spriteJSON(url, pixelRatio), [this](Response res) {
         if (res.error) {
@@ -64,16 +67,20 @@ void SpriteLoader::load(const std::string& url, Scheduler& scheduler, FileSource
         }
     });
 
-    loader->spriteRequest = fileSource.request(Resource::spriteImage(url, pixelRatio), [this](Response res) {
+    const Resource imageResource = Resource::spriteImage(url, pixelRatio);
+    loader->imageURL = imageResource.url;
+    loader->spriteRequest = fileSource.request(imageResource, [this](Response res) {
         if (res.error) {
             observer->onSpriteError(std::make_exception_ptr(std::runtime_error(res.error->message)));
         } else if (res.notModified) {
             return;
         } else if (res.noContent) {
             loader->image = std::make_shared<const std::string>();
+            loader->imageETag = {};
             emitSpriteLoadedIfComplete();
         } else {
             loader->image = res.data;
+            loader->imageETag = res.etag;
             emitSpriteLoadedIfComplete();
         }
     });
@@ -86,7 +93,8 @@ void SpriteLoader::emitSpriteLoadedIfComplete() {
         return;
     }
 
-    loader->worker.invoke(&SpriteLoaderWorker::parse, loader->image, loader->json);
+    loader->worker.invoke(&SpriteLoaderWorker::parse, loader->image, loader->json,
+                          loader->imageURL, loader->imageETag);
 }
 
 void SpriteLoader::onParsed(std::vector<std::unique_ptr<style::Image>>&& result) {
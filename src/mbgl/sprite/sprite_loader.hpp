@@ -2,6 +2,7 @@
 
 #include <mbgl/util/noncopyable.hpp>
 #include <mbgl/style/image.hpp>
+#include <mbgl/util/optional.hpp>
 
 #include <string>
 #include <map>
@@ -18,7 +19,7 @@ class SpriteLoaderObserver;
 
 class SpriteLoader : public util::noncopyable {
 public:
-    SpriteLoader(float pixelRatio);
+    SpriteLoader(float pixelRatio, optional<std::string> decodedCacheDir = {});
     ~SpriteLoader();
 
     void load(const std::string& url, Scheduler&, FileSource&);
@@ -34,6 +35,7 @@ private:
     void onError(std::exception_ptr);
 
     const float pixelRatio;
+    const optional<std::string> decodedCacheDir;
 
     struct Loader;
     std::unique_ptr<Loader> loader;
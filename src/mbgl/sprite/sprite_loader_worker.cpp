@@ -1,15 +1,22 @@
 #include <mbgl/sprite/sprite_loader_worker.hpp>
 #include <mbgl/sprite/sprite_loader.hpp>
 #include <mbgl/sprite/sprite_parser.hpp>
+#include <mbgl/storage/decoded_cache.hpp>
 
 namespace mbgl {
 
-SpriteLoaderWorker::SpriteLoaderWorker(ActorRef<SpriteLoaderWorker>, ActorRef<SpriteLoader> parent_)
-    : parent(std::move(parent_)) {
+SpriteLoaderWorker::SpriteLoaderWorker(ActorRef<SpriteLoaderWorker>, ActorRef<SpriteLoader> parent_,
+                                       const optional<std::string>& decodedCacheDir)
+    : parent(std::move(parent_)),
+      decodedCache(decodedCacheDir ? std::make_unique<DecodedCache>(*decodedCacheDir) : nullptr) {
 }
 
+SpriteLoaderWorker::~SpriteLoaderWorker() = default;
+
 void SpriteLoaderWorker::parse(std::shared_ptr<const std::string> image,
-                              std::shared_ptr<const std::string> json) {
+                               std::shared_ptr<const std::string> json,
+                               std::string imageURL,
+                               optional<std::string> imageETag) {
     try {
         if (!image) {
             // This shouldn't happen, since we always invoke it with a non-empty pointer.
@@ -20,7 +27,18 @@ void SpriteLoaderWorker::parse(std::shared_ptr<const std::string> image,
             throw std::runtime_error("missing sprite metadata");
         }
 
-        parent.invoke(&SpriteLoader::onParsed, parseSprite(*image, *json));
+        if (!decodedCache || !imageETag || image->empty()) {
+            parent.invoke(&SpriteLoader::onParsed, parseSprite(*image, *json));
+            return;
+        }
+
+        optional<PremultipliedImage> raster = decodedCache->getImage(imageURL, *imageETag);
+        if (!raster) {
+            raster = decodeImage(*image);
+            decodedCache->putImage(imageURL, *imageETag, *raster);
+        }
+
+        parent.invoke(&SpriteLoader::onParsed, parseSprite(*raster, *json));
     } catch (...) {
         parent.invoke(&SpriteLoader::onError, std::current_exception());
     }
@@ -2,6 +2,7 @@
 
 #include <mbgl/actor/actor_ref.hpp>
 #include <mbgl/sprite/sprite_parser.hpp>
+#include <mbgl/util/optional.hpp>
 
 #include <memory>
 #include <string>
@@ -9,15 +10,23 @@
 namespace mbgl {
 
 class SpriteLoader;
+class DecodedCache;
 
 class SpriteLoaderWorker {
 public:
-    SpriteLoaderWorker(ActorRef<SpriteLoaderWorker>, ActorRef<SpriteLoader>);
+    SpriteLoaderWorker(ActorRef<SpriteLoaderWorker>, ActorRef<SpriteLoader>, const optional<std::string>& decodedCacheDir);
+    ~SpriteLoaderWorker();
 
-    void parse(std::shared_ptr<const std::string> image, std::shared_ptr<const std::string> json);
+    void parse(std::shared_ptr<const std::string> image,
+               std::shared_ptr<const std::string> json,
+               std::string imageURL,
+               optional<std::string> imageETag);
 
 private:
     ActorRef<SpriteLoader> parent;
+
+    // Optional on-disk cache of decoded sprite sheets, keyed by image URL and ETag.
+    std::unique_ptr<DecodedCache> decodedCache;
 };
 
 } // namespace mbgl
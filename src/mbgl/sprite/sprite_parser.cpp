@@ -86,8 +86,10 @@ bool getBoolean(const JSValue& value, const char* name, const bool def = false)
 } // namespace
 
 std::vector<std::unique_ptr<style::Image>> parseSprite(const std::string& encodedImage, const std::string& json) {
-    const PremultipliedImage raster = decodeImage(encodedImage);
+    return parseSprite(decodeImage(encodedImage), json);
+}
 
+std::vector<std::unique_ptr<style::Image>> parseSprite(const PremultipliedImage& raster, const std::string& json) {
     JSDocument doc;
     doc.Parse<0>(json.c_str());
     if (doc.HasParseError()) {
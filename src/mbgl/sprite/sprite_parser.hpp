@@ -25,4 +25,7 @@ std::unique_ptr<style::Image> createStyleImage(const std::string& id,
 // Parses an image and an associated JSON file and returns the sprite objects.
 std::vector<std::unique_ptr<style::Image>> parseSprite(const std::string& image, const std::string& json);
 
+// Same as above, but for a sprite sheet that has already been decoded.
+std::vector<std::unique_ptr<style::Image>> parseSprite(const PremultipliedImage&, const std::string& json);
+
 } // namespace mbgl
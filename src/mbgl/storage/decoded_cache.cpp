@@ -0,0 +1,227 @@
+#include <mbgl/storage/decoded_cache.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/logging.hpp>
+#include <mbgl/util/string.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <thread>
+
+namespace mbgl {
+
+namespace {
+
+// Bump the version whenever the layout below changes; files with a different version are ignored
+// and overwritten on the next miss.
+const uint32_t magic = 0x4344424D; // "MBDC"
+const uint32_t version = 1;
+
+enum class Kind : uint32_t {
+    Glyphs = 1,
+    Image = 2,
+};
+
+// Bounds-checked sequential reader over the contents of a file.
+class Reader {
+public:
+    Reader(const uint8_t* data_, std::size_t size_) : data(data_), size(size_) {}
+
+    template <class T>
+    T read() {
+        T value;
+        std::memcpy(&value, bytes(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    const uint8_t* bytes(std::size_t length) {
+        if (length > size - offset) {
+            throw std::runtime_error("truncated decoded cache entry");
+        }
+        const uint8_t* result = data + offset;
+        offset += length;
+        return result;
+    }
+
+    bool done() const {
+        return offset == size;
+    }
+
+private:
+    const uint8_t* data;
+    const std::size_t size;
+    std::size_t offset = 0;
+};
+
+class Writer {
+public:
+    template <class T>
+    void write(T value) {
+        bytes(reinterpret_cast<const uint8_t*>(&value), sizeof(T));
+    }
+
+    void bytes(const uint8_t* src, std::size_t length) {
+        data.append(reinterpret_cast<const char*>(src), length);
+    }
+
+    std::string data;
+};
+
+std::string cacheKey(const std::string& url, const std::string& etag) {
+    return url + '\n' + etag;
+}
+
+void writeHeader(Writer& writer, Kind kind, const std::string& key) {
+    writer.write<uint32_t>(magic);
+    writer.write<uint32_t>(version);
+    writer.write<uint32_t>(uint32_t(kind));
+    writer.write<uint32_t>(key.size());
+    writer.bytes(reinterpret_cast<const uint8_t*>(key.data()), key.size());
+}
+
+// Returns false if the entry was written by an incompatible version, or if it belongs to a
+// different key that happens to hash to the same file name.
+bool readHeader(Reader& reader, Kind kind, const std::string& key) {
+    if (reader.read<uint32_t>() != magic || reader.read<uint32_t>() != version ||
+        reader.read<uint32_t>() != uint32_t(kind)) {
+        return false;
+    }
+    const auto keyLength = reader.read<uint32_t>();
+    const uint8_t* keyData = reader.bytes(keyLength);
+    return keyLength == key.size() && std::memcmp(keyData, key.data(), keyLength) == 0;
+}
+
+// Writes to a temporary file first so that concurrent processes never observe a partial entry.
+void writeAtomically(const std::string& path, const std::string& data) {
+    std::ostringstream tmp;
+    tmp << path << ".tmp." << std::random_device()() << "." << std::hash<std::thread::id>()(std::this_thread::get_id());
+    try {
+        util::write_file(tmp.str(), data);
+        if (std::rename(tmp.str().c_str(), path.c_str()) != 0) {
+            std::remove(tmp.str().c_str());
+            Log::Warning(Event::Database, "Failed to store decoded cache entry: %s", path.c_str());
+        }
+    } catch (...) {
+        Log::Warning(Event::Database, "Failed to store decoded cache entry: %s",
+                     util::toString(std::current_exception()).c_str());
+    }
+}
+
+} // namespace
+
+DecodedCache::DecodedCache(std::string directory_)
+    : directory(std::move(directory_)) {
+}
+
+std::string DecodedCache::path(const char* kind, const std::string& key) const {
+    std::ostringstream ss;
+    ss << directory << "/com.mapbox.gl." << kind << "." << std::setfill('0')
+       << std::setw(sizeof(size_t) * 2) << std::hex << std::hash<std::string>()(key) << ".bin";
+    return ss.str();
+}
+
+optional<std::vector<Glyph>> DecodedCache::getGlyphs(const std::string& url, const std::string& etag) const {
+    const std::string key = cacheKey(url, etag);
+    const optional<std::string> file = util::readFile(path("glyphs", key));
+    if (!file) {
+        return {};
+    }
+
+    try {
+        Reader reader(reinterpret_cast<const uint8_t*>(file->data()), file->size());
+        if (!readHeader(reader, Kind::Glyphs, key)) {
+            return {};
+        }
+
+        const auto count = reader.read<uint32_t>();
+        std::vector<Glyph> glyphs(count);
+        for (auto& glyph : glyphs) {
+            glyph.id = reader.read<uint32_t>();
+            glyph.metrics.width = reader.read<uint32_t>();
+            glyph.metrics.height = reader.read<uint32_t>();
+            glyph.metrics.left = reader.read<int32_t>();
+            glyph.metrics.top = reader.read<int32_t>();
+            glyph.metrics.advance = reader.read<uint32_t>();
+            const Size size { reader.read<uint32_t>(), reader.read<uint32_t>() };
+            if (!size.isEmpty()) {
+                glyph.bitmap = AlphaImage(size, reader.bytes(size.area()), size.area());
+            }
+        }
+
+        if (!reader.done()) {
+            return {};
+        }
+        return std::move(glyphs);
+    } catch (...) {
+        // A corrupted or truncated entry is treated as a miss and is overwritten on the next store.
+        return {};
+    }
+}
+
+void DecodedCache::putGlyphs(const std::string& url, const std::string& etag, const std::vector<Glyph>& glyphs) const {
+    const std::string key = cacheKey(url, etag);
+
+    Writer writer;
+    writeHeader(writer, Kind::Glyphs, key);
+    writer.write<uint32_t>(glyphs.size());
+    for (const auto& glyph : glyphs) {
+        writer.write<uint32_t>(glyph.id);
+        writer.write<uint32_t>(glyph.metrics.width);
+        writer.write<uint32_t>(glyph.metrics.height);
+        writer.write<int32_t>(glyph.metrics.left);
+        writer.write<int32_t>(glyph.metrics.top);
+        writer.write<uint32_t>(glyph.metrics.advance);
+        writer.write<uint32_t>(glyph.bitmap.size.width);
+        writer.write<uint32_t>(glyph.bitmap.size.height);
+        if (glyph.bitmap.valid()) {
+            writer.bytes(glyph.bitmap.data.get(), glyph.bitmap.bytes());
+        }
+    }
+
+    writeAtomically(path("glyphs", key), writer.data);
+}
+
+optional<PremultipliedImage> DecodedCache::getImage(const std::string& url, const std::string& etag) const {
+    const std::string key = cacheKey(url, etag);
+    const optional<std::string> file = util::readFile(path("image", key));
+    if (!file) {
+        return {};
+    }
+
+    try {
+        Reader reader(reinterpret_cast<const uint8_t*>(file->data()), file->size());
+        if (!readHeader(reader, Kind::Image, key)) {
+            return {};
+        }
+
+        const Size size { reader.read<uint32_t>(), reader.read<uint32_t>() };
+        const std::size_t length = std::size_t(size.area()) * 4;
+        PremultipliedImage image(size, reader.bytes(length), length);
+
+        if (!reader.done()) {
+            return {};
+        }
+        return std::move(image);
+    } catch (...) {
+        return {};
+    }
+}
+
+void DecodedCache::putImage(const std::string& url, const std::string& etag, const PremultipliedImage& image) const {
+    const std::string key = cacheKey(url, etag);
+
+    Writer writer;
+    writeHeader(writer, Kind::Image, key);
+    writer.write<uint32_t>(image.size.width);
+    writer.write<uint32_t>(image.size.height);
+    if (image.valid()) {
+        writer.bytes(image.data.get(), image.bytes());
+    }
+
+    writeAtomically(path("image", key), writer.data);
+}
+
+} // namespace mbgl
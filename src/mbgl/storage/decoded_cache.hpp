@@ -0,0 +1,34 @@
+#pragma once
+
+#include <mbgl/text/glyph.hpp>
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/optional.hpp>
+
+#include <string>
+#include <vector>
+
+namespace mbgl {
+
+// Persistent cache of decoded glyph SDF bitmaps and premultiplied sprite sheets. Entries are
+// stored as flat, uncompressed files keyed by resource URL and ETag, and are copied straight
+// into glyphs and images on load, which lets a fresh process skip protobuf parsing and image
+// decoding entirely. Responses
+// without an ETag are never cached, since there would be no way of telling whether a cached
+// entry is stale.
+class DecodedCache {
+public:
+    explicit DecodedCache(std::string directory);
+
+    optional<std::vector<Glyph>> getGlyphs(const std::string& url, const std::string& etag) const;
+    void putGlyphs(const std::string& url, const std::string& etag, const std::vector<Glyph>&) const;
+
+    optional<PremultipliedImage> getImage(const std::string& url, const std::string& etag) const;
+    void putImage(const std::string& url, const std::string& etag, const PremultipliedImage&) const;
+
+private:
+    std::string path(const char* kind, const std::string& key) const;
+
+    const std::string directory;
+};
+
+} // namespace mbgl
@@ -17,13 +17,17 @@ public:
     ~FileSourceRequest() final;
 
     void onCancel(std::function<void()>&& callback);
+    void onSetPriority(std::function<void(Resource::Priority)>&& callback);
     void setResponse(const Response& res);
 
+    void setPriority(Resource::Priority) final;
+
     ActorRef<FileSourceRequest> actor();
 
 private:
     FileSource::Callback responseCallback = nullptr;
     std::function<void()> cancelCallback = nullptr;
+    std::function<void(Resource::Priority)> priorityCallback = nullptr;
 
     std::shared_ptr<Mailbox> mailbox;
 };
@@ -1,15 +1,661 @@
 #include <mbgl/style/conversion/geojson.hpp>
 #include <mbgl/style/conversion/json.hpp>
+#include <mbgl/util/feature.hpp>
+#include <mbgl/util/geometry.hpp>
 #include <mbgl/util/rapidjson.hpp>
 
 #include <mapbox/geojson.hpp>
 #include <mapbox/geojson/rapidjson.hpp>
 
+#include <rapidjson/reader.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
 namespace mbgl {
 namespace style {
 namespace conversion {
 
+namespace {
+
+// Converts GeoJSON while it is being read, without building a document first. Large GeoJSON
+// documents consist almost entirely of coordinates, and allocating a document node for every
+// single number of them takes longer than the rest of the conversion.
+//
+// This only handles well-formed GeoJSON, and stops reading at anything it doesn't expect. The
+// caller then converts the document the regular way, which produces the same result or error
+// message as it always has.
+class GeoJSONReader {
+public:
+    optional<GeoJSON> result;
+
+    bool Null() {
+        if (frames.empty()) {
+            return false;
+        }
+        switch (frames.back()) {
+        case Frame::Object:
+            // Features may have null properties.
+            return member(Member::Properties) || member(Member::Skip);
+        case Frame::Property:
+            return addProperty(NullValue());
+        case Frame::Skip:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool Bool(bool value) {
+        if (frames.empty()) {
+            return false;
+        }
+        switch (frames.back()) {
+        case Frame::Object:
+            return member(Member::Skip);
+        case Frame::Property:
+            return addProperty(value);
+        case Frame::Skip:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool Int(int value) {
+        return value >= 0 ? number(uint64_t(value)) : number(int64_t(value));
+    }
+
+    bool Uint(unsigned value) {
+        return number(uint64_t(value));
+    }
+
+    bool Int64(int64_t value) {
+        return value >= 0 ? number(uint64_t(value)) : number(value);
+    }
+
+    bool Uint64(uint64_t value) {
+        return number(value);
+    }
+
+    bool Double(double value) {
+        return number(value);
+    }
+
+    bool RawNumber(const char*, rapidjson::SizeType, bool) {
+        return false;
+    }
+
+    bool String(const char* str, rapidjson::SizeType length, bool) {
+        if (frames.empty()) {
+            return false;
+        }
+        switch (frames.back()) {
+        case Frame::Object: {
+            Object& object = objects.back();
+            if (object.member == Member::Type) {
+                object.type.assign(str, length);
+            } else if (object.member == Member::ID) {
+                object.id = FeatureIdentifier(std::string(str, length));
+            } else if (object.member != Member::Skip) {
+                return false;
+            }
+            object.member = Member::None;
+            return true;
+        }
+        case Frame::Property:
+            return addProperty(std::string(str, length));
+        case Frame::Skip:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool StartObject() {
+        if (frames.empty()) {
+            return startObject(Role::Root);
+        }
+        switch (frames.back()) {
+        case Frame::Object:
+            switch (objects.back().member) {
+            case Member::Geometry:
+                return startObject(Role::Geometry);
+            case Member::Properties:
+                return startProperties(true);
+            case Member::Skip:
+                frames.push_back(Frame::Skip);
+                return true;
+            default:
+                return false;
+            }
+        case Frame::Features:
+            return startObject(Role::Feature);
+        case Frame::Geometries:
+            return startObject(Role::Geometry);
+        case Frame::Property:
+            return startProperties(true);
+        case Frame::Skip:
+            frames.push_back(Frame::Skip);
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool Key(const char* str, rapidjson::SizeType length, bool) {
+        switch (frames.back()) {
+        case Frame::Object:
+            return key(objects.back(), std::string(str, length));
+        case Frame::Property:
+            properties.back().key.assign(str, length);
+            return true;
+        default:
+            return true;
+        }
+    }
+
+    bool EndObject(rapidjson::SizeType) {
+        switch (frames.back()) {
+        case Frame::Object:
+            return endObject();
+        case Frame::Property:
+            return endProperties();
+        default:
+            frames.pop_back();
+            return endValue();
+        }
+    }
+
+    bool StartArray() {
+        if (frames.empty()) {
+            return false;
+        }
+        switch (frames.back()) {
+        case Frame::Object:
+            switch (objects.back().member) {
+            case Member::Features:
+                frames.push_back(Frame::Features);
+                return true;
+            case Member::Geometries:
+                frames.push_back(Frame::Geometries);
+                return true;
+            case Member::Coordinates:
+                frames.push_back(Frame::Coordinates);
+                return objects.back().coordinates.startArray(0);
+            case Member::Skip:
+                frames.push_back(Frame::Skip);
+                return true;
+            default:
+                return false;
+            }
+        case Frame::Coordinates:
+            frames.push_back(Frame::Coordinates);
+            return objects.back().coordinates.startArray(objects.back().coordinates.level + 1);
+        case Frame::Property:
+            return startProperties(false);
+        case Frame::Skip:
+            frames.push_back(Frame::Skip);
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool EndArray(rapidjson::SizeType) {
+        switch (frames.back()) {
+        case Frame::Coordinates: {
+            frames.pop_back();
+            std::size_t& level = objects.back().coordinates.level;
+            if (level == 0) {
+                return endValue();
+            }
+            level--;
+            return true;
+        }
+        case Frame::Property:
+            return endProperties();
+        default:
+            frames.pop_back();
+            return endValue();
+        }
+    }
+
+private:
+    enum class Frame : uint8_t {
+        Object,
+        Features,
+        Geometries,
+        Coordinates,
+        Property,
+        Skip,
+    };
+
+    enum class Role : uint8_t {
+        Root,
+        Feature,
+        Geometry,
+    };
+
+    enum class Member : uint8_t {
+        None,
+        Type,
+        Features,
+        Geometry,
+        Geometries,
+        Coordinates,
+        ID,
+        Properties,
+        Skip,
+    };
+
+    // Nested coordinate arrays, recorded before the geometry type is known.
+    struct Coordinates {
+        // The element count of every array, by nesting level.
+        std::vector<std::vector<std::size_t>> sizes;
+        // Whether there are arrays of numbers or arrays of arrays at a level.
+        std::vector<bool> numbers;
+        std::vector<bool> arrays;
+        std::vector<Point<double>> points;
+        std::size_t level = 0;
+        double x = 0;
+
+        bool startArray(std::size_t level_) {
+            // Positions are never nested any deeper than in multi polygons.
+            if (level_ > 3) {
+                return false;
+            }
+            if (level_ >= sizes.size()) {
+                sizes.resize(level_ + 1);
+                numbers.resize(level_ + 1);
+                arrays.resize(level_ + 1);
+            }
+            if (level_ > 0) {
+                sizes[level_ - 1].back()++;
+                arrays[level_ - 1] = true;
+            }
+            sizes[level_].push_back(0);
+            level = level_;
+            return true;
+        }
+
+        void number(double value) {
+            std::size_t& size = sizes[level].back();
+            if (size == 0) {
+                x = value;
+            } else if (size == 1) {
+                points.emplace_back(x, value);
+            }
+            size++;
+            numbers[level] = true;
+        }
+
+        // Checks that positions, which have at least two numbers each, are nested `depth` arrays deep.
+        bool valid(std::size_t depth) const {
+            if (sizes.size() > depth + 1) {
+                return false;
+            }
+            for (std::size_t i = 0; i < sizes.size(); i++) {
+                if (i < depth && numbers[i]) {
+                    return false;
+                }
+                if (i == depth) {
+                    if (arrays[i]) {
+                        return false;
+                    }
+                    for (std::size_t size : sizes[i]) {
+                        if (size < 2) {
+                            return false;
+                        }
+                    }
+                }
+            }
+            return true;
+        }
+    };
+
+    // Builds geometries from recorded coordinates, in document order.
+    class CoordinateBuilder {
+    public:
+        CoordinateBuilder(const Coordinates& coordinates_)
+            : coordinates(coordinates_), cursors(coordinates.sizes.size(), 0) {}
+
+        template <class Points>
+        Points points(std::size_t level) {
+            Points result;
+            const std::size_t size = next(level);
+            result.reserve(size);
+            for (std::size_t i = 0; i < size; i++) {
+                result.push_back(coordinates.points[point++]);
+            }
+            return result;
+        }
+
+        template <class Lines>
+        Lines lines(std::size_t level) {
+            Lines result;
+            const std::size_t size = next(level);
+            result.reserve(size);
+            for (std::size_t i = 0; i < size; i++) {
+                result.push_back(points<typename Lines::value_type>(level + 1));
+            }
+            return result;
+        }
+
+        MultiPolygon<double> polygons() {
+            MultiPolygon<double> result;
+            const std::size_t size = next(0);
+            result.reserve(size);
+            for (std::size_t i = 0; i < size; i++) {
+                result.push_back(lines<Polygon<double>>(1));
+            }
+            return result;
+        }
+
+    private:
+        std::size_t next(std::size_t level) {
+            return coordinates.sizes[level][cursors[level]++];
+        }
+
+        const Coordinates& coordinates;
+        std::vector<std::size_t> cursors;
+        std::size_t point = 0;
+    };
+
+    // A GeoJSON object: the root object, a feature of a feature collection, or a geometry.
+    struct Object {
+        Object(Role role_) : role(role_) {}
+
+        Role role;
+        Member member = Member::None;
+        // The members that have been seen, to catch duplicates.
+        uint16_t seen = 0;
+
+        std::string type;
+        Coordinates coordinates;
+        mapbox::geometry::geometry_collection<double> geometries;
+        mapbox::geometry::feature_collection<double> features;
+        optional<Geometry<double>> geometry;
+        optional<FeatureIdentifier> id;
+        optional<PropertyMap> properties;
+
+        bool has(Member m) const {
+            return seen & (1u << uint8_t(m));
+        }
+    };
+
+    // A property value that is an object or array.
+    struct Property {
+        Property(bool isObject_) : isObject(isObject_) {}
+
+        bool isObject;
+        std::string key;
+        PropertyMap map;
+        std::vector<Value> array;
+    };
+
+    bool startObject(Role role) {
+        frames.push_back(Frame::Object);
+        objects.emplace_back(role);
+        return true;
+    }
+
+    bool key(Object& object, const std::string& name) {
+        Member m = Member::Skip;
+        if (name == "type") {
+            m = Member::Type;
+        } else if (object.role == Role::Root && name == "features") {
+            m = Member::Features;
+        } else if (object.role != Role::Geometry && name == "geometry") {
+            m = Member::Geometry;
+        } else if (object.role != Role::Feature && name == "geometries") {
+            m = Member::Geometries;
+        } else if (object.role != Role::Feature && name == "coordinates") {
+            m = Member::Coordinates;
+        } else if (object.role != Role::Geometry && name == "id") {
+            m = Member::ID;
+        } else if (object.role != Role::Geometry && name == "properties") {
+            m = Member::Properties;
+        }
+
+        if (m != Member::Skip) {
+            if (object.has(m)) {
+                return false;
+            }
+            object.seen |= 1u << uint8_t(m);
+        }
+        object.member = m;
+        return true;
+    }
+
+    // Accepts a scalar value if the current member is the given one.
+    bool member(Member m) {
+        if (objects.back().member != m) {
+            return false;
+        }
+        objects.back().member = Member::None;
+        return true;
+    }
+
+    // Called once a value of a member of an object has been read in full.
+    bool endValue() {
+        if (!frames.empty() && frames.back() == Frame::Object) {
+            objects.back().member = Member::None;
+        }
+        return true;
+    }
+
+    template <class T>
+    bool number(T value) {
+        if (frames.empty()) {
+            return false;
+        }
+        switch (frames.back()) {
+        case Frame::Object: {
+            Object& object = objects.back();
+            if (object.member == Member::ID) {
+                object.id = FeatureIdentifier(value);
+            } else if (object.member != Member::Skip) {
+                return false;
+            }
+            object.member = Member::None;
+            return true;
+        }
+        case Frame::Coordinates:
+            objects.back().coordinates.number(double(value));
+            return true;
+        case Frame::Property:
+            return addProperty(value);
+        case Frame::Skip:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool startProperties(bool isObject) {
+        frames.push_back(Frame::Property);
+        properties.emplace_back(isObject);
+        return true;
+    }
+
+    bool addProperty(Value value) {
+        Property& property = properties.back();
+        if (property.isObject) {
+            // Like the document based conversion, this keeps the first of duplicate keys.
+            property.map.emplace(std::move(property.key), std::move(value));
+        } else {
+            property.array.push_back(std::move(value));
+        }
+        return true;
+    }
+
+    bool endProperties() {
+        frames.pop_back();
+        Property property = std::move(properties.back());
+        properties.pop_back();
+
+        if (frames.back() == Frame::Property) {
+            if (property.isObject) {
+                return addProperty(std::move(property.map));
+            } else {
+                return addProperty(std::move(property.array));
+            }
+        }
+
+        // The properties of a feature.
+        if (!property.isObject) {
+            return false;
+        }
+        objects.back().properties = std::move(property.map);
+        return endValue();
+    }
+
+    bool endObject() {
+        frames.pop_back();
+        Object object = std::move(objects.back());
+        objects.pop_back();
+
+        switch (object.role) {
+        case Role::Root: {
+            if (!object.has(Member::Type)) {
+                return false;
+            }
+            if (object.type == "FeatureCollection") {
+                if (!object.has(Member::Features)) {
+                    return false;
+                }
+                result = GeoJSON{ std::move(object.features) };
+            } else if (object.type == "Feature") {
+                auto feature = makeFeature(object);
+                if (!feature) {
+                    return false;
+                }
+                result = GeoJSON{ std::move(*feature) };
+            } else {
+                auto geometry = makeGeometry(object);
+                if (!geometry) {
+                    return false;
+                }
+                result = GeoJSON{ std::move(*geometry) };
+            }
+            return true;
+        }
+
+        case Role::Feature: {
+            auto feature = makeFeature(object);
+            if (!feature) {
+                return false;
+            }
+            objects.back().features.push_back(std::move(*feature));
+            return true;
+        }
+
+        case Role::Geometry: {
+            auto geometry = makeGeometry(object);
+            if (!geometry) {
+                return false;
+            }
+            if (frames.back() == Frame::Geometries) {
+                objects.back().geometries.push_back(std::move(*geometry));
+                return true;
+            }
+            objects.back().geometry = std::move(*geometry);
+            return endValue();
+        }
+        }
+
+        return false;
+    }
+
+    static optional<Feature> makeFeature(Object& object) {
+        if (object.type != "Feature" || !object.geometry) {
+            return {};
+        }
+
+        Feature feature;
+        feature.geometry = std::move(*object.geometry);
+        if (object.id) {
+            feature.id = std::move(*object.id);
+        }
+        if (object.properties) {
+            feature.properties = std::move(*object.properties);
+        }
+        return feature;
+    }
+
+    static optional<Geometry<double>> makeGeometry(Object& object) {
+        if (!object.has(Member::Type)) {
+            return {};
+        }
+
+        const std::string& type = object.type;
+
+        if (type == "GeometryCollection") {
+            if (!object.has(Member::Geometries)) {
+                return {};
+            }
+            return Geometry<double>{ std::move(object.geometries) };
+        }
+
+        if (!object.has(Member::Coordinates)) {
+            return {};
+        }
+
+        const Coordinates& coordinates = object.coordinates;
+        CoordinateBuilder builder(coordinates);
+
+        if (type == "Point") {
+            if (!coordinates.valid(0)) {
+                return {};
+            }
+            return Geometry<double>{ coordinates.points.front() };
+        } else if (type == "MultiPoint") {
+            if (!coordinates.valid(1)) {
+                return {};
+            }
+            return Geometry<double>{ builder.points<MultiPoint<double>>(0) };
+        } else if (type == "LineString") {
+            if (!coordinates.valid(1)) {
+                return {};
+            }
+            return Geometry<double>{ builder.points<LineString<double>>(0) };
+        } else if (type == "MultiLineString") {
+            if (!coordinates.valid(2)) {
+                return {};
+            }
+            return Geometry<double>{ builder.lines<MultiLineString<double>>(0) };
+        } else if (type == "Polygon") {
+            if (!coordinates.valid(2)) {
+                return {};
+            }
+            return Geometry<double>{ builder.lines<Polygon<double>>(0) };
+        } else if (type == "MultiPolygon") {
+            if (!coordinates.valid(3)) {
+                return {};
+            }
+            return Geometry<double>{ builder.polygons() };
+        }
+
+        return {};
+    }
+
+    std::vector<Frame> frames;
+    std::vector<Object> objects;
+    std::vector<Property> properties;
+};
+
+} // namespace
+
 optional<GeoJSON> Converter<GeoJSON>::operator()(const std::string& value, Error& error) const {
+    GeoJSONReader handler;
+    rapidjson::Reader reader;
+    rapidjson::StringStream stream(value.c_str());
+    if (reader.Parse(stream, handler) && handler.result) {
+        return std::move(handler.result);
+    }
+
     return convertJSON<GeoJSON>(value, error);
 }
 
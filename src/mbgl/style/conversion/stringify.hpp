@@ -390,7 +390,7 @@ private:
 template <class Writer, class T>
 void stringify(Writer& writer, const CameraFunction<T>& f) {
     writer.StartObject();
-    CameraFunction<T>::Stops::visit(f.stops, StringifyStops<Writer> { writer });
+    CameraFunction<T>::Stops::visit(f.getStops(), StringifyStops<Writer> { writer });
     writer.EndObject();
 }
 
@@ -412,7 +412,7 @@ void stringify(Writer& writer, const CompositeFunction<T>& f) {
     writer.StartObject();
     writer.Key("property");
     writer.String(f.property);
-    CompositeFunction<T>::Stops::visit(f.stops, StringifyStops<Writer> { writer });
+    CompositeFunction<T>::Stops::visit(f.getStops(), StringifyStops<Writer> { writer });
     if (f.defaultValue) {
         writer.Key("default");
         stringify(writer, *f.defaultValue);
@@ -0,0 +1,51 @@
+#include <mbgl/style/function/zoom_stop_index.hpp>
+#include <mbgl/util/constants.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace mbgl {
+namespace style {
+
+void ZoomStopIndex::build() {
+    if (!zooms.empty() && zooms.back() >= 0) {
+        const auto count = std::min<std::size_t>(std::floor(zooms.back()) + 1, std::ceil(util::MAX_ZOOM) + 1);
+        levels.reserve(count);
+        for (std::size_t level = 0; level < count; level++) {
+            levels.push_back(std::upper_bound(zooms.begin(), zooms.end(), float(level)) - zooms.begin());
+        }
+    }
+
+    if (base != 1.0f) {
+        scales.reserve(zooms.size());
+        for (std::size_t i = 1; i < zooms.size(); i++) {
+            scales.push_back(std::pow(base, zooms[i] - zooms[i - 1]) - 1);
+        }
+    }
+}
+
+std::size_t ZoomStopIndex::upperBound(float zoom) const {
+    if (zoom >= 0 && zoom < levels.size()) {
+        std::size_t i = levels[static_cast<std::size_t>(zoom)];
+        while (i < zooms.size() && zooms[i] <= zoom) {
+            i++;
+        }
+        return i;
+    }
+    return std::upper_bound(zooms.begin(), zooms.end(), zoom) - zooms.begin();
+}
+
+float ZoomStopIndex::interpolationFactor(std::size_t i, float zoom) const {
+    const float zoomDiff = zooms[i] - zooms[i - 1];
+    const float zoomProgress = zoom - zooms[i - 1];
+    if (zoomDiff == 0) {
+        return 0;
+    } else if (base == 1.0f) {
+        return zoomProgress / zoomDiff;
+    } else {
+        return (std::pow(base, zoomProgress) - 1) / scales[i - 1];
+    }
+}
+
+} // namespace style
+} // namespace mbgl
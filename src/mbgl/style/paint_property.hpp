@@ -21,6 +21,7 @@ public:
     using PossiblyEvaluatedType = T;
     using Type = T;
     static constexpr bool IsDataDriven = false;
+    static constexpr bool IsCrossFaded = false;
 };
 
 template <class T, class A, class U>
@@ -32,6 +33,7 @@ public:
     using PossiblyEvaluatedType = PossiblyEvaluatedPropertyValue<T>;
     using Type = T;
     static constexpr bool IsDataDriven = true;
+    static constexpr bool IsCrossFaded = false;
 
     using Attribute = A;
     using Uniform = U;
@@ -46,6 +48,7 @@ public:
     using PossiblyEvaluatedType = Faded<T>;
     using Type = T;
     static constexpr bool IsDataDriven = false;
+    static constexpr bool IsCrossFaded = true;
 };
 
 } // namespace style
@@ -13,6 +13,8 @@
 
 #include <rapidjson/document.h>
 #include <rapidjson/error/en.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 
 #include <algorithm>
 #include <set>
@@ -98,7 +100,7 @@ StyleParseResult Parser::parse(const std::string& json) {
         parseSources(document["sources"]);
     }
 
-    if (document.HasMember("layers")) {
+    if (document.HasMember("layers") && !skipLayers) {
         parseLayers(document["layers"]);
     }
 
@@ -116,6 +118,16 @@ StyleParseResult Parser::parse(const std::string& json) {
         }
     }
 
+    if (keepRemainder) {
+        layersMap.clear();
+        document.RemoveMember("layers");
+
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        document.Accept(writer);
+        remainder = { buffer.GetString(), buffer.GetSize() };
+    }
+
     return nullptr;
 }
 
@@ -278,7 +290,7 @@ std::vector<FontStack> Parser::fontStacks() const {
             } else if (textFont.isConstant()) {
                 optional.insert(textFont.asConstant());
             } else if (textFont.isCameraFunction()) {
-                textFont.asCameraFunction().stops.match(
+                textFont.asCameraFunction().getStops().match(
                     [&] (const auto& stops) {
                         for (const auto& stop : stops.stops) {
                             optional.insert(stop.second);
@@ -26,6 +26,13 @@ public:
 
     StyleParseResult parse(const std::string&);
 
+    // Leaves out the layers of the style, e.g. because they are taken from a cache.
+    bool skipLayers = false;
+
+    // Keeps the style without its layers in `remainder`, in JSON.
+    bool keepRemainder = false;
+    std::string remainder;
+
     std::string spriteURL;
     std::string glyphURL;
 
@@ -187,6 +187,22 @@ public:
             return result;
         }
 
+        // Whether evaluating the properties gives the same result at every zoom level, once
+        // transitions are complete.
+        template <class P>
+        bool isZoomConstant() const {
+            const auto& value = this->template get<P>().getValue();
+            // Cross-faded properties fade between zoom levels even when they are constant. Undefined
+            // ones draw nothing, so their fade is never used.
+            return P::IsCrossFaded ? value.isUndefined() : value.isZoomConstant();
+        }
+
+        bool isZoomConstant() const {
+            bool result = true;
+            util::ignore({ result &= isZoomConstant<Ps>()... });
+            return result;
+        }
+
         template <class P>
         auto evaluate(const PropertyEvaluationParameters& parameters) const {
             using Evaluator = typename P::EvaluatorType;
@@ -1,7 +1,6 @@
 #include <mbgl/style/sources/geojson_source.hpp>
 #include <mbgl/style/sources/geojson_source_impl.hpp>
 #include <mbgl/style/source_observer.hpp>
-#include <mbgl/style/conversion/json.hpp>
 #include <mbgl/style/conversion/geojson.hpp>
 #include <mbgl/storage/file_source.hpp>
 #include <mbgl/util/logging.hpp>
@@ -61,7 +60,7 @@ void GeoJSONSource::loadDescription(FileSource& fileSource) {
                 *this, std::make_exception_ptr(std::runtime_error("unexpectedly empty GeoJSON")));
         } else {
             conversion::Error error;
-            optional<GeoJSON> geoJSON = conversion::convertJSON<GeoJSON>(*res.data, error);
+            optional<GeoJSON> geoJSON = conversion::convert<GeoJSON>(*res.data, error);
             if (!geoJSON) {
                 Log::Error(Event::ParseStyle, "Failed to parse GeoJSON data: %s",
                            error.message.c_str());
@@ -8,8 +8,9 @@
 namespace mbgl {
 namespace style {
 
-Style::Style(Scheduler& scheduler, FileSource& fileSource, float pixelRatio)
-    : impl(std::make_unique<Impl>(scheduler, fileSource, pixelRatio)) {
+Style::Style(Scheduler& scheduler, FileSource& fileSource, float pixelRatio,
+             const optional<std::string>& decodedCacheDir)
+    : impl(std::make_unique<Impl>(scheduler, fileSource, pixelRatio, decodedCacheDir)) {
 }
 
 Style::~Style() = default;
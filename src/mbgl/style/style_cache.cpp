@@ -0,0 +1,127 @@
+#include <mbgl/style/style_cache.hpp>
+#include <mbgl/style/layer_impl.hpp>
+#include <mbgl/style/layers/background_layer.hpp>
+#include <mbgl/style/layers/background_layer_impl.hpp>
+#include <mbgl/style/layers/circle_layer.hpp>
+#include <mbgl/style/layers/circle_layer_impl.hpp>
+#include <mbgl/style/layers/fill_extrusion_layer.hpp>
+#include <mbgl/style/layers/fill_extrusion_layer_impl.hpp>
+#include <mbgl/style/layers/fill_layer.hpp>
+#include <mbgl/style/layers/fill_layer_impl.hpp>
+#include <mbgl/style/layers/line_layer.hpp>
+#include <mbgl/style/layers/line_layer_impl.hpp>
+#include <mbgl/style/layers/raster_layer.hpp>
+#include <mbgl/style/layers/raster_layer_impl.hpp>
+#include <mbgl/style/layers/symbol_layer.hpp>
+#include <mbgl/style/layers/symbol_layer_impl.hpp>
+
+#include <cassert>
+
+namespace mbgl {
+namespace style {
+
+namespace {
+
+// Every entry holds on to the layers of a whole style, so only a handful are kept.
+const std::size_t capacity = 8;
+
+std::unique_ptr<Layer> makeLayer(const Immutable<Layer::Impl>& impl) {
+    switch (impl->type) {
+    case LayerType::Fill:
+        return std::make_unique<FillLayer>(staticImmutableCast<FillLayer::Impl>(impl));
+    case LayerType::Line:
+        return std::make_unique<LineLayer>(staticImmutableCast<LineLayer::Impl>(impl));
+    case LayerType::Circle:
+        return std::make_unique<CircleLayer>(staticImmutableCast<CircleLayer::Impl>(impl));
+    case LayerType::Symbol:
+        return std::make_unique<SymbolLayer>(staticImmutableCast<SymbolLayer::Impl>(impl));
+    case LayerType::Raster:
+        return std::make_unique<RasterLayer>(staticImmutableCast<RasterLayer::Impl>(impl));
+    case LayerType::Background:
+        return std::make_unique<BackgroundLayer>(staticImmutableCast<BackgroundLayer::Impl>(impl));
+    case LayerType::FillExtrusion:
+        return std::make_unique<FillExtrusionLayer>(staticImmutableCast<FillExtrusionLayer::Impl>(impl));
+    case LayerType::Custom:
+        // Custom layers are never part of a parsed style.
+        break;
+    }
+
+    assert(false);
+    return nullptr;
+}
+
+} // namespace
+
+StyleCache& StyleCache::getInstance() {
+    static StyleCache instance;
+    return instance;
+}
+
+StyleParseResult StyleCache::parse(Parser& parser, const std::string& json, const std::string& url,
+                                   const optional<std::string>& etag) {
+    if (url.empty() || !etag) {
+        return parser.parse(json);
+    }
+
+    const std::string key = url + '\n' + *etag;
+
+    if (auto entry = get(key)) {
+        parser.skipLayers = true;
+        if (auto error = parser.parse(entry->remainder)) {
+            return error;
+        }
+        parser.layers.reserve(entry->layers.size());
+        for (const auto& impl : entry->layers) {
+            parser.layers.push_back(makeLayer(impl));
+        }
+        return nullptr;
+    }
+
+    parser.keepRemainder = true;
+    if (auto error = parser.parse(json)) {
+        return error;
+    }
+
+    auto entry = std::make_shared<Entry>();
+    entry->remainder = std::move(parser.remainder);
+    entry->layers.reserve(parser.layers.size());
+    for (const auto& layer : parser.layers) {
+        entry->layers.push_back(layer->baseImpl);
+    }
+    put(key, std::move(entry));
+
+    return nullptr;
+}
+
+std::shared_ptr<const StyleCache::Entry> StyleCache::get(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = entries.begin(); it != entries.end(); ++it) {
+        if (it->first == key) {
+            entries.splice(entries.begin(), entries, it);
+            return it->second;
+        }
+    }
+    return nullptr;
+}
+
+void StyleCache::put(const std::string& key, std::shared_ptr<const Entry> entry) {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.remove_if([&](const auto& pair) { return pair.first == key; });
+    entries.emplace_front(key, std::move(entry));
+    if (entries.size() > capacity) {
+        entries.pop_back();
+    }
+}
+
+std::size_t StyleCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+void StyleCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+}
+
+} // namespace style
+} // namespace mbgl
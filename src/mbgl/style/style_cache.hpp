@@ -0,0 +1,55 @@
+#pragma once
+
+#include <mbgl/style/layer.hpp>
+#include <mbgl/style/parser.hpp>
+#include <mbgl/util/immutable.hpp>
+#include <mbgl/util/noncopyable.hpp>
+#include <mbgl/util/optional.hpp>
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mbgl {
+namespace style {
+
+// Process-wide cache of parsed styles, keyed by style URL and ETag. Converting the layers of a
+// large style, with all of their filters and functions, makes up most of the time it takes to
+// load it. Layer implementations are immutable, so styles loaded again with an unchanged ETag
+// share them with the first load, and only the rest of the style is parsed again. Styles without
+// an ETag are never cached, since there would be no way of telling whether an entry is stale.
+class StyleCache : private util::noncopyable {
+public:
+    static StyleCache& getInstance();
+
+    // Parses the style into the parser. Layers are taken from the cache if the style has been
+    // parsed before.
+    StyleParseResult parse(Parser&, const std::string& json, const std::string& url,
+                           const optional<std::string>& etag);
+
+    std::size_t size() const;
+    void clear();
+
+private:
+    StyleCache() = default;
+
+    struct Entry {
+        // The style without its layers, in JSON.
+        std::string remainder;
+        std::vector<Immutable<Layer::Impl>> layers;
+    };
+
+    std::shared_ptr<const Entry> get(const std::string& key);
+    void put(const std::string& key, std::shared_ptr<const Entry>);
+
+    mutable std::mutex mutex;
+
+    // Most recently used entries first.
+    std::list<std::pair<std::string, std::shared_ptr<const Entry>>> entries;
+};
+
+} // namespace style
+} // namespace mbgl
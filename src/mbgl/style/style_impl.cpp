@@ -11,6 +11,7 @@
 #include <mbgl/style/layers/raster_layer.hpp>
 #include <mbgl/style/layer_impl.hpp>
 #include <mbgl/style/parser.hpp>
+#include <mbgl/style/style_cache.hpp>
 #include <mbgl/style/transition_options.hpp>
 #include <mbgl/sprite/sprite_loader.hpp>
 #include <mbgl/util/exception.hpp>
@@ -25,10 +26,11 @@ namespace style {
 
 static Observer nullObserver;
 
-Style::Impl::Impl(Scheduler& scheduler_, FileSource& fileSource_, float pixelRatio)
+Style::Impl::Impl(Scheduler& scheduler_, FileSource& fileSource_, float pixelRatio,
+                  const optional<std::string>& decodedCacheDir)
     : scheduler(scheduler_),
       fileSource(fileSource_),
-      spriteLoader(std::make_unique<SpriteLoader>(pixelRatio)),
+      spriteLoader(std::make_unique<SpriteLoader>(pixelRatio, decodedCacheDir)),
       light(std::make_unique<Light>()),
       observer(&nullObserver) {
     spriteLoader->setObserver(this);
@@ -69,15 +71,15 @@ void Style::Impl::loadURL(const std::string& url_) {
         } else if (res.notModified || res.noContent) {
             return;
         } else {
-            parse(*res.data);
+            parse(*res.data, res.etag);
         }
     });
 }
 
-void Style::Impl::parse(const std::string& json_) {
+void Style::Impl::parse(const std::string& json_, const optional<std::string>& etag) {
     Parser parser;
 
-    if (auto error = parser.parse(json_)) {
+    if (auto error = StyleCache::getInstance().parse(parser, json_, url, etag)) {
         std::string message = "Failed to parse style: " + util::toString(error);
         Log::Error(Event::ParseStyle, message.c_str());
         observer->onStyleError(std::make_exception_ptr(util::StyleParseException(message)));
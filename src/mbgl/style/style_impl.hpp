@@ -36,7 +36,7 @@ class Style::Impl : public SpriteLoaderObserver,
                     public LightObserver,
                     public util::noncopyable {
 public:
-    Impl(Scheduler&, FileSource&, float pixelRatio);
+    Impl(Scheduler&, FileSource&, float pixelRatio, const optional<std::string>& decodedCacheDir = {});
     ~Impl() override;
 
     void loadJSON(const std::string&);
@@ -97,7 +97,7 @@ public:
     bool spriteLoaded = false;
 
 private:
-    void parse(const std::string&);
+    void parse(const std::string&, const optional<std::string>& etag = {});
 
     Scheduler& scheduler;
     FileSource& fileSource;
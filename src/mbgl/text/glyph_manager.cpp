@@ -1,6 +1,7 @@
 #include <mbgl/text/glyph_manager.hpp>
 #include <mbgl/text/glyph_manager_observer.hpp>
 #include <mbgl/text/glyph_pbf.hpp>
+#include <mbgl/storage/decoded_cache.hpp>
 #include <mbgl/storage/file_source.hpp>
 #include <mbgl/storage/resource.hpp>
 #include <mbgl/storage/response.hpp>
@@ -9,8 +10,9 @@ namespace mbgl {
 
 static GlyphManagerObserver nullObserver;
 
-GlyphManager::GlyphManager(FileSource& fileSource_)
+GlyphManager::GlyphManager(FileSource& fileSource_, const optional<std::string>& decodedCacheDir)
     : fileSource(fileSource_),
+      decodedCache(decodedCacheDir ? std::make_unique<DecodedCache>(*decodedCacheDir) : nullptr),
       observer(&nullObserver) {
 }
 
@@ -56,14 +58,15 @@ GlyphManager::GlyphRequest& GlyphManager::requestRange(Entry& entry, const FontS
         return request;
     }
 
-    request.req = fileSource.request(Resource::glyphs(glyphURL, fontStack, range), [this, fontStack, range](Response res) {
-        processResponse(res, fontStack, range);
+    Resource resource = Resource::glyphs(glyphURL, fontStack, range);
+    request.req = fileSource.request(resource, [this, fontStack, range, url = resource.url](Response res) {
+        processResponse(res, fontStack, range, url);
     });
 
     return request;
 }
 
-void GlyphManager::processResponse(const Response& res, const FontStack& fontStack, const GlyphRange& range) {
+void GlyphManager::processResponse(const Response& res, const FontStack& fontStack, const GlyphRange& range, const std::string& url) {
     if (res.error) {
         observer->onGlyphsError(fontStack, range, std::make_exception_ptr(std::runtime_error(res.error->message)));
         return;
@@ -80,7 +83,18 @@ void GlyphManager::processResponse(const Response& res, const FontStack& fontSta
         std::vector<Glyph> glyphs;
 
         try {
-            glyphs = parseGlyphPBF(range, *res.data);
+            optional<std::vector<Glyph>> cached;
+            if (decodedCache && res.etag) {
+                cached = decodedCache->getGlyphs(url, *res.etag);
+            }
+            if (cached) {
+                glyphs = std::move(*cached);
+            } else {
+                glyphs = parseGlyphPBF(range, *res.data);
+                if (decodedCache && res.etag) {
+                    decodedCache->putGlyphs(url, *res.etag, glyphs);
+                }
+            }
         } catch (...) {
             observer->onGlyphsError(fontStack, range, std::current_exception());
             return;
@@ -6,6 +6,7 @@
 #include <mbgl/util/noncopyable.hpp>
 #include <mbgl/util/font_stack.hpp>
 #include <mbgl/util/immutable.hpp>
+#include <mbgl/util/optional.hpp>
 
 #include <string>
 #include <unordered_map>
@@ -15,6 +16,7 @@ namespace mbgl {
 class FileSource;
 class AsyncRequest;
 class Response;
+class DecodedCache;
 
 class GlyphRequestor {
 public:
@@ -24,7 +26,7 @@ public:
 
 class GlyphManager : public util::noncopyable {
 public:
-    GlyphManager(FileSource&);
+    GlyphManager(FileSource&, const optional<std::string>& decodedCacheDir = {});
     ~GlyphManager();
 
     // Workers send a `getGlyphs` message to the main thread once they have determined
@@ -45,6 +47,9 @@ private:
     FileSource& fileSource;
     std::string glyphURL;
 
+    // Optional on-disk cache of parsed glyph ranges, keyed by range URL and ETag.
+    std::unique_ptr<DecodedCache> decodedCache;
+
     struct GlyphRequest {
         bool parsed = false;
         std::unique_ptr<AsyncRequest> req;
@@ -59,7 +64,7 @@ private:
     std::unordered_map<FontStack, Entry, FontStackHash> entries;
 
     GlyphRequest& requestRange(Entry&, const FontStack&, const GlyphRange&);
-    void processResponse(const Response&, const FontStack&, const GlyphRange&);
+    void processResponse(const Response&, const FontStack&, const GlyphRange&, const std::string& url);
     void notify(GlyphRequestor&, const GlyphDependencies&);
 
     GlyphManagerObserver* observer = nullptr;
@@ -0,0 +1,87 @@
+#include <mbgl/tile/decoded_geometry_tile_layer.hpp>
+
+namespace mbgl {
+
+namespace {
+
+class DecodedFeatureView : public GeometryTileFeature {
+public:
+    DecodedFeatureView(const DecodedGeometryTileLayer& layer_, std::size_t index_)
+        : layer(layer_), index(index_) {
+    }
+
+    FeatureType getType() const override {
+        return layer.getType(index);
+    }
+
+    optional<Value> getValue(const std::string& key) const override {
+        return layer.getFeature(index).getValue(key);
+    }
+
+    PropertyMap getProperties() const override {
+        return layer.getFeature(index).getProperties();
+    }
+
+    optional<FeatureIdentifier> getID() const override {
+        return layer.getID(index);
+    }
+
+    GeometryCollection getGeometries() const override {
+        return layer.getGeometries(index);
+    }
+
+private:
+    const DecodedGeometryTileLayer& layer;
+    const std::size_t index;
+};
+
+class DecodedLayerView : public GeometryTileLayer {
+public:
+    DecodedLayerView(std::shared_ptr<const DecodedGeometryTileLayer> layer_)
+        : layer(std::move(layer_)) {
+    }
+
+    std::size_t featureCount() const override {
+        return layer->featureCount();
+    }
+
+    std::unique_ptr<GeometryTileFeature> getFeature(std::size_t i) const override {
+        return std::make_unique<DecodedFeatureView>(*layer, i);
+    }
+
+    std::string getName() const override {
+        return layer->getName();
+    }
+
+private:
+    const std::shared_ptr<const DecodedGeometryTileLayer> layer;
+};
+
+} // namespace
+
+DecodedGeometryTileLayer::DecodedGeometryTileLayer(std::unique_ptr<GeometryTileLayer> layer_)
+    : layer(std::move(layer_)),
+      decoded(std::make_unique<std::once_flag[]>(layer->featureCount())) {
+    const std::size_t count = layer->featureCount();
+    features.reserve(count);
+    for (std::size_t i = 0; i < count; i++) {
+        std::unique_ptr<GeometryTileFeature> feature = layer->getFeature(i);
+        const FeatureType type = feature->getType();
+        optional<FeatureIdentifier> id = feature->getID();
+        features.push_back({ std::move(feature), type, std::move(id), {} });
+    }
+}
+
+const GeometryCollection& DecodedGeometryTileLayer::getGeometries(std::size_t i) const {
+    const Feature& feature = features[i];
+    std::call_once(decoded[i], [&] {
+        feature.geometries = feature.feature->getGeometries();
+    });
+    return *feature.geometries;
+}
+
+std::unique_ptr<GeometryTileLayer> DecodedGeometryTileLayer::view(std::shared_ptr<const DecodedGeometryTileLayer> layer) {
+    return std::make_unique<DecodedLayerView>(std::move(layer));
+}
+
+} // namespace mbgl
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <mbgl/tile/geometry_tile_data.hpp>
+#include <mbgl/util/optional.hpp>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace mbgl {
+
+// Decodes the type, ID and geometry of each feature in a source layer at most once, so that
+// layout groups sharing a source layer don't repeat that work. Types and IDs are decoded up
+// front, since every group needs them to evaluate its filter; geometries are decoded on first
+// use, since filters typically reject most features for all but a few groups. Groups may be laid
+// out concurrently, so decoding a geometry on first use is synchronized.
+class DecodedGeometryTileLayer {
+public:
+    explicit DecodedGeometryTileLayer(std::unique_ptr<GeometryTileLayer>);
+
+    std::size_t featureCount() const { return features.size(); }
+    std::string getName() const { return layer->getName(); }
+
+    // The underlying feature, for property lookups.
+    const GeometryTileFeature& getFeature(std::size_t i) const { return *features[i].feature; }
+    FeatureType getType(std::size_t i) const { return features[i].type; }
+    const optional<FeatureIdentifier>& getID(std::size_t i) const { return features[i].id; }
+    const GeometryCollection& getGeometries(std::size_t) const;
+
+    // Returns a GeometryTileLayer whose features return the shared, already decoded type, ID and
+    // geometry. The view keeps the decoded layer alive.
+    static std::unique_ptr<GeometryTileLayer> view(std::shared_ptr<const DecodedGeometryTileLayer>);
+
+private:
+    struct Feature {
+        std::unique_ptr<GeometryTileFeature> feature;
+        FeatureType type;
+        optional<FeatureIdentifier> id;
+        mutable optional<GeometryCollection> geometries;
+    };
+
+    const std::unique_ptr<GeometryTileLayer> layer;
+    std::vector<Feature> features;
+
+    // One flag per feature; kept apart from `features` because std::once_flag can't be moved.
+    const std::unique_ptr<std::once_flag[]> decoded;
+};
+
+} // namespace mbgl
@@ -36,6 +36,7 @@ GeometryTile::GeometryTile(const OverscaledTileID& id_,
       mailbox(std::make_shared<Mailbox>(*util::RunLoop::Get())),
       worker(parameters.workerScheduler,
              ActorRef<GeometryTile>(*this, mailbox),
+             parameters.workerScheduler,
              id_,
              obsolete,
              parameters.mode,
@@ -1,5 +1,7 @@
 #include <mbgl/tile/geometry_tile_worker.hpp>
+#include <mbgl/actor/parallel_for.hpp>
 #include <mbgl/tile/geometry_tile_data.hpp>
+#include <mbgl/tile/decoded_geometry_tile_layer.hpp>
 #include <mbgl/tile/geometry_tile.hpp>
 #include <mbgl/text/collision_tile.hpp>
 #include <mbgl/layout/symbol_layout.hpp>
@@ -21,14 +23,22 @@ namespace mbgl {
 
 using namespace style;
 
+namespace {
+
+constexpr std::size_t minimumParallelGroupCount = 4;
+
+} // namespace
+
 GeometryTileWorker::GeometryTileWorker(ActorRef<GeometryTileWorker> self_,
                                        ActorRef<GeometryTile> parent_,
+                                       Scheduler& scheduler_,
                                        OverscaledTileID id_,
                                        const std::atomic<bool>& obsolete_,
                                        const MapMode mode_,
                                        const float pixelRatio_)
     : self(std::move(self_)),
       parent(std::move(parent_)),
+      scheduler(scheduler_),
       id(std::move(id_)),
       obsolete(obsolete_),
       mode(mode_),
@@ -285,21 +295,93 @@ void GeometryTileWorker::redoLayout() {
     std::vector<std::unique_ptr<RenderLayer>> renderLayers = toRenderLayers(*layers, id.overscaledZ);
     std::vector<std::vector<const RenderLayer*>> groups = groupByLayout(renderLayers);
 
+    // Source layers decoded so far, shared by all groups that use them. A null entry marks a
+    // source layer that doesn't exist in this tile.
+    std::unordered_map<std::string, std::shared_ptr<const DecodedGeometryTileLayer>> decodedLayers;
+
+    // Output of laying out a single group. Groups are laid out concurrently, each writing only
+    // to its own result, and the results are merged in group order afterwards so that the
+    // outcome doesn't depend on scheduling.
+    struct GroupLayout {
+        const std::vector<const RenderLayer*>* group;
+        std::shared_ptr<const DecodedGeometryTileLayer> geometryLayer;
+        std::unique_ptr<SymbolLayout> symbolLayout;
+        std::shared_ptr<Bucket> bucket;
+        std::vector<std::size_t> indexedFeatures;
+        GlyphDependencies glyphDependencies;
+        ImageDependencies imageDependencies;
+    };
+
+    std::vector<GroupLayout> groupLayouts;
+    groupLayouts.reserve(groups.size());
+
+    // Decoding source layers isn't thread-safe, so it happens up front.
     for (auto& group : groups) {
-        if (obsolete) {
-            return;
+        if (!*data) {
+            break; // Tile has no data.
         }
 
-        if (!*data) {
-            continue; // Tile has no data.
+        const std::string& sourceLayerID = group.at(0)->baseImpl->sourceLayer;
+
+        auto decodedIt = decodedLayers.find(sourceLayerID);
+        if (decodedIt == decodedLayers.end()) {
+            auto geometryLayer = (*data)->getLayer(sourceLayerID);
+            decodedIt = decodedLayers.emplace(sourceLayerID, geometryLayer
+                ? std::make_shared<const DecodedGeometryTileLayer>(std::move(geometryLayer))
+                : nullptr).first;
+        }
+
+        if (decodedIt->second) {
+            groupLayouts.push_back({ &group, decodedIt->second, nullptr, nullptr, {}, {}, {} });
+        }
+    }
+
+    const auto layoutGroup = [&] (std::size_t g) {
+        if (obsolete) {
+            return;
         }
 
+        GroupLayout& result = groupLayouts[g];
+        const std::vector<const RenderLayer*>& group = *result.group;
         const RenderLayer& leader = *group.at(0);
+        const DecodedGeometryTileLayer& geometryLayer = *result.geometryLayer;
 
-        auto geometryLayer = (*data)->getLayer(leader.baseImpl->sourceLayer);
-        if (!geometryLayer) {
-            continue;
+        if (leader.is<RenderSymbolLayer>()) {
+            result.symbolLayout = leader.as<RenderSymbolLayer>()->createLayout(
+                parameters, group, DecodedGeometryTileLayer::view(result.geometryLayer),
+                result.glyphDependencies, result.imageDependencies);
+        } else {
+            const Filter& filter = leader.baseImpl->filter;
+            result.bucket = leader.createBucket(parameters, group);
+
+            for (std::size_t i = 0; !obsolete && i < geometryLayer.featureCount(); i++) {
+                const GeometryTileFeature& feature = geometryLayer.getFeature(i);
+
+                if (!filter(geometryLayer.getType(i), geometryLayer.getID(i), [&] (const auto& key) { return feature.getValue(key); }))
+                    continue;
+
+                result.bucket->addFeature(feature, geometryLayer.getGeometries(i));
+                result.indexedFeatures.push_back(i);
+            }
+        }
+    };
+
+    // Most tiles have only a few groups, which aren't worth handing to other threads.
+    if (groupLayouts.size() < minimumParallelGroupCount) {
+        for (std::size_t g = 0; g < groupLayouts.size(); g++) {
+            layoutGroup(g);
         }
+    } else {
+        parallelFor(scheduler, groupLayouts.size(), layoutGroup);
+    }
+
+    if (obsolete) {
+        return;
+    }
+
+    for (auto& result : groupLayouts) {
+        const std::vector<const RenderLayer*>& group = *result.group;
+        const RenderLayer& leader = *group.at(0);
 
         std::vector<std::string> layerIDs;
         for (const auto& layer : group) {
@@ -308,33 +390,27 @@ void GeometryTileWorker::redoLayout() {
 
         featureIndex->setBucketLayerIDs(leader.getID(), layerIDs);
 
-        if (leader.is<RenderSymbolLayer>()) {
-            auto layout = leader.as<RenderSymbolLayer>()->createLayout(
-                parameters, group, std::move(geometryLayer), glyphDependencies, imageDependencies);
-            symbolLayoutMap.emplace(leader.getID(), std::move(layout));
+        if (result.symbolLayout) {
+            for (const auto& fontDependencies : result.glyphDependencies) {
+                glyphDependencies[fontDependencies.first].insert(fontDependencies.second.begin(),
+                                                                 fontDependencies.second.end());
+            }
+            imageDependencies.insert(result.imageDependencies.begin(), result.imageDependencies.end());
+
+            symbolLayoutMap.emplace(leader.getID(), std::move(result.symbolLayout));
             symbolLayoutsNeedPreparation = true;
         } else {
-            const Filter& filter = leader.baseImpl->filter;
             const std::string& sourceLayerID = leader.baseImpl->sourceLayer;
-            std::shared_ptr<Bucket> bucket = leader.createBucket(parameters, group);
-
-            for (std::size_t i = 0; !obsolete && i < geometryLayer->featureCount(); i++) {
-                std::unique_ptr<GeometryTileFeature> feature = geometryLayer->getFeature(i);
-
-                if (!filter(feature->getType(), feature->getID(), [&] (const auto& key) { return feature->getValue(key); }))
-                    continue;
-
-                GeometryCollection geometries = feature->getGeometries();
-                bucket->addFeature(*feature, geometries);
-                featureIndex->insert(geometries, i, sourceLayerID, leader.getID());
+            for (std::size_t i : result.indexedFeatures) {
+                featureIndex->insert(result.geometryLayer->getGeometries(i), i, sourceLayerID, leader.getID());
             }
 
-            if (!bucket->hasData()) {
+            if (!result.bucket->hasData()) {
                 continue;
             }
 
             for (const auto& layer : group) {
-                buckets.emplace(layer->getID(), bucket);
+                buckets.emplace(layer->getID(), result.bucket);
             }
         }
     }
@@ -17,6 +17,7 @@ namespace mbgl {
 
 class GeometryTile;
 class GeometryTileData;
+class Scheduler;
 class SymbolLayout;
 
 namespace style {
@@ -27,6 +28,7 @@ class GeometryTileWorker {
 public:
     GeometryTileWorker(ActorRef<GeometryTileWorker> self,
                        ActorRef<GeometryTile> parent,
+                       Scheduler&,
                        OverscaledTileID,
                        const std::atomic<bool>&,
                        const MapMode,
@@ -56,6 +58,9 @@ private:
     ActorRef<GeometryTileWorker> self;
     ActorRef<GeometryTile> parent;
 
+    // Used to lay out the bucket groups of a tile in parallel.
+    Scheduler& scheduler;
+
     const OverscaledTileID id;
     const std::atomic<bool>& obsolete;
     const MapMode mode;
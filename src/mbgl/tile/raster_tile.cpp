@@ -19,7 +19,8 @@ RasterTile::RasterTile(const OverscaledTileID& id_,
       loader(*this, id_, parameters, tileset),
       mailbox(std::make_shared<Mailbox>(*util::RunLoop::Get())),
       worker(parameters.workerScheduler,
-             ActorRef<RasterTile>(*this, mailbox)) {
+             ActorRef<RasterTile>(*this, mailbox),
+             parameters.rasterTextureFormat) {
 }
 
 RasterTile::~RasterTile() = default;
@@ -69,4 +70,8 @@ void RasterTile::setNecessity(Necessity necessity) {
     loader.setNecessity(necessity);
 }
 
+void RasterTile::setPriority(Priority priority) {
+    loader.setPriority(priority);
+}
+
 } // namespace mbgl
@@ -22,6 +22,7 @@ public:
     ~RasterTile() final;
 
     void setNecessity(Necessity) final;
+    void setPriority(Priority) final;
 
     void setError(std::exception_ptr);
     void setData(std::shared_ptr<const std::string> data,
@@ -2,12 +2,36 @@
 #include <mbgl/tile/raster_tile.hpp>
 #include <mbgl/renderer/buckets/raster_bucket.hpp>
 #include <mbgl/actor/actor.hpp>
+#include <mbgl/util/image_buffer_pool.hpp>
 #include <mbgl/util/premultiply.hpp>
 
+#include <mutex>
+
 namespace mbgl {
 
-RasterTileWorker::RasterTileWorker(ActorRef<RasterTileWorker>, ActorRef<RasterTile> parent_)
-    : parent(std::move(parent_)) {
+namespace {
+
+// Raster tiles of all sources share one pool, which lives as long as a worker or a decoded image
+// refers to it.
+std::shared_ptr<ImageBufferPool> sharedImageBufferPool() {
+    static std::mutex mutex;
+    static std::weak_ptr<ImageBufferPool> weak;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto pool = weak.lock();
+    if (!pool) {
+        weak = pool = std::make_shared<ImageBufferPool>();
+    }
+    return pool;
+}
+
+} // namespace
+
+RasterTileWorker::RasterTileWorker(ActorRef<RasterTileWorker>, ActorRef<RasterTile> parent_,
+                                   RasterTextureFormat textureFormat_)
+    : parent(std::move(parent_)),
+      pool(sharedImageBufferPool()),
+      textureFormat(textureFormat_) {
 }
 
 void RasterTileWorker::parse(std::shared_ptr<const std::string> data) {
@@ -17,7 +41,15 @@ void RasterTileWorker::parse(std::shared_ptr<const std::string> data) {
     }
 
     try {
-        auto bucket = std::make_unique<RasterBucket>(decodeImage(*data));
+        // The pixels go back to the pool once the bucket and any other users of the image are gone.
+        std::shared_ptr<PremultipliedImage> image(
+            new PremultipliedImage(decodeImage(*data, *pool)),
+            [pool_ = pool] (PremultipliedImage* released) {
+                pool_->release(std::move(released->data), released->bytes());
+                delete released;
+            });
+        auto bucket = std::make_unique<RasterBucket>(std::move(image));
+        bucket->encode(textureFormat);
         parent.invoke(&RasterTile::onParsed, std::move(bucket));
     } catch (...) {
         parent.invoke(&RasterTile::onError, std::current_exception());
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <mbgl/actor/actor_ref.hpp>
+#include <mbgl/map/mode.hpp>
 
 #include <memory>
 #include <string>
@@ -8,15 +9,18 @@
 namespace mbgl {
 
 class RasterTile;
+class ImageBufferPool;
 
 class RasterTileWorker {
 public:
-    RasterTileWorker(ActorRef<RasterTileWorker>, ActorRef<RasterTile>);
+    RasterTileWorker(ActorRef<RasterTileWorker>, ActorRef<RasterTile>, RasterTextureFormat);
 
     void parse(std::shared_ptr<const std::string> data);
 
 private:
     ActorRef<RasterTile> parent;
+    std::shared_ptr<ImageBufferPool> pool;
+    const RasterTextureFormat textureFormat;
 };
 
 } // namespace mbgl
@@ -5,11 +5,14 @@
 #include <mbgl/util/string.hpp>
 #include <mbgl/util/logging.hpp>
 
+#include <atomic>
+
 namespace mbgl {
 
 static TileObserver nullObserver;
+static std::atomic<uint64_t> nextGeneration { 0 };
 
-Tile::Tile(OverscaledTileID id_) : id(std::move(id_)), observer(&nullObserver) {
+Tile::Tile(OverscaledTileID id_) : id(std::move(id_)), generation(nextGeneration++), observer(&nullObserver) {
 }
 
 Tile::~Tile() = default;
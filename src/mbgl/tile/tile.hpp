@@ -11,6 +11,7 @@
 #include <mbgl/storage/resource.hpp>
 #include <mbgl/style/layer_impl.hpp>
 
+#include <cstdint>
 #include <string>
 #include <memory>
 #include <functional>
@@ -46,6 +47,12 @@ public:
 
     virtual void setNecessity(Necessity) = 0;
 
+    // Tiles that are visible have regular priority; tiles that are only retained for
+    // prefetching have low priority, so their network requests are queued behind others.
+    using Priority = Resource::Priority;
+
+    virtual void setPriority(Priority) {}
+
     // Mark this tile as no longer needed and cancel any pending work.
     virtual void cancel() = 0;
 
@@ -100,6 +107,10 @@ public:
     void dumpDebugLogs() const;
 
     const OverscaledTileID id;
+
+    // Unique among all tiles ever created, unlike the address of a tile, which may be reused.
+    const uint64_t generation;
+
     optional<Timestamp> modified;
     optional<Timestamp> expires;
 
@@ -1,13 +1,13 @@
 #pragma once
 
 #include <mbgl/util/noncopyable.hpp>
+#include <mbgl/util/async_request.hpp>
 #include <mbgl/storage/resource.hpp>
 #include <mbgl/tile/tile.hpp>
 
 namespace mbgl {
 
 class FileSource;
-class AsyncRequest;
 class Response;
 class Tileset;
 class TileParameters;
@@ -34,6 +34,15 @@ public:
         }
     }
 
+    void setPriority(Resource::Priority newPriority) {
+        if (newPriority != resource.priority) {
+            resource.priority = newPriority;
+            if (request) {
+                request->setPriority(newPriority);
+            }
+        }
+    }
+
 private:
     // called when the tile is one of the ideal tiles that we want to show definitely. the tile source
     // should try to make every effort (e.g. fetch from internet, or revalidate existing resources).
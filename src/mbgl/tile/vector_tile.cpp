@@ -16,6 +16,10 @@ void VectorTile::setNecessity(Necessity necessity) {
     loader.setNecessity(necessity);
 }
 
+void VectorTile::setPriority(Priority priority) {
+    loader.setPriority(priority);
+}
+
 void VectorTile::setData(std::shared_ptr<const std::string> data_,
                          optional<Timestamp> modified_,
                          optional<Timestamp> expires_) {
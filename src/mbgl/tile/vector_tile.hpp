@@ -16,6 +16,7 @@ public:
                const Tileset&);
 
     void setNecessity(Necessity) final;
+    void setPriority(Priority) final;
     void setData(std::shared_ptr<const std::string> data,
                  optional<Timestamp> modified,
                  optional<Timestamp> expires);
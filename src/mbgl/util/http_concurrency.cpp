@@ -0,0 +1,59 @@
+#include <mbgl/util/http_concurrency.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace mbgl {
+namespace http {
+
+ConcurrencyLimit::ConcurrencyLimit(uint32_t minimum_, uint32_t initial, uint32_t maximum_)
+    : minimum(std::max(minimum_, 1u)),
+      maximum(std::max(maximum_, minimum)),
+      limit(std::min(std::max(initial, minimum), maximum)) {
+}
+
+uint32_t ConcurrencyLimit::get() const {
+    return static_cast<uint32_t>(std::floor(limit));
+}
+
+void ConcurrencyLimit::setMaximum(uint32_t maximum_) {
+    maximum = std::max(maximum_, minimum);
+    limit = std::min(limit, double(maximum));
+}
+
+void ConcurrencyLimit::completed(Duration latency, Response::Error::Reason reason) {
+    using Reason = Response::Error::Reason;
+
+    bool congested = reason == Reason::Connection || reason == Reason::Server || reason == Reason::RateLimit;
+
+    if (!congested && reason == Reason::Success) {
+        if (!smoothedLatency) {
+            smoothedLatency = latency;
+            latencyDeviation = latency / 2;
+        } else {
+            // Don't treat jitter on very fast links as congestion.
+            const Duration threshold = *smoothedLatency + std::max<Duration>(latencyDeviation * 4, Milliseconds(100));
+            congested = latency > threshold;
+
+            const Duration error = latency - *smoothedLatency;
+            *smoothedLatency += error / 8;
+            latencyDeviation += ((error < Duration::zero() ? -error : error) - latencyDeviation) / 4;
+        }
+    }
+
+    if (holdoff > 0) {
+        holdoff--;
+    }
+
+    if (congested) {
+        if (holdoff == 0) {
+            limit = std::max(limit * 0.75, double(minimum));
+            holdoff = get();
+        }
+    } else {
+        limit = std::min(limit + 1.0 / limit, double(maximum));
+    }
+}
+
+} // namespace http
+} // namespace mbgl
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <mbgl/storage/response.hpp>
+#include <mbgl/util/optional.hpp>
+#include <mbgl/util/chrono.hpp>
+
+#include <cstdint>
+
+namespace mbgl {
+namespace http {
+
+// Adapts the number of concurrent requests to observed latency and error rate, similar to TCP
+// congestion control: the limit grows by one for every window of fast, successful responses and
+// is cut by a quarter, at most once per window, when a request fails with a connection, server or
+// rate limit error, or when a response takes far longer than the smoothed latency of recent ones.
+class ConcurrencyLimit {
+public:
+    ConcurrencyLimit(uint32_t minimum, uint32_t initial, uint32_t maximum);
+
+    uint32_t get() const;
+
+    // Changes the upper bound; the current limit is clamped, but not raised.
+    void setMaximum(uint32_t);
+    uint32_t getMaximum() const { return maximum; }
+
+    void completed(Duration latency, Response::Error::Reason);
+
+private:
+    const uint32_t minimum;
+    uint32_t maximum;
+    double limit;
+
+    // Smoothed latency of successful responses and its mean deviation, estimated like TCP
+    // estimates round trip times. Responses are only counted as congested when they are slower
+    // than the usual spread allows, so that occasional large responses don't lower the limit.
+    optional<Duration> smoothedLatency;
+    Duration latencyDeviation = Duration::zero();
+
+    // Number of responses to wait for before the limit may be decreased again. Responses to
+    // requests that were started before a decrease shouldn't trigger another one.
+    uint32_t holdoff = 0;
+};
+
+} // namespace http
+} // namespace mbgl
@@ -0,0 +1,47 @@
+#include <mbgl/util/image_buffer_pool.hpp>
+
+namespace mbgl {
+
+ImageBufferPool::ImageBufferPool(std::size_t maxBytes_)
+    : maxBytes(maxBytes_) {
+}
+
+std::unique_ptr<uint8_t[]> ImageBufferPool::acquire(std::size_t bytes) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = buffers.find(bytes);
+        if (it != buffers.end() && !it->second.empty()) {
+            auto buffer = std::move(it->second.back());
+            it->second.pop_back();
+            count--;
+            total -= bytes;
+            return buffer;
+        }
+    }
+    // Decoders overwrite every byte, so the new buffer is left uninitialized.
+    return std::unique_ptr<uint8_t[]>(new uint8_t[bytes]);
+}
+
+void ImageBufferPool::release(std::unique_ptr<uint8_t[]> buffer, std::size_t bytes) {
+    if (!buffer || bytes == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    if (bytes <= maxBytes - total) {
+        buffers[bytes].push_back(std::move(buffer));
+        count++;
+        total += bytes;
+    }
+}
+
+std::size_t ImageBufferPool::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return count;
+}
+
+std::size_t ImageBufferPool::bytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return total;
+}
+
+} // namespace mbgl
@@ -1,4 +1,5 @@
 #include <mbgl/gl/context.hpp>
+#include <mbgl/gl/framebuffer_readback.hpp>
 #include <mbgl/util/offscreen_texture.hpp>
 
 #include <cassert>
@@ -41,6 +42,19 @@ public:
         return context.readFramebuffer<PremultipliedImage>(size);
     }
 
+    std::future<PremultipliedImage> readStillImageAsync() {
+        if (!readback) {
+            readback.emplace(context, size);
+        }
+        return readback->read();
+    }
+
+    void finishReads() {
+        if (readback) {
+            readback->finish();
+        }
+    }
+
     gl::Texture& getTexture() {
         assert(texture);
         return *texture;
@@ -56,6 +70,7 @@ private:
     OffscreenTextureAttachment type;
     optional<gl::Framebuffer> framebuffer;
     optional<gl::Texture> texture;
+    optional<gl::FramebufferReadback> readback;
 };
 
 OffscreenTexture::OffscreenTexture(gl::Context& context,
@@ -75,6 +90,14 @@ PremultipliedImage OffscreenTexture::readStillImage() {
     return impl->readStillImage();
 }
 
+std::future<PremultipliedImage> OffscreenTexture::readStillImageAsync() {
+    return impl->readStillImageAsync();
+}
+
+void OffscreenTexture::finishReads() {
+    impl->finishReads();
+}
+
 gl::Texture& OffscreenTexture::getTexture() {
     return impl->getTexture();
 }
@@ -1,10 +1,164 @@
 #include <mbgl/util/premultiply.hpp>
 
-#include <cmath>
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
 
 namespace mbgl {
 namespace util {
 
+namespace {
+
+// Divides 0 <= v <= 65152, which covers 255 * 255 + 127, by 255 without a division.
+inline uint32_t divide255(uint32_t v) {
+    return (v + 1 + (v >> 8)) >> 8;
+}
+
+inline void premultiplyPixel(uint8_t* pixel) {
+    const uint32_t a = pixel[3];
+    pixel[0] = divide255(pixel[0] * a + 127);
+    pixel[1] = divide255(pixel[1] * a + 127);
+    pixel[2] = divide255(pixel[2] * a + 127);
+}
+
+// Fixed-point reciprocals ceil(2^24 / a), which turn the division of any 16-bit numerator by an
+// 8-bit alpha into an exact multiplication and shift.
+const std::array<uint32_t, 256>& reciprocals() {
+    static const std::array<uint32_t, 256> table = [] {
+        std::array<uint32_t, 256> result {{ 0 }};
+        for (uint32_t a = 1; a < 256; a++) {
+            result[a] = ((uint32_t(1) << 24) + a - 1) / a;
+        }
+        return result;
+    }();
+    return table;
+}
+
+inline void unpremultiplyPixel(uint8_t* pixel, const std::array<uint32_t, 256>& table) {
+    const uint32_t a = pixel[3];
+    // Fully transparent and fully opaque pixels are left unchanged by the formula below.
+    if (a == 0 || a == 255) {
+        return;
+    }
+    const uint64_t reciprocal = table[a];
+    const uint32_t half = a / 2;
+    // Results above 255 wrap around, as they always have when stored to a byte.
+    pixel[0] = uint8_t(((255 * pixel[0] + half) * reciprocal) >> 24);
+    pixel[1] = uint8_t(((255 * pixel[1] + half) * reciprocal) >> 24);
+    pixel[2] = uint8_t(((255 * pixel[2] + half) * reciprocal) >> 24);
+}
+
+#if defined(__SSE2__)
+
+// Premultiplies two pixels widened to 16-bit channels. The alpha channel is multiplied by 255,
+// which leaves it unchanged.
+inline __m128i premultiplyWide(const __m128i pixels) {
+    const __m128i alphaLanes = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+    __m128i alpha = _mm_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm_or_si128(_mm_andnot_si128(alphaLanes, alpha), _mm_and_si128(alphaLanes, _mm_set1_epi16(255)));
+
+    const __m128i v = _mm_add_epi16(_mm_mullo_epi16(pixels, alpha), _mm_set1_epi16(127));
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(v, _mm_set1_epi16(1)), _mm_srli_epi16(v, 8)), 8);
+}
+
+inline bool opaque(const __m128i pixels) {
+    const __m128i alphaBytes = _mm_set1_epi32(int32_t(0xFF000000));
+    return _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(pixels, alphaBytes), alphaBytes)) == 0xFFFF;
+}
+
+inline bool transparent(const __m128i pixels) {
+    const __m128i alphaBytes = _mm_set1_epi32(int32_t(0xFF000000));
+    return _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(pixels, alphaBytes), _mm_setzero_si128())) == 0xFFFF;
+}
+
+#endif
+
+} // namespace
+
+void premultiply(uint8_t* pixels, std::size_t count) {
+    std::size_t i = 0;
+
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 4 <= count; i += 4) {
+        __m128i* block = reinterpret_cast<__m128i*>(pixels + i * 4);
+        const __m128i v = _mm_loadu_si128(block);
+        if (opaque(v)) {
+            continue;
+        }
+        const __m128i lo = premultiplyWide(_mm_unpacklo_epi8(v, zero));
+        const __m128i hi = premultiplyWide(_mm_unpackhi_epi8(v, zero));
+        _mm_storeu_si128(block, _mm_packus_epi16(lo, hi));
+    }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    const uint16x8_t bias = vdupq_n_u16(127 + 1);
+    for (; i + 8 <= count; i += 8) {
+        uint8_t* block = pixels + i * 4;
+        uint8x8x4_t v = vld4_u8(block);
+        for (int c = 0; c < 3; c++) {
+            // (x + 127 + 1 + ((x + 127) >> 8)) >> 8, which is (x + 127) / 255.
+            const uint16x8_t x = vmull_u8(v.val[c], v.val[3]);
+            const uint16x8_t t = vaddq_u16(x, vdupq_n_u16(127));
+            v.val[c] = vshrn_n_u16(vaddq_u16(vaddq_u16(x, bias), vshrq_n_u16(t, 8)), 8);
+        }
+        vst4_u8(block, v);
+    }
+#endif
+
+    for (; i < count; i++) {
+        premultiplyPixel(pixels + i * 4);
+    }
+}
+
+void unpremultiply(uint8_t* pixels, std::size_t count) {
+    const auto& table = reciprocals();
+    std::size_t i = 0;
+
+#if defined(__SSE2__)
+    // Rendered images mostly consist of opaque or cleared areas, which are skipped four pixels at
+    // a time. There is no SIMD integer division, so the remaining pixels use the reciprocals.
+    for (; i + 4 <= count; i += 4) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + i * 4));
+        if (opaque(v) || transparent(v)) {
+            continue;
+        }
+        for (std::size_t j = i; j < i + 4; j++) {
+            unpremultiplyPixel(pixels + j * 4, table);
+        }
+    }
+#endif
+
+    for (; i < count; i++) {
+        unpremultiplyPixel(pixels + i * 4, table);
+    }
+}
+
+void flipRows(uint8_t* data, std::size_t stride, std::size_t height) {
+    if (height < 2) {
+        return;
+    }
+    // Rows are exchanged through a small stack buffer that stays in the L1 cache, rather than a
+    // heap-allocated temporary row.
+    uint8_t buffer[4096];
+    for (std::size_t i = 0, j = height - 1; i < j; i++, j--) {
+        uint8_t* top = data + i * stride;
+        uint8_t* bottom = data + j * stride;
+        for (std::size_t offset = 0; offset < stride; offset += sizeof(buffer)) {
+            const std::size_t length = std::min(sizeof(buffer), stride - offset);
+            std::memcpy(buffer, top + offset, length);
+            std::memcpy(top + offset, bottom + offset, length);
+            std::memcpy(bottom + offset, buffer, length);
+        }
+    }
+}
+
 PremultipliedImage premultiply(UnassociatedImage&& src) {
     PremultipliedImage dst;
 
@@ -12,16 +166,7 @@ PremultipliedImage premultiply(UnassociatedImage&& src) {
     src.size = { 0, 0 };
     dst.data = std::move(src.data);
 
-    uint8_t* data = dst.data.get();
-    for (size_t i = 0; i < dst.bytes(); i += 4) {
-        uint8_t& r = data[i + 0];
-        uint8_t& g = data[i + 1];
-        uint8_t& b = data[i + 2];
-        uint8_t& a = data[i + 3];
-        r = (r * a + 127) / 255;
-        g = (g * a + 127) / 255;
-        b = (b * a + 127) / 255;
-    }
+    premultiply(dst.data.get(), dst.size.area());
 
     return dst;
 }
@@ -33,18 +178,7 @@ UnassociatedImage unpremultiply(PremultipliedImage&& src) {
     src.size = { 0, 0 };
     dst.data = std::move(src.data);
 
-    uint8_t* data = dst.data.get();
-    for (size_t i = 0; i < dst.bytes(); i += 4) {
-        uint8_t& r = data[i + 0];
-        uint8_t& g = data[i + 1];
-        uint8_t& b = data[i + 2];
-        uint8_t& a = data[i + 3];
-        if (a) {
-            r = (255 * r + (a / 2)) / a;
-            g = (255 * g + (a / 2)) / a;
-            b = (255 * b + (a / 2)) / a;
-        }
-    }
+    unpremultiply(dst.data.get(), dst.size.area());
 
     return dst;
 }
@@ -0,0 +1,139 @@
+#include <mbgl/util/texture_compression.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace mbgl {
+namespace util {
+
+namespace {
+
+inline uint16_t pack565(uint32_t r, uint32_t g, uint32_t b) {
+    return uint16_t((((r * 31 + 127) / 255) << 11) | (((g * 63 + 127) / 255) << 5) | ((b * 31 + 127) / 255));
+}
+
+inline std::array<uint32_t, 3> unpack565(uint16_t color) {
+    const uint32_t r = (color >> 11) & 0x1F;
+    const uint32_t g = (color >> 5) & 0x3F;
+    const uint32_t b = color & 0x1F;
+    return {{ (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2) }};
+}
+
+inline void appendUInt16(std::vector<uint8_t>& out, uint16_t value) {
+    out.push_back(uint8_t(value));
+    out.push_back(uint8_t(value >> 8));
+}
+
+// Compresses one block of 16 RGBA pixels. The endpoints are the corners of the block's color
+// bounding box, inset by 1/16th of its extent to reduce the error of the interpolated colors.
+void compressBlock(const uint8_t (&block)[16][4], std::vector<uint8_t>& out) {
+    uint32_t min[3] = { 255, 255, 255 };
+    uint32_t max[3] = { 0, 0, 0 };
+    for (const auto& pixel : block) {
+        for (int c = 0; c < 3; c++) {
+            min[c] = std::min<uint32_t>(min[c], pixel[c]);
+            max[c] = std::max<uint32_t>(max[c], pixel[c]);
+        }
+    }
+    for (int c = 0; c < 3; c++) {
+        const uint32_t inset = (max[c] - min[c]) >> 4;
+        min[c] += inset;
+        max[c] -= inset;
+    }
+
+    uint16_t color0 = pack565(max[0], max[1], max[2]);
+    uint16_t color1 = pack565(min[0], min[1], min[2]);
+    if (color0 < color1) {
+        std::swap(color0, color1);
+    }
+
+    uint32_t indices = 0;
+    if (color0 != color1) {
+        // With color0 > color1, the two remaining palette entries lie at 1/3 and 2/3 between them.
+        const auto c0 = unpack565(color0);
+        const auto c1 = unpack565(color1);
+        std::array<std::array<uint32_t, 3>, 4> palette;
+        palette[0] = c0;
+        palette[1] = c1;
+        for (int c = 0; c < 3; c++) {
+            palette[2][c] = (2 * c0[c] + c1[c]) / 3;
+            palette[3][c] = (c0[c] + 2 * c1[c]) / 3;
+        }
+
+        for (uint32_t i = 0; i < 16; i++) {
+            uint32_t best = 0;
+            int32_t bestDistance = INT32_MAX;
+            for (uint32_t p = 0; p < 4; p++) {
+                int32_t distance = 0;
+                for (int c = 0; c < 3; c++) {
+                    const int32_t d = int32_t(block[i][c]) - int32_t(palette[p][c]);
+                    distance += d * d;
+                }
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    best = p;
+                }
+            }
+            indices |= best << (2 * i);
+        }
+    }
+
+    appendUInt16(out, color0);
+    appendUInt16(out, color1);
+    appendUInt16(out, uint16_t(indices));
+    appendUInt16(out, uint16_t(indices >> 16));
+}
+
+} // namespace
+
+bool isOpaque(const PremultipliedImage& image) {
+    const uint8_t* data = image.data.get();
+    for (std::size_t i = 3; i < image.bytes(); i += 4) {
+        if (data[i] != 255) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<uint8_t> encodeRGB565(const PremultipliedImage& image) {
+    std::vector<uint8_t> result(image.size.area() * 2);
+    const uint8_t* data = image.data.get();
+    for (std::size_t i = 0; i < result.size(); i += 2, data += 4) {
+        const uint16_t pixel = pack565(data[0], data[1], data[2]);
+        std::memcpy(&result[i], &pixel, 2);
+    }
+    return result;
+}
+
+std::vector<uint8_t> encodeDXT1(const PremultipliedImage& image) {
+    const uint32_t width = image.size.width;
+    const uint32_t height = image.size.height;
+    const uint32_t blocksX = (width + 3) / 4;
+    const uint32_t blocksY = (height + 3) / 4;
+
+    std::vector<uint8_t> result;
+    if (width == 0 || height == 0) {
+        return result;
+    }
+    result.reserve(std::size_t(blocksX) * blocksY * 8);
+
+    uint8_t block[16][4];
+    for (uint32_t by = 0; by < blocksY; by++) {
+        for (uint32_t bx = 0; bx < blocksX; bx++) {
+            for (uint32_t y = 0; y < 4; y++) {
+                const uint32_t sy = std::min(by * 4 + y, height - 1);
+                for (uint32_t x = 0; x < 4; x++) {
+                    const uint32_t sx = std::min(bx * 4 + x, width - 1);
+                    std::memcpy(block[y * 4 + x], image.data.get() + (std::size_t(sy) * width + sx) * 4, 4);
+                }
+            }
+            compressBlock(block, result);
+        }
+    }
+    return result;
+}
+
+} // namespace util
+} // namespace mbgl
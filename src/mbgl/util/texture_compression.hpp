@@ -0,0 +1,24 @@
+#pragma once
+
+#include <mbgl/util/image.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace mbgl {
+namespace util {
+
+// Returns true if every pixel of the image is fully opaque.
+bool isOpaque(const PremultipliedImage&);
+
+// Packs the color channels into 16-bit RGB565 pixels in native byte order, as expected by
+// GL_UNSIGNED_SHORT_5_6_5. Alpha is dropped.
+std::vector<uint8_t> encodeRGB565(const PremultipliedImage&);
+
+// Compresses the color channels into DXT1 (BC1) blocks of 4x4 pixels, 8 bytes each. Blocks on
+// the right and bottom edges of images whose size isn't a multiple of 4 repeat the last pixels.
+// Alpha is dropped.
+std::vector<uint8_t> encodeDXT1(const PremultipliedImage&);
+
+} // namespace util
+} // namespace mbgl
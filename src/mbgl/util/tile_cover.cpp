@@ -1,9 +1,15 @@
 #include <mbgl/util/tile_cover.hpp>
 #include <mbgl/util/constants.hpp>
 #include <mbgl/util/interpolate.hpp>
+#include <mbgl/util/mat4.hpp>
 #include <mbgl/map/transform_state.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
+#include <map>
+#include <set>
+#include <tuple>
 
 namespace mbgl {
 
@@ -155,6 +161,61 @@ std::vector<UnwrappedTileID> tileCover(const LatLngBounds& bounds_, int32_t z) {
         z);
 }
 
+TileCover::TileCover(const LatLngBounds& bounds_, int32_t z_) : z(z_) {
+    if (bounds_.isEmpty() ||
+        bounds_.south() >  util::LATITUDE_MAX ||
+        bounds_.north() < -util::LATITUDE_MAX) {
+        return;
+    }
+
+    LatLngBounds bounds = LatLngBounds::hull(
+        { std::max(bounds_.south(), -util::LATITUDE_MAX), bounds_.west() },
+        { std::min(bounds_.north(),  util::LATITUDE_MAX), bounds_.east() });
+
+    const Point<double> nw = TileCoordinate::fromLatLng(z, bounds.northwest()).p;
+    const Point<double> se = TileCoordinate::fromLatLng(z, bounds.southeast()).p;
+
+    // Matches the scan line conversion above: a zero-height box doesn't cover any tiles, and
+    // rows are clamped to the world while columns are left unwrapped.
+    if (nw.y == se.y) {
+        return;
+    }
+
+    const int32_t tiles = 1 << z;
+    x0 = std::floor(nw.x);
+    x1 = std::ceil(se.x);
+    y0 = ::fmax(0, std::floor(nw.y));
+    y1 = ::fmin(tiles, std::ceil(se.y));
+
+    if (x0 >= x1 || y0 >= y1) {
+        x0 = x1 = y0 = y1 = 0;
+    }
+
+    x = x0;
+    y = y0;
+}
+
+optional<UnwrappedTileID> TileCover::next() {
+    if (!hasNext()) {
+        return {};
+    }
+
+    UnwrappedTileID result { static_cast<uint8_t>(z), x, y };
+    if (++x == x1) {
+        x = x0;
+        ++y;
+    }
+    return result;
+}
+
+bool TileCover::hasNext() const {
+    return y < y1;
+}
+
+uint64_t TileCover::count() const {
+    return uint64_t(x1 - x0) * uint64_t(y1 - y0);
+}
+
 std::vector<UnwrappedTileID> tileCover(const TransformState& state, int32_t z) {
     assert(state.valid());
 
@@ -169,5 +230,69 @@ std::vector<UnwrappedTileID> tileCover(const TransformState& state, int32_t z) {
         z);
 }
 
+std::vector<UnwrappedTileID> tileCover(const TransformState& state, int32_t z, int32_t minZ) {
+    std::vector<UnwrappedTileID> idealTiles = tileCover(state, z);
+    if (state.getPitch() == 0 || minZ >= z || idealTiles.empty()) {
+        return idealTiles;
+    }
+
+    mat4 projMatrix;
+    state.getProjMatrix(projMatrix);
+    const double centerDistance = state.getCameraToCenterDistance();
+
+    // Tiles are drawn smaller in proportion to their distance from the camera, relative to the
+    // distance of the center of the screen, at which tiles are drawn at their ideal size.
+    auto wantedZoom = [&](const UnwrappedTileID& tileID) {
+        mat4 tileMatrix;
+        state.matrixFor(tileMatrix, tileID);
+        matrix::multiply(tileMatrix, projMatrix, tileMatrix);
+
+        vec4 projected;
+        matrix::transformMat4(projected, vec4 {{ util::EXTENT / 2, util::EXTENT / 2, 0, 1 }}, tileMatrix);
+        const double distance = projected[3];
+
+        if (distance < 2 * centerDistance) {
+            return z;
+        }
+        return std::max(minZ, z - static_cast<int32_t>(std::floor(std::log2(distance / centerDistance))));
+    };
+
+    // Columns are unwrapped so that world copies stay apart.
+    using Key = std::tuple<int32_t, int64_t, int64_t>;
+    auto ancestor = [&](const UnwrappedTileID& tileID, int32_t level) {
+        const int64_t x = tileID.canonical.x + tileID.wrap * (int64_t(1) << z);
+        const int64_t scale = int64_t(1) << (z - level);
+        const int64_t ax = x >= 0 ? x / scale : (x - scale + 1) / scale;
+        return Key { level, ax, tileID.canonical.y / scale };
+    };
+
+    // The finest zoom level wanted by any of the ideal tiles within each ancestor.
+    std::map<Key, int32_t> finest;
+    for (const auto& tileID : idealTiles) {
+        const int32_t wanted = wantedZoom(tileID);
+        for (int32_t level = minZ; level < z; level++) {
+            int32_t& value = finest.emplace(ancestor(tileID, level), minZ).first->second;
+            value = std::max(value, wanted);
+        }
+    }
+
+    // Each ideal tile is replaced by its lowest ancestor whose tiles all accept that zoom level.
+    // All ideal tiles within that ancestor reach the same decision. The order of the ideal tiles,
+    // nearest to the center first, is kept.
+    std::vector<UnwrappedTileID> result;
+    std::set<Key> added;
+    for (const auto& tileID : idealTiles) {
+        int32_t level = minZ;
+        while (level < z && finest[ancestor(tileID, level)] > level) {
+            level++;
+        }
+        const Key key = ancestor(tileID, level);
+        if (added.insert(key).second) {
+            result.emplace_back(level, std::get<1>(key), std::get<2>(key));
+        }
+    }
+    return result;
+}
+
 } // namespace util
 } // namespace mbgl
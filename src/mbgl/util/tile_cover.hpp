@@ -3,6 +3,7 @@
 #include <mbgl/tile/tile_id.hpp>
 #include <mbgl/style/types.hpp>
 #include <mbgl/util/tile_coordinate.hpp>
+#include <mbgl/util/optional.hpp>
 
 #include <vector>
 
@@ -16,7 +17,33 @@ namespace util {
 int32_t coveringZoomLevel(double z, SourceType type, uint16_t tileSize);
 
 std::vector<UnwrappedTileID> tileCover(const TransformState&, int32_t z);
+
+// Covers the same area as tileCover(const TransformState&, int32_t), but in pitched views, tiles
+// that appear at most half as large as tiles at the center of the screen are replaced by their
+// ancestors, down to zoom level minZ. Every point of the area is covered by exactly one tile.
+std::vector<UnwrappedTileID> tileCover(const TransformState&, int32_t z, int32_t minZ);
 std::vector<UnwrappedTileID> tileCover(const LatLngBounds&, int32_t z);
 
+// Lazily enumerates the same set of tiles as tileCover(const LatLngBounds&, int32_t), in row-major
+// order rather than by distance from the center. Memory use is constant regardless of the number
+// of tiles, which makes it suitable for very large regions.
+class TileCover {
+public:
+    TileCover() = default;
+    TileCover(const LatLngBounds&, int32_t z);
+
+    optional<UnwrappedTileID> next();
+    bool hasNext() const;
+
+    // Total number of tiles in the cover, including those that were already returned.
+    uint64_t count() const;
+
+private:
+    int32_t z = 0;
+    int32_t x0 = 0, x1 = 0;
+    int32_t y0 = 0, y1 = 0;
+    int32_t x = 0, y = 0;
+};
+
 } // namespace util
 } // namespace mbgl
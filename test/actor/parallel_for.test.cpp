@@ -0,0 +1,82 @@
+#include <mbgl/actor/parallel_for.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+
+#include <mbgl/test/util.hpp>
+
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace mbgl;
+
+TEST(ParallelFor, Results) {
+    ThreadPool pool { 2 };
+
+    std::vector<std::size_t> results(1000);
+    parallelFor(pool, results.size(), [&] (std::size_t i) {
+        results[i] = i * i;
+    });
+
+    for (std::size_t i = 0; i < results.size(); i++) {
+        EXPECT_EQ(i * i, results[i]);
+    }
+}
+
+TEST(ParallelFor, Nested) {
+    // Calls made from within the pool itself must not deadlock, even when every thread of the
+    // pool is busy waiting for its own calls to complete.
+    ThreadPool pool { 2 };
+
+    std::vector<std::size_t> sums(8);
+    parallelFor(pool, sums.size(), [&] (std::size_t i) {
+        std::vector<std::size_t> values(100);
+        parallelFor(pool, values.size(), [&] (std::size_t j) {
+            values[j] = 1;
+        });
+        for (std::size_t value : values) {
+            sums[i] += value;
+        }
+    });
+
+    for (std::size_t sum : sums) {
+        EXPECT_EQ(100u, sum);
+    }
+}
+
+TEST(ParallelFor, Exception) {
+    ThreadPool pool { 2 };
+
+    std::vector<int> called(10, 0);
+    EXPECT_THROW(parallelFor(pool, called.size(), [&] (std::size_t i) {
+        called[i] = 1;
+        if (i == 3) {
+            throw std::runtime_error("failed");
+        }
+    }), std::runtime_error);
+
+    // All other calls are still made.
+    for (int value : called) {
+        EXPECT_EQ(1, value);
+    }
+}
+
+TEST(ParallelFor, ThreadCount) {
+    // Calls are spread over the calling thread and at most one helper per thread of the pool.
+    for (std::size_t threads : { 0, 1, 2 }) {
+        ThreadPool pool { threads };
+
+        std::mutex mutex;
+        std::set<std::thread::id> used;
+        parallelFor(pool, 1000, [&] (std::size_t) {
+            std::lock_guard<std::mutex> lock(mutex);
+            used.insert(std::this_thread::get_id());
+        });
+
+        EXPECT_LE(used.size(), threads + 1);
+        if (threads == 0) {
+            EXPECT_EQ(1u, used.count(std::this_thread::get_id()));
+        }
+    }
+}
@@ -404,3 +404,98 @@ TEST(GenerateClipIDs, SecondSourceHasParentOfFirstSource) {
               }),
               clipIDs);
 }
+
+TEST(GenerateClipIDs, ReuseUnchangedRenderables) {
+    const auto frame = [](algorithm::ClipIDGenerator& generator, bool changed) {
+        std::vector<Renderable> renderables1{
+            Renderable{ UnwrappedTileID{ 1, 0, 0 }, {} },
+        };
+        std::vector<Renderable> renderables2{
+            Renderable{ UnwrappedTileID{ 0, 0, 0 }, {} },
+            Renderable{ UnwrappedTileID{ 1, 0, 0 }, {}, !changed },
+        };
+        std::vector<Renderable> renderables3{
+            Renderable{ UnwrappedTileID{ 0, 0, 0 }, {} },
+        };
+
+        generator.reset();
+        generator.update<Renderable>({ renderables1.begin(), renderables1.end() });
+        generator.update<Renderable>({ renderables2.begin(), renderables2.end() });
+        generator.update<Renderable>({ renderables3.begin(), renderables3.end() });
+
+        std::vector<Renderable> renderables;
+        for (const auto* list : { &renderables1, &renderables2, &renderables3 }) {
+            for (const auto& renderable : *list) {
+                renderables.push_back(renderable);
+            }
+        }
+        return std::make_pair(renderables, generator.getClipIDs());
+    };
+
+    algorithm::ClipIDGenerator generator;
+    const auto first = frame(generator, false);
+    EXPECT_EQ(first, frame(generator, false));
+    EXPECT_EQ(first, frame(generator, false));
+
+    // Once a source changes, its clip IDs and those of the following sources are generated again.
+    const auto changed = frame(generator, true);
+    algorithm::ClipIDGenerator fresh;
+    EXPECT_EQ(frame(fresh, true), changed);
+    EXPECT_NE(first.second, changed.second);
+    EXPECT_EQ(changed, frame(generator, true));
+    EXPECT_EQ(first, frame(generator, false));
+}
+
+TEST(GenerateClipIDs, ReuseFewerRenderables) {
+    std::vector<Renderable> renderables1{
+        Renderable{ UnwrappedTileID{ 1, 0, 0 }, {} },
+        Renderable{ UnwrappedTileID{ 1, 0, 1 }, {} },
+    };
+    std::vector<Renderable> renderables2{
+        Renderable{ UnwrappedTileID{ 0, 0, 0 }, {} },
+    };
+
+    algorithm::ClipIDGenerator generator;
+    generator.reset();
+    generator.update<Renderable>({ renderables1.begin(), renderables1.end() });
+    generator.update<Renderable>({ renderables2.begin(), renderables2.end() });
+    EXPECT_EQ(3u, generator.getClipIDs().size());
+
+    // The second source went away.
+    generator.reset();
+    generator.update<Renderable>({ renderables1.begin(), renderables1.end() });
+    EXPECT_EQ(decltype(renderables1)({
+                  Renderable{ UnwrappedTileID{ 1, 0, 0 }, ClipID{ "00000011", "00000001" } },
+                  Renderable{ UnwrappedTileID{ 1, 0, 1 }, ClipID{ "00000011", "00000010" } },
+              }),
+              renderables1);
+
+    const auto clipIDs = generator.getClipIDs();
+    EXPECT_EQ(decltype(clipIDs)({
+                  { UnwrappedTileID{ 1, 0, 0 }, ClipID{ "00000011", "00000001" } },
+                  { UnwrappedTileID{ 1, 0, 1 }, ClipID{ "00000011", "00000010" } },
+              }),
+              clipIDs);
+}
+
+TEST(GenerateClipIDs, Overlaps) {
+    std::vector<Renderable> renderables1{
+        Renderable{ UnwrappedTileID{ 1, 0, 0 }, {} },
+        Renderable{ UnwrappedTileID{ 1, 0, 1 }, {} },
+    };
+    std::vector<Renderable> renderables2{
+        Renderable{ UnwrappedTileID{ 0, 0, 0 }, {} },
+    };
+
+    // Tiles of different sources may overlap.
+    algorithm::ClipIDGenerator generator;
+    generator.update<Renderable>({ renderables1.begin(), renderables1.end() });
+    generator.update<Renderable>({ renderables2.begin(), renderables2.end() });
+    EXPECT_FALSE(generator.hasOverlaps());
+
+    renderables2.emplace_back(UnwrappedTileID{ 1, 1, 1 }, ClipID{});
+    generator.reset();
+    generator.update<Renderable>({ renderables1.begin(), renderables1.end() });
+    generator.update<Renderable>({ renderables2.begin(), renderables2.end() });
+    EXPECT_TRUE(generator.hasOverlaps());
+}
@@ -946,6 +946,54 @@ TEST(UpdateRenderables, DoNotAscendMultipleTimesIfNotFound) {
               log);
 }
 
+TEST(UpdateRenderables, ShareParentsBetweenZoomLevels) {
+    ActionLog log;
+    MockSource source;
+    auto getTileData = getTileDataFn(log, source.dataTiles);
+    auto createTileData = createTileDataFn(log, source.dataTiles);
+    auto retainTileData = retainTileDataFn(log);
+    auto renderTile = renderTileFn(log);
+
+    // A pitched view covers the area near the camera with z8 tiles and the area further away
+    // with z7 tiles. Neither is loaded, and both are replaced by the same parent.
+    auto tile_4_0_0_0 = source.createTileData(OverscaledTileID{ 4, 0, { 4, 0, 0 } });
+    tile_4_0_0_0->renderable = true;
+
+    const std::vector<UnwrappedTileID> idealTilesZ8 = { { 8, 0, 0 } };
+    const std::vector<UnwrappedTileID> idealTilesZ7 = { { 7, 1, 0 } };
+
+    std::unordered_set<UnwrappedTileID> checked;
+    algorithm::updateRenderables(getTileData, createTileData, retainTileData, renderTile,
+                                 idealTilesZ8, source.zoomRange, 8, checked);
+    algorithm::updateRenderables(getTileData, createTileData, retainTileData, renderTile,
+                                 idealTilesZ7, source.zoomRange, 7, checked);
+    EXPECT_EQ(ActionLog({
+                  GetTileDataAction{ { 8, 0, { 8, 0, 0 } }, NotFound },    // ideal tile
+                  CreateTileDataAction{ { 8, 0, { 8, 0, 0 } } },           //
+                  RetainTileDataAction{ { 8, 0, { 8, 0, 0 } }, Resource::Necessity::Required }, //
+                  GetTileDataAction{ { 9, 0, { 9, 0, 0 } }, NotFound },    // child tile
+                  GetTileDataAction{ { 9, 0, { 9, 0, 1 } }, NotFound },    // ...
+                  GetTileDataAction{ { 9, 0, { 9, 1, 0 } }, NotFound },    // ...
+                  GetTileDataAction{ { 9, 0, { 9, 1, 1 } }, NotFound },    // ...
+                  GetTileDataAction{ { 7, 0, { 7, 0, 0 } }, NotFound },    // ascent
+                  GetTileDataAction{ { 6, 0, { 6, 0, 0 } }, NotFound },    // ...
+                  GetTileDataAction{ { 5, 0, { 5, 0, 0 } }, NotFound },    // ...
+                  GetTileDataAction{ { 4, 0, { 4, 0, 0 } }, Found },       // stops ascent
+                  RetainTileDataAction{ { 4, 0, { 4, 0, 0 } }, Resource::Necessity::Optional }, //
+                  RenderTileAction{ { 4, 0, 0 }, *tile_4_0_0_0 },       //
+
+                  GetTileDataAction{ { 7, 0, { 7, 1, 0 } }, NotFound },    // ideal tile
+                  CreateTileDataAction{ { 7, 0, { 7, 1, 0 } } },           //
+                  RetainTileDataAction{ { 7, 0, { 7, 1, 0 } }, Resource::Necessity::Required }, //
+                  GetTileDataAction{ { 8, 0, { 8, 2, 0 } }, NotFound },    // child tile
+                  GetTileDataAction{ { 8, 0, { 8, 2, 1 } }, NotFound },    // ...
+                  GetTileDataAction{ { 8, 0, { 8, 3, 0 } }, NotFound },    // ...
+                  GetTileDataAction{ { 8, 0, { 8, 3, 1 } }, NotFound },    // ...
+                  // no second ascent, and the parent is rendered only once
+              }),
+              log);
+}
+
 TEST(UpdateRenderables, DontRetainUnusedNonIdealTiles) {
     ActionLog log;
     MockSource source;
@@ -166,6 +166,20 @@ TEST(Annotations, AddMultiple) {
     test.checkRendering("add_multiple");
 }
 
+TEST(Annotations, AddMultipleBatch) {
+    AnnotationTest test;
+
+    test.map.getStyle().loadJSON(util::read_file("test/fixtures/api/empty.json"));
+    test.map.addAnnotationImage(namedMarker("default_marker"));
+    const AnnotationIDs ids = test.map.addAnnotations({
+        SymbolAnnotation { Point<double> { -10, 0 }, "default_marker" },
+        SymbolAnnotation { Point<double> { 10, 0 }, "default_marker" },
+    });
+    ASSERT_EQ(2u, ids.size());
+    EXPECT_NE(ids[0], ids[1]);
+    test.checkRendering("add_multiple");
+}
+
 TEST(Annotations, NonImmediateAdd) {
     AnnotationTest test;
 
@@ -194,6 +208,26 @@ TEST(Annotations, UpdateSymbolAnnotationGeometry) {
     test.checkRendering("update_point");
 }
 
+TEST(Annotations, UpdateSymbolAnnotationGeometryBatch) {
+    AnnotationTest test;
+
+    test.map.getStyle().loadJSON(util::read_file("test/fixtures/api/empty.json"));
+    test.map.addAnnotationImage(namedMarker("default_marker"));
+    const AnnotationIDs ids = test.map.addAnnotations({
+        SymbolAnnotation { Point<double> { 0, 0 }, "default_marker" },
+        SymbolAnnotation { Point<double> { 10, 0 }, "default_marker" },
+    });
+
+    test::render(test.map, test.view);
+
+    test.map.updateAnnotations({
+        { ids[0], SymbolAnnotation { Point<double> { -10, 0 }, "default_marker" } },
+        { ids[1], SymbolAnnotation { Point<double> { -10, 0 }, "default_marker" } },
+    });
+    test.map.removeAnnotations({ ids[1] });
+    test.checkRendering("update_point");
+}
+
 TEST(Annotations, UpdateSymbolAnnotationIcon) {
     AnnotationTest test;
 
@@ -306,6 +340,27 @@ TEST(Annotations, RemoveShape) {
     test.checkRendering("remove_shape");
 }
 
+TEST(Annotations, RemoveBatch) {
+    AnnotationTest test;
+
+    LineString<double> line = {{ { 0, 0 }, { 45, 45 } }};
+    LineAnnotation annotation { line };
+    annotation.color = Color::red();
+    annotation.width = { 5 };
+
+    test.map.getStyle().loadJSON(util::read_file("test/fixtures/api/empty.json"));
+    test.map.addAnnotationImage(namedMarker("default_marker"));
+    const AnnotationIDs ids = test.map.addAnnotations({
+        annotation,
+        SymbolAnnotation { Point<double> { 0, 0 }, "default_marker" },
+    });
+
+    test::render(test.map, test.view);
+
+    test.map.removeAnnotations(ids);
+    test.checkRendering("remove_shape");
+}
+
 TEST(Annotations, ImmediateRemoveShape) {
     AnnotationTest test;
 
@@ -13,6 +13,7 @@
 #include <mbgl/util/run_loop.hpp>
 #include <mbgl/style/style.hpp>
 #include <mbgl/test/stub_renderer_frontend.hpp>
+#include <mbgl/style/layers/fill_layer.hpp>
 #include <mbgl/style/layers/line_layer.hpp>
 #include <mbgl/style/sources/geojson_source.hpp>
 
@@ -141,3 +142,55 @@ TEST(API, ZoomHistory) {
     auto unchecked = flo->unchecked();
     EXPECT_TRUE(unchecked.empty()) << unchecked;
 }
+
+TEST(API, UnchangedRender) {
+    util::RunLoop loop;
+
+    const auto style = util::read_file("test/fixtures/api/water.json");
+
+    HeadlessBackend backend;
+    BackendScope scope { backend };
+    OffscreenView view { backend.getContext(), { 512, 512 } };
+    DefaultFileSource fileSource(":memory:", "test/fixtures/api/assets");
+    ThreadPool threadPool(4);
+
+    Log::setObserver(std::make_unique<FixtureLogObserver>());
+
+    float pixelRatio { 1 };
+    StubRendererFrontend rendererFrontend {
+            std::make_unique<Renderer>(backend, pixelRatio, fileSource, threadPool), view };
+    Map map(rendererFrontend, MapObserver::nullObserver(), view.getSize(), pixelRatio, fileSource, threadPool, MapMode::Still);
+    map.getStyle().loadJSON(style);
+
+    auto render = [&] {
+        PremultipliedImage result;
+        map.renderStill([&](std::exception_ptr) {
+            result = view.readStillImage();
+        });
+
+        while (!result.valid()) {
+            loop.runOnce();
+        }
+
+        return result;
+    };
+
+    const PremultipliedImage first = render();
+    test::checkImage("test/fixtures/api/repeated_render", first, 0.0003, 0.1);
+
+    const std::size_t skipped = rendererFrontend.getRenderer()->getSkippedFrameCount();
+
+    // Nothing changed, so the view still shows the first frame, which isn't drawn again.
+    EXPECT_TRUE(first == render());
+    EXPECT_EQ(skipped + 1, rendererFrontend.getRenderer()->getSkippedFrameCount());
+
+    // Changing a paint property must not be mistaken for an unchanged frame.
+    map.getStyle().getLayer("water")->as<style::FillLayer>()->setFillColor(Color::green());
+    EXPECT_FALSE(first == render());
+    EXPECT_EQ(skipped + 1, rendererFrontend.getRenderer()->getSkippedFrameCount());
+
+    auto observer = Log::removeObserver();
+    auto flo = dynamic_cast<FixtureLogObserver*>(observer.get());
+    auto unchecked = flo->unchecked();
+    EXPECT_TRUE(unchecked.empty()) << unchecked;
+}
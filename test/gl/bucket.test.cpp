@@ -51,6 +51,26 @@ TEST(Buckets, FillBucket) {
     ASSERT_FALSE(bucket.needsUpload());
 }
 
+TEST(Buckets, FillBucketLargePolygon) {
+    FillBucket bucket { { {0, 0, 0}, MapMode::Still, 1.0 }, {} };
+
+    // A square ring with more vertices than 16-bit indices can address.
+    GeometryCollection polygon { {} };
+    for (int16_t x = -20000; x < 20000; x++) polygon[0].emplace_back(x, -20000);
+    for (int16_t y = -20000; y < 20000; y++) polygon[0].emplace_back(20000, y);
+    ASSERT_GT(polygon[0].size(), std::numeric_limits<uint16_t>::max());
+
+#if MBGL_HAS_UINT32_INDICES
+    bucket.addFeature(StubGeometryTileFeature { {}, FeatureType::Polygon, polygon, properties }, polygon);
+    EXPECT_EQ(1u, bucket.lineSegments.size());
+    EXPECT_EQ(1u, bucket.triangleSegments.size());
+    EXPECT_EQ(gl::DataType::UnsignedInteger, bucket.lines.type());
+    EXPECT_EQ(polygon[0].size() * 2, bucket.lines.indexSize());
+#else
+    EXPECT_ANY_THROW(bucket.addFeature(StubGeometryTileFeature { {}, FeatureType::Polygon, polygon, properties }, polygon));
+#endif
+}
+
 TEST(Buckets, LineBucket) {
     gl::Context context;
     LineBucket bucket { { {0, 0, 0}, MapMode::Still, 1.0 }, {}, {} };
@@ -114,3 +134,25 @@ TEST(Buckets, RasterBucket) {
     bucket.clear();
     ASSERT_TRUE(bucket.needsUpload());
 }
+
+TEST(Buckets, RasterBucketEncoded) {
+    PremultipliedImage opaque({ 4, 4 });
+    std::fill(opaque.data.get(), opaque.data.get() + opaque.bytes(), 255);
+
+    RasterBucket bucket = { opaque.clone() };
+    bucket.encode(RasterTextureFormat::RGB565);
+    ASSERT_TRUE(bucket.hasData());
+    ASSERT_FALSE(bucket.image);
+    ASSERT_EQ(RasterTextureFormat::RGB565, bucket.textureFormat);
+    ASSERT_EQ(opaque.size, bucket.encodedSize);
+    ASSERT_EQ(4u * 4 * 2, bucket.encodedImage.size());
+
+    // Images with transparent pixels keep their RGBA pixels.
+    PremultipliedImage translucent = opaque.clone();
+    translucent.data[3] = 128;
+    RasterBucket translucentBucket = { std::move(translucent) };
+    translucentBucket.encode(RasterTextureFormat::DXT1);
+    ASSERT_TRUE(translucentBucket.image);
+    ASSERT_EQ(RasterTextureFormat::RGBA, translucentBucket.textureFormat);
+    ASSERT_TRUE(translucentBucket.encodedImage.empty());
+}
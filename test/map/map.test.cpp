@@ -358,6 +358,19 @@ TEST(Map, StyleLoadedSignal) {
     EXPECT_FALSE(emitted);
 }
 
+TEST(Map, SetStyleLoadedSignal) {
+    MapTest<> test;
+
+    // A style passed to the map reports to it just like the style the map created itself
+    bool emitted = false;
+    test.observer.didFinishLoadingStyleCallback = [&]() {
+        emitted = true;
+    };
+    test.map.setStyle(std::make_unique<Style>(test.threadPool, test.fileSource, 1));
+    test.map.getStyle().loadJSON(util::read_file("test/fixtures/api/empty.json"));
+    EXPECT_TRUE(emitted);
+}
+
 // Test for https://github.com/mapbox/mapbox-gl-native/issues/7902
 TEST(Map, TEST_REQUIRES_SERVER(StyleNetworkErrorRetry)) {
     MapTest<OnlineFileSource> test;
@@ -538,6 +551,139 @@ TEST(Map, DontLoadUnneededTiles) {
     }
 }
 
+TEST(Map, RenderStills) {
+    MapTest<> test;
+
+    test.map.getStyle().loadJSON(R"STYLE({
+  "sources": {
+    "a": { "type": "vector", "tiles": [ "a/{z}/{x}/{y}" ] }
+  },
+  "layers": [{
+    "id": "a",
+    "type": "fill",
+    "source": "a",
+    "source-layer": "a"
+  }]
+})STYLE");
+
+    std::unordered_map<std::string, unsigned> requests;
+    test.fileSource.tileResponse = [&](const Resource& rsc) {
+        requests[rsc.url]++;
+        Response res;
+        res.noContent = true;
+        return res;
+    };
+
+    auto camera = [](LatLng center, double zoom) {
+        CameraOptions options;
+        options.center = center;
+        options.zoom = zoom;
+        return options;
+    };
+
+    const std::vector<Map::StillImageOptions> images = {
+        { camera({ 0, 0 }, 1), { 256, 256 } },
+        { camera({ 0, 0 }, 2), { 256, 256 } },
+        { camera({ 10, 10 }, 2), { 512, 256 } },
+    };
+
+    std::vector<std::size_t> completed;
+    std::vector<std::future<PremultipliedImage>> reads;
+    std::unordered_map<std::string, unsigned> requestsBeforeFirstImage;
+
+    test.map.renderStills(images, [&](std::size_t index, std::exception_ptr error) {
+        ASSERT_FALSE(error);
+        if (completed.empty()) {
+            requestsBeforeFirstImage = requests;
+        }
+        completed.push_back(index);
+
+        reads.push_back(test.view.readStillImageAsync());
+        EXPECT_EQ(images[index].size, test.map.getSize());
+
+        if (index + 1 < images.size()) {
+            test.view.resize(images[index + 1].size);
+        } else {
+            test.runLoop.stop();
+        }
+    });
+
+    test.runLoop.run();
+
+    EXPECT_EQ(std::vector<std::size_t>({ 0, 1, 2 }), completed);
+
+    // Reads overlap with rendering the next image; the last one is completed by waiting on it.
+    ASSERT_EQ(images.size(), reads.size());
+    for (std::size_t i = 0; i < reads.size(); i++) {
+        EXPECT_EQ(images[i].size, reads[i].get().size);
+    }
+
+    // The tiles of all images are requested before the first image is rendered, and every tile
+    // is only loaded once.
+    EXPECT_EQ(requestsBeforeFirstImage, requests);
+    EXPECT_TRUE(requests.count("a/1/0/0"));
+    EXPECT_TRUE(requests.count("a/2/1/1"));
+    for (const auto& request : requests) {
+        EXPECT_EQ(1u, request.second) << request.first;
+    }
+}
+
+TEST(Map, PrefetchTilesAlongAnimation) {
+    MapTest<> test { 1, MapMode::Continuous };
+
+    test.map.getStyle().loadJSON(R"STYLE({
+  "sources": {
+    "a": { "type": "vector", "tiles": [ "a/{z}/{x}/{y}" ] }
+  },
+  "layers": [{
+    "id": "a",
+    "type": "fill",
+    "source": "a",
+    "source-layer": "a"
+  }]
+})STYLE");
+
+    std::string awaited;
+    std::unordered_map<std::string, Resource::Priority> requests;
+    test.fileSource.tileResponse = [&](const Resource& rsc) {
+        requests.emplace(rsc.url, rsc.priority);
+        if (rsc.url == awaited) {
+            test.runLoop.stop();
+        }
+        Response res;
+        res.noContent = true;
+        return res;
+    };
+
+    util::Timer emergencyShutoff;
+    emergencyShutoff.start(Seconds(10), Duration::zero(), [&] {
+        test.runLoop.stop();
+        FAIL() << "Did not request " << awaited;
+    });
+
+    CameraOptions camera;
+    camera.center = LatLng { 0, 0 };
+    camera.zoom = 10;
+    test.map.jumpTo(camera);
+
+    // Vector tiles at lower zoom levels are loaded in continuous mode, behind the visible ones.
+    awaited = "a/6/32/32";
+    test.runLoop.run();
+    ASSERT_TRUE(requests.count(awaited));
+    EXPECT_EQ(Resource::Low, requests[awaited]);
+    EXPECT_EQ(Resource::Regular, requests["a/10/512/512"]);
+
+    // The tiles at the destination are loaded as soon as the animation starts.
+    camera.center = LatLng { 40, 40 };
+    test.map.flyTo(camera, AnimationOptions(Seconds(10)));
+
+    awaited = "a/10/625/387";
+    test.runLoop.run();
+    ASSERT_TRUE(requests.count(awaited));
+    EXPECT_EQ(Resource::Low, requests[awaited]);
+    EXPECT_GT(30, test.map.getLatLng().latitude());
+}
+
 TEST(Map, TEST_DISABLED_ON_CI(ContinuousRendering)) {
     util::RunLoop runLoop;
     HeadlessBackend backend;
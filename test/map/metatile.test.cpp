@@ -0,0 +1,76 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/map/metatile.hpp>
+#include <mbgl/util/projection.hpp>
+
+using namespace mbgl;
+
+TEST(Metatile, Alignment) {
+    Metatile metatile(10, 517, 339, 8, 256, 32);
+    EXPECT_EQ(10, metatile.z);
+    EXPECT_EQ(512u, metatile.x);
+    EXPECT_EQ(336u, metatile.y);
+    EXPECT_EQ(8u, metatile.size);
+    EXPECT_EQ((Size { 2112, 2112 }), metatile.renderSize());
+
+    // The metatile is shrunk at zoom levels that have fewer tiles.
+    Metatile small(1, 1, 0, 8);
+    EXPECT_EQ(0u, small.x);
+    EXPECT_EQ(0u, small.y);
+    EXPECT_EQ(2u, small.size);
+    EXPECT_EQ((Size { 512, 512 }), small.renderSize());
+}
+
+TEST(Metatile, Camera) {
+    // 512 pixel tiles are rendered at their own zoom level.
+    const CameraOptions world = Metatile(0, 0, 0, 1, 512).camera();
+    EXPECT_DOUBLE_EQ(0, *world.zoom);
+    EXPECT_NEAR(0, world.center->latitude(), 1e-10);
+    EXPECT_NEAR(0, world.center->longitude(), 1e-10);
+
+    // 256 pixel tiles are rendered one zoom level lower.
+    const CameraOptions camera = Metatile(4, 8, 4, 4).camera();
+    EXPECT_DOUBLE_EQ(3, *camera.zoom);
+    const LatLng northwest = Projection::unproject({ 8 * 256.0, 4 * 256.0 }, 8);
+    const LatLng southeast = Projection::unproject({ 12 * 256.0, 8 * 256.0 }, 8);
+    EXPECT_DOUBLE_EQ((northwest.longitude() + southeast.longitude()) / 2, camera.center->longitude());
+    EXPECT_LT(camera.center->latitude(), northwest.latitude());
+    EXPECT_GT(camera.center->latitude(), southeast.latitude());
+
+    EXPECT_THROW(Metatile(0, 0, 0, 1, 256), std::domain_error);
+    EXPECT_THROW(Metatile(2, 4, 0, 1), std::domain_error);
+    EXPECT_THROW(Metatile(2, 0, 0, 0), std::invalid_argument);
+}
+
+TEST(Metatile, Slice) {
+    Metatile metatile(8, 3, 2, 2, 2, 1);
+    const float pixelRatio = 2;
+
+    // Fill each pixel with its column and row, so that slices can be identified.
+    PremultipliedImage image({ 12, 12 });
+    for (uint32_t row = 0; row < 12; row++) {
+        for (uint32_t column = 0; column < 12; column++) {
+            uint8_t* pixel = image.data.get() + (row * 12 + column) * 4;
+            pixel[0] = column;
+            pixel[1] = row;
+            pixel[2] = 0;
+            pixel[3] = 255;
+        }
+    }
+
+    auto tiles = metatile.slice(image, pixelRatio);
+    ASSERT_EQ(4u, tiles.size());
+    EXPECT_EQ(8, tiles[1].z);
+    EXPECT_EQ(3u, tiles[1].x);
+    EXPECT_EQ(2u, tiles[1].y);
+    EXPECT_EQ(2u, tiles[2].x);
+    EXPECT_EQ(3u, tiles[2].y);
+    EXPECT_EQ((Size { 4, 4 }), tiles[3].image.size);
+
+    // The bottom right tile starts after the buffer and the first tile.
+    EXPECT_EQ(6, tiles[3].image.data[0]);
+    EXPECT_EQ(6, tiles[3].image.data[1]);
+    EXPECT_EQ(9, tiles[3].image.data[(3 * 4 + 3) * 4]);
+
+    EXPECT_THROW(metatile.slice(PremultipliedImage({ 11, 12 }), pixelRatio), std::invalid_argument);
+}
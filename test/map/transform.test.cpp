@@ -609,3 +609,46 @@ TEST(Transform, PitchBounds) {
     transform.setPitch(60.0 * util::DEG2RAD);
     ASSERT_NEAR(transform.getState().getPitch() * util::RAD2DEG, 55.0, 1e-5);
 }
+
+TEST(Transform, TransitionStates) {
+    Transform transform;
+    transform.resize({ 1000, 1000 });
+    transform.setLatLngZoom({ 45, 135 }, 10);
+
+    // Immediate changes have no path.
+    transform.setLatLngZoom({ 45, 135 }, 12);
+    EXPECT_TRUE(transform.getTransitionStates(Clock::now()).empty());
+
+    const LatLng destination { -45, -135 };
+    CameraOptions camera;
+    camera.center = destination;
+    camera.zoom = 10;
+    transform.flyTo(camera, AnimationOptions(Seconds(1)));
+
+    // The sampled states don't move the camera.
+    EXPECT_NEAR(45, transform.getLatLng().latitude(), 1e-9);
+    EXPECT_NEAR(135, transform.getLatLng().longitude(), 1e-9);
+    EXPECT_DOUBLE_EQ(12, transform.getZoom());
+
+    const TimePoint start = transform.getTransitionStart();
+    auto states = transform.getTransitionStates(start);
+    ASSERT_EQ(util::PREFETCH_TRANSITION_SAMPLES, states.size());
+
+    // The destination comes first.
+    EXPECT_NEAR(destination.latitude(), states.front().getLatLng().latitude(), 0.001);
+    EXPECT_NEAR(destination.longitude(), states.front().getLatLng().longitude(), 0.001);
+    EXPECT_NEAR(10, states.front().getZoom(), 0.00001);
+
+    // flyTo() zooms out along the way.
+    EXPECT_LT(states[states.size() / 2].getZoom(), 10);
+
+    // States that have been passed are dropped.
+    transform.updateTransitions(start + Milliseconds(500));
+    states = transform.getTransitionStates(start + Milliseconds(500));
+    EXPECT_GT(util::PREFETCH_TRANSITION_SAMPLES, states.size());
+    EXPECT_NEAR(destination.latitude(), states.front().getLatLng().latitude(), 0.001);
+
+    transform.updateTransitions(start + transform.getTransitionDuration());
+    EXPECT_FALSE(transform.inTransition());
+    EXPECT_TRUE(transform.getTransitionStates(start + transform.getTransitionDuration()).empty());
+}
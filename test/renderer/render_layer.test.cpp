@@ -0,0 +1,45 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/renderer/render_layer.hpp>
+#include <mbgl/renderer/transition_parameters.hpp>
+#include <mbgl/style/layers/circle_layer.hpp>
+#include <mbgl/style/layers/fill_layer.hpp>
+#include <mbgl/style/layers/line_layer.hpp>
+
+using namespace mbgl;
+using namespace mbgl::style;
+
+namespace {
+
+bool isZoomDependent(const Layer& layer) {
+    auto renderLayer = RenderLayer::create(layer.baseImpl);
+    renderLayer->transition(TransitionParameters { TimePoint(), TransitionOptions() });
+    return renderLayer->isZoomDependent();
+}
+
+} // namespace
+
+TEST(RenderLayer, ZoomDependent) {
+    LineLayer line("line", "source");
+    EXPECT_FALSE(isZoomDependent(line));
+
+    line.setLineColor(Color::red());
+    line.setLineWidth(SourceFunction<float>("width", IdentityStops<float>()));
+    EXPECT_FALSE(isZoomDependent(line));
+
+    line.setLineOpacity(CameraFunction<float>(ExponentialStops<float>({ { 10, 0 }, { 12, 1 } })));
+    EXPECT_TRUE(isZoomDependent(line));
+
+    // Patterns fade between zoom levels.
+    FillLayer fill("fill", "source");
+    EXPECT_FALSE(isZoomDependent(fill));
+    fill.setFillPattern(std::string("pattern"));
+    EXPECT_TRUE(isZoomDependent(fill));
+
+    CircleLayer circle("circle", "source");
+    circle.setCircleRadius(CompositeFunction<float>("radius", CompositeExponentialStops<float>({
+        { 0.0f, { { 1.0f, 1.0f } } },
+        { 10.0f, { { 1.0f, 4.0f } } }
+    })));
+    EXPECT_TRUE(isZoomDependent(circle));
+}
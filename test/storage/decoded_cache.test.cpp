@@ -0,0 +1,45 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/storage/decoded_cache.hpp>
+#include <mbgl/text/glyph_pbf.hpp>
+#include <mbgl/util/io.hpp>
+
+using namespace mbgl;
+
+TEST(DecodedCache, TEST_REQUIRES_WRITE(Glyphs)) {
+    DecodedCache cache("test/fixtures/decoded_cache");
+
+    const auto glyphs = parseGlyphPBF(GlyphRange { 0, 255 }, util::read_file("test/fixtures/resources/fake_glyphs-0-255.pbf"));
+    ASSERT_EQ(1u, glyphs.size());
+
+    cache.putGlyphs("mapbox://fonts/test/0-255.pbf", "etag", glyphs);
+
+    auto cached = cache.getGlyphs("mapbox://fonts/test/0-255.pbf", "etag");
+    ASSERT_TRUE(bool(cached));
+    ASSERT_EQ(1u, cached->size());
+    EXPECT_EQ(glyphs[0].id, (*cached)[0].id);
+    EXPECT_EQ(glyphs[0].metrics, (*cached)[0].metrics);
+    EXPECT_EQ(glyphs[0].bitmap, (*cached)[0].bitmap);
+
+    // A different ETag means the cached entry is stale.
+    EXPECT_FALSE(bool(cache.getGlyphs("mapbox://fonts/test/0-255.pbf", "other")));
+    EXPECT_FALSE(bool(cache.getGlyphs("mapbox://fonts/test/256-511.pbf", "etag")));
+}
+
+TEST(DecodedCache, TEST_REQUIRES_WRITE(Image)) {
+    DecodedCache cache("test/fixtures/decoded_cache");
+
+    PremultipliedImage image({ 2, 3 });
+    for (size_t i = 0; i < image.bytes(); i++) {
+        image.data[i] = i;
+    }
+
+    cache.putImage("mapbox://sprites/test.png", "etag", image);
+
+    auto cached = cache.getImage("mapbox://sprites/test.png", "etag");
+    ASSERT_TRUE(bool(cached));
+    EXPECT_EQ(image.size, cached->size);
+    EXPECT_EQ(image, *cached);
+
+    EXPECT_FALSE(bool(cache.getImage("mapbox://sprites/test.png", "other")));
+}
@@ -52,3 +52,16 @@ TEST(OfflineTilePyramidRegionDefinition, TileCoverWrapped) {
     EXPECT_EQ((std::vector<CanonicalTileID>{ { 0, 0, 0 } }),
               region.tileCover(SourceType::Vector, 512, { 0, 22 }));
 }
+
+TEST(OfflineTilePyramidRegionDefinition, TileCount) {
+    OfflineTilePyramidRegionDefinition region("", sanFrancisco, 0, 16, 1.0);
+
+    for (const auto type : { SourceType::Vector, SourceType::Raster }) {
+        for (const uint16_t tileSize : { 256, 512 }) {
+            EXPECT_EQ(region.tileCover(type, tileSize, { 0, 22 }).size(),
+                      region.tileCount(type, tileSize, { 0, 22 }));
+            EXPECT_EQ(region.tileCover(type, tileSize, { 4, 12 }).size(),
+                      region.tileCount(type, tileSize, { 4, 12 }));
+        }
+    }
+}
@@ -1,6 +1,7 @@
 #include <mbgl/test/util.hpp>
 #include <mbgl/test/fixture_log_observer.hpp>
 
+#include <mbgl/storage/offline_bulk.hpp>
 #include <mbgl/storage/offline_database.hpp>
 #include <mbgl/storage/resource.hpp>
 #include <mbgl/storage/response.hpp>
@@ -10,6 +11,7 @@
 #include <gtest/gtest.h>
 #include <sqlite3.hpp>
 #include <sqlite3.h>
+#include <map>
 #include <thread>
 #include <random>
 
@@ -549,6 +551,143 @@ TEST(OfflineDatabase, HasRegionResourceTile) {
 
 }
 
+TEST(OfflineDatabase, PutRegionResources) {
+    using namespace mbgl;
+
+    OfflineDatabase db(":memory:");
+    OfflineRegionDefinition definition { "", LatLngBounds::world(), 0, INFINITY, 1.0 };
+    OfflineRegion region = db.createRegion(definition, OfflineRegionMetadata());
+
+    std::vector<OfflineDatabase::PreparedResource> batch;
+    for (int32_t x = 0; x < 4; x++) {
+        Response response;
+        response.data = std::make_shared<std::string>("tile "s + util::toString(x));
+        batch.push_back(OfflineDatabase::prepareResource(
+            Resource::tile("http://example.com/{z}/{x}/{y}.pbf", 1.0, x, 0, 2, Tileset::Scheme::XYZ),
+            std::move(response)));
+    }
+    Response style;
+    style.data = randomString(1024);
+    batch.push_back(OfflineDatabase::prepareResource(Resource::style("http://example.com/style"), style));
+
+    db.putRegionResources(region.getID(), batch);
+
+    OfflineRegionStatus status = db.getRegionCompletedStatus(region.getID());
+    EXPECT_EQ(5u, status.completedResourceCount);
+    EXPECT_EQ(4u, status.completedTileCount);
+
+    std::map<int32_t, std::string> tiles;
+    db.forEachRegionTile(region.getID(), "http://example.com/{z}/{x}/{y}.pbf",
+                         [&](const Resource::TileData& tile, const std::string& data) {
+        EXPECT_EQ(2, tile.z);
+        EXPECT_EQ(0, tile.y);
+        tiles.emplace(tile.x, data);
+    });
+    ASSERT_EQ(4u, tiles.size());
+    EXPECT_EQ("tile 3", tiles[3]);
+
+    db.forEachRegionTile(region.getID(), "http://example.com/other/{z}/{x}/{y}.pbf",
+                         [&](const Resource::TileData&, const std::string&) {
+        FAIL() << "Unexpected tile";
+    });
+}
+
+TEST(OfflineDatabase, ImportMBTiles) {
+    using namespace mbgl;
+
+    const char* path = "test/fixtures/offline_database/import.mbtiles";
+    deleteFile(path);
+    {
+        mapbox::sqlite::Database mbtiles(path, mapbox::sqlite::ReadWrite | mapbox::sqlite::Create);
+        mbtiles.exec("CREATE TABLE metadata (name TEXT, value TEXT)");
+        mbtiles.exec("CREATE TABLE tiles (zoom_level INTEGER, tile_column INTEGER, tile_row INTEGER, tile_data BLOB)");
+        mbtiles.exec("INSERT INTO metadata VALUES ('bounds', '-10,-20.5,30,40'), ('minzoom', '1'), ('maxzoom', '2')");
+        // Only the first two rows are within the tile grid of their zoom level.
+        mbtiles.exec("INSERT INTO tiles VALUES (1, 0, 1, 'a'), (2, 3, 0, 'b'), (1, 2, 0, 'c'), (1, 0, -1, 'd')");
+    }
+
+    OfflineDatabase db(":memory:");
+    const OfflineRegionDefinition defaults { "mapbox://style", LatLngBounds::world(), 0, 22, 2.0 };
+    const OfflineRegionDefinition definition = readMBTilesRegion(path, defaults);
+    EXPECT_EQ("mapbox://style", definition.styleURL);
+    EXPECT_EQ(LatLngBounds::hull({ -20.5, -10 }, { 40, 30 }), definition.bounds);
+    EXPECT_EQ(1, definition.minZoom);
+    EXPECT_EQ(2, definition.maxZoom);
+    EXPECT_EQ(2.0f, definition.pixelRatio);
+
+    OfflineRegion region = db.createRegion(definition, OfflineRegionMetadata());
+    OfflineBulkOptions options;
+    options.urlTemplate = "http://example.com/{z}/{x}/{y}.pbf";
+    EXPECT_EQ(2u, importMBTiles(db, region.getID(), path, options));
+
+    std::map<std::string, std::string> tiles;
+    db.forEachRegionTile(region.getID(), options.urlTemplate,
+                         [&](const Resource::TileData& tile, const std::string& data) {
+        tiles.emplace(util::toString(int(tile.z)) + "/" + util::toString(tile.x) + "/" + util::toString(tile.y), data);
+    });
+    ASSERT_EQ(2u, tiles.size());
+    EXPECT_EQ("a", tiles["1/0/0"]);
+    EXPECT_EQ("b", tiles["2/3/3"]);
+
+    deleteFile(path);
+}
+
+TEST(OfflineDatabase, ExportMBTiles) {
+    using namespace mbgl;
+
+    const char* path = "test/fixtures/offline_database/export.mbtiles";
+    deleteFile(path);
+
+    OfflineDatabase db(":memory:");
+    const OfflineRegionDefinition definition { "mapbox://style", LatLngBounds::hull({ -20.5, -10 }, { 40, 30 }), 1, 2, 1.0 };
+    OfflineRegion region = db.createRegion(definition, OfflineRegionMetadata());
+
+    const std::string urlTemplate = "http://example.com/{z}/{x}/{y}.png";
+    Response response;
+    response.data = std::make_shared<std::string>("\x89PNG\r\n\x1a\n" "a");
+    db.putRegionResource(region.getID(), Resource::tile(urlTemplate, 1.0, 0, 0, 1, Tileset::Scheme::XYZ), response);
+    response.data = std::make_shared<std::string>("\x89PNG\r\n\x1a\n" "b");
+    db.putRegionResource(region.getID(), Resource::tile(urlTemplate, 1.0, 3, 3, 2, Tileset::Scheme::XYZ), response);
+
+    OfflineBulkOptions options;
+    options.urlTemplate = urlTemplate;
+    EXPECT_THROW(exportMBTiles(db, region.getID() + 1, path, options), std::runtime_error);
+    EXPECT_EQ(2u, exportMBTiles(db, region.getID(), path, options));
+
+    {
+        mapbox::sqlite::Database mbtiles(path, mapbox::sqlite::ReadOnly);
+        mapbox::sqlite::Statement stmt = mbtiles.prepare("SELECT value FROM metadata WHERE name = ?1");
+        for (const auto& entry : { std::make_pair("name", "mapbox://style"), std::make_pair("format", "png") }) {
+            stmt.bind(1, entry.first);
+            ASSERT_TRUE(stmt.run());
+            EXPECT_EQ(entry.second, stmt.get<std::string>(0));
+            stmt.reset();
+        }
+    }
+
+    // Importing the file again recreates the region and its tiles.
+    OfflineDatabase copy(":memory:");
+    const OfflineRegionDefinition defaults { "mapbox://style", LatLngBounds::world(), 0, 22, 1.0 };
+    const OfflineRegionDefinition imported = readMBTilesRegion(path, defaults);
+    EXPECT_EQ(definition.bounds, imported.bounds);
+    EXPECT_EQ(definition.minZoom, imported.minZoom);
+    EXPECT_EQ(definition.maxZoom, imported.maxZoom);
+
+    OfflineRegion importedRegion = copy.createRegion(imported, OfflineRegionMetadata());
+    EXPECT_EQ(2u, importMBTiles(copy, importedRegion.getID(), path, options));
+
+    std::map<std::string, std::string> tiles;
+    copy.forEachRegionTile(importedRegion.getID(), urlTemplate,
+                           [&](const Resource::TileData& tile, const std::string& data) {
+        tiles.emplace(util::toString(int(tile.z)) + "/" + util::toString(tile.x) + "/" + util::toString(tile.y), data);
+    });
+    ASSERT_EQ(2u, tiles.size());
+    EXPECT_EQ("\x89PNG\r\n\x1a\n" "a", tiles["1/0/0"]);
+    EXPECT_EQ("\x89PNG\r\n\x1a\n" "b", tiles["2/3/3"]);
+
+    deleteFile(path);
+}
+
 TEST(OfflineDatabase, OfflineMapboxTileCount) {
     using namespace mbgl;
 
@@ -258,6 +258,112 @@ TEST(OnlineFileSource, TEST_REQUIRES_SERVER(Load)) {
     loop.run();
 }
 
+TEST(OnlineFileSource, TEST_REQUIRES_SERVER(MaximumConcurrentRequestsPerHost)) {
+    util::RunLoop loop;
+    OnlineFileSource fs;
+    fs.setMaximumConcurrentRequests(20, 1);
+
+    // The server takes 200ms to answer /delayed, so with one request per host at a time, the
+    // requests have to complete one after the other.
+    const int count = 3;
+    int completed = 0;
+    const auto start = util::now();
+
+    std::unique_ptr<AsyncRequest> reqs[count];
+    for (int i = 0; i < count; i++) {
+        reqs[i] = fs.request({ Resource::Unknown, "http://127.0.0.1:3000/delayed" }, [&, i](Response res) {
+            reqs[i].reset();
+            EXPECT_EQ(nullptr, res.error);
+            if (++completed == count) {
+                EXPECT_GE(util::now() - start, Milliseconds(600));
+                loop.stop();
+            }
+        });
+    }
+
+    loop.run();
+}
+
+TEST(OnlineFileSource, TEST_REQUIRES_SERVER(Priority)) {
+    util::RunLoop loop;
+    OnlineFileSource fs;
+    fs.setMaximumConcurrentRequests(20, 1);
+
+    std::vector<std::string> completed;
+
+    auto request = [&](Resource resource) {
+        return fs.request(resource, [&, url = resource.url](Response res) {
+            EXPECT_EQ(nullptr, res.error);
+            completed.push_back(url);
+            if (completed.size() == 4) {
+                loop.stop();
+            }
+        });
+    };
+
+    // The first request occupies the only slot for the host, so the remaining ones are queued
+    // and have to be activated in order of priority rather than in the order they were made.
+    Resource lowTile { Resource::Tile, "http://127.0.0.1:3000/load/1" };
+    lowTile.priority = Resource::Low;
+
+    auto req1 = request({ Resource::Tile, "http://127.0.0.1:3000/delayed" });
+    auto req2 = request(lowTile);
+    auto req3 = request({ Resource::Tile, "http://127.0.0.1:3000/load/2" });
+    auto req4 = request(Resource::style("http://127.0.0.1:3000/load/3"));
+
+    loop.run();
+
+    EXPECT_EQ((std::vector<std::string> {
+        "http://127.0.0.1:3000/delayed",
+        "http://127.0.0.1:3000/load/3",
+        "http://127.0.0.1:3000/load/2",
+        "http://127.0.0.1:3000/load/1",
+    }), completed);
+}
+
+TEST(OnlineFileSource, TEST_REQUIRES_SERVER(SetPriority)) {
+    util::RunLoop loop;
+    OnlineFileSource fs;
+    fs.setMaximumConcurrentRequests(20, 1);
+
+    std::vector<std::string> completed;
+
+    auto request = [&](Resource resource) {
+        return fs.request(resource, [&, url = resource.url](Response res) {
+            EXPECT_EQ(nullptr, res.error);
+            completed.push_back(url);
+            if (completed.size() == 4) {
+                loop.stop();
+            }
+        });
+    };
+
+    Resource lowTile { Resource::Tile, "http://127.0.0.1:3000/load/1" };
+    lowTile.priority = Resource::Low;
+
+    auto req1 = request({ Resource::Tile, "http://127.0.0.1:3000/delayed" });
+    auto req2 = request(lowTile);
+    auto req3 = request({ Resource::Tile, "http://127.0.0.1:3000/load/2" });
+    auto req4 = request({ Resource::Tile, "http://127.0.0.1:3000/load/3" });
+
+    // Change priorities while the first request is still in progress and the others are queued.
+    util::Timer timer;
+    timer.start(Milliseconds(50), Duration::zero(), [&] {
+        req1->setPriority(Resource::Low);
+        req2->setPriority(Resource::Regular);
+        req3->setPriority(Resource::Low);
+    });
+
+    loop.run();
+
+    EXPECT_EQ((std::vector<std::string> {
+        "http://127.0.0.1:3000/delayed",
+        "http://127.0.0.1:3000/load/1",
+        "http://127.0.0.1:3000/load/3",
+        "http://127.0.0.1:3000/load/2",
+    }), completed);
+}
+
 // Test for https://github.com/mapbox/mapbox-gl-native/issues/2123
 //
 // A request is made. While the request is in progress, the network status changes. This should
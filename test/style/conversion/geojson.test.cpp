@@ -0,0 +1,141 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/style/conversion/geojson.hpp>
+#include <mbgl/style/conversion/json.hpp>
+#include <mbgl/util/feature.hpp>
+#include <mbgl/util/geometry.hpp>
+
+using namespace mbgl;
+using namespace mbgl::style;
+using namespace mbgl::style::conversion;
+
+namespace {
+
+// Converts with both the streaming conversion and the document based one.
+void convertBoth(const std::string& json, optional<GeoJSON>& streamed, optional<GeoJSON>& parsed,
+                 Error& streamedError, Error& parsedError) {
+    streamed = convert<GeoJSON>(json, streamedError);
+    parsed = convertJSON<GeoJSON>(json, parsedError);
+}
+
+void expectEqualFeatures(const Feature& a, const Feature& b) {
+    EXPECT_TRUE(a.geometry == b.geometry);
+    EXPECT_TRUE(a.properties == b.properties);
+    EXPECT_TRUE(a.id == b.id);
+}
+
+} // namespace
+
+TEST(GeoJSONConversion, Geometries) {
+    for (const std::string json : {
+        R"({ "type": "Point", "coordinates": [1.5, -2, 100] })",
+        R"({ "coordinates": [[0, 0], [1, 1]], "type": "MultiPoint" })",
+        R"({ "type": "LineString", "coordinates": [] })",
+        R"({ "type": "LineString", "coordinates": [[0, 0], [10, 1e3], [4294967296, -4294967296]] })",
+        R"({ "type": "MultiLineString", "coordinates": [[[0, 0], [1, 1]], [], [[2, 2], [3, 3]]] })",
+        R"({ "type": "Polygon", "coordinates": [[[0, 0], [1, 0], [1, 1], [0, 0]], [[0.1, 0.1], [0.2, 0.1], [0.1, 0.1]]] })",
+        R"({ "type": "MultiPolygon", "coordinates": [[[[0, 0], [1, 0], [0, 0]]], [], [[[5, 5], [6, 6], [5, 5]]]] })",
+        R"({ "type": "GeometryCollection", "geometries": [
+            { "type": "Point", "coordinates": [3, 4] },
+            { "type": "GeometryCollection", "geometries": [] }
+        ] })",
+    }) {
+        optional<GeoJSON> streamed, parsed;
+        Error streamedError, parsedError;
+        convertBoth(json, streamed, parsed, streamedError, parsedError);
+        ASSERT_TRUE(bool(streamed)) << json;
+        ASSERT_TRUE(bool(parsed)) << json;
+        ASSERT_TRUE(streamed->is<mapbox::geojson::geometry>()) << json;
+        EXPECT_TRUE(streamed->get<mapbox::geojson::geometry>() ==
+                    parsed->get<mapbox::geojson::geometry>()) << json;
+    }
+}
+
+TEST(GeoJSONConversion, FeatureCollection) {
+    const std::string json = R"({
+        "type": "FeatureCollection",
+        "bbox": [0, 0, 10, 10],
+        "features": [{
+            "type": "Feature",
+            "id": 7,
+            "geometry": { "type": "Point", "coordinates": [1, 2] },
+            "properties": {
+                "uint": 1, "int": -2, "double": 1.5, "string": "s", "bool": true, "null": null,
+                "array": [true, null, [1]], "object": { "nested": { "a": "b" } },
+                "uint": 5
+            }
+        }, {
+            "properties": null,
+            "geometry": { "type": "LineString", "coordinates": [[0, 0], [1, 1]] },
+            "type": "Feature",
+            "id": "second",
+            "foreign": { "coordinates": "ignored" }
+        }, {
+            "type": "Feature",
+            "id": -1.5,
+            "geometry": { "type": "MultiPoint", "coordinates": [] }
+        }]
+    })";
+
+    optional<GeoJSON> streamed, parsed;
+    Error streamedError, parsedError;
+    convertBoth(json, streamed, parsed, streamedError, parsedError);
+    ASSERT_TRUE(bool(streamed));
+    ASSERT_TRUE(bool(parsed));
+    ASSERT_TRUE(streamed->is<FeatureCollection>());
+
+    const auto& streamedFeatures = streamed->get<FeatureCollection>();
+    const auto& parsedFeatures = parsed->get<FeatureCollection>();
+    ASSERT_EQ(3u, streamedFeatures.size());
+    ASSERT_EQ(parsedFeatures.size(), streamedFeatures.size());
+    for (std::size_t i = 0; i < streamedFeatures.size(); i++) {
+        expectEqualFeatures(parsedFeatures[i], streamedFeatures[i]);
+    }
+
+    const PropertyMap& properties = streamedFeatures[0].properties;
+    EXPECT_EQ(8u, properties.size());
+    EXPECT_EQ(1u, properties.at("uint").get<uint64_t>());
+    EXPECT_EQ(-2, properties.at("int").get<int64_t>());
+    EXPECT_EQ(1.5, properties.at("double").get<double>());
+    EXPECT_EQ(FeatureIdentifier(uint64_t(7)), *streamedFeatures[0].id);
+    EXPECT_EQ(FeatureIdentifier(std::string("second")), *streamedFeatures[1].id);
+    EXPECT_TRUE(streamedFeatures[1].properties.empty());
+}
+
+TEST(GeoJSONConversion, Feature) {
+    optional<GeoJSON> streamed, parsed;
+    Error streamedError, parsedError;
+    convertBoth(R"({ "type": "Feature", "geometry": { "type": "Point", "coordinates": [1, 2] } })",
+                streamed, parsed, streamedError, parsedError);
+    ASSERT_TRUE(bool(streamed));
+    ASSERT_TRUE(streamed->is<Feature>());
+    expectEqualFeatures(parsed->get<Feature>(), streamed->get<Feature>());
+}
+
+TEST(GeoJSONConversion, Errors) {
+    // Everything the streaming conversion doesn't handle gets the error message of the document
+    // based conversion.
+    for (const std::string json : {
+        R"([1, 2])",
+        R"({ "type": "Point", "coordinates": [1, 2] )",
+        R"({ "coordinates": [1, 2] })",
+        R"({ "type": "Point" })",
+        R"({ "type": "Point", "coordinates": {} })",
+        R"({ "type": "Point", "coordinates": [1] })",
+        R"({ "type": "Curve", "coordinates": [1, 2] })",
+        R"({ "type": "FeatureCollection" })",
+        R"({ "type": "FeatureCollection", "features": {} })",
+        R"({ "type": "Feature" })",
+        R"({ "type": "Feature", "geometry": null })",
+        R"({ "type": "Feature", "geometry": { "type": "Point", "coordinates": [1, 2] }, "properties": [] })",
+        R"({ "type": "Feature", "geometry": { "type": "Point", "coordinates": [1, 2] }, "id": true })",
+        R"({ "type": "FeatureCollection", "features": [{ "type": "Point", "coordinates": [1, 2] }] })",
+    }) {
+        optional<GeoJSON> streamed, parsed;
+        Error streamedError, parsedError;
+        convertBoth(json, streamed, parsed, streamedError, parsedError);
+        EXPECT_FALSE(bool(streamed)) << json;
+        EXPECT_FALSE(bool(parsed)) << json;
+        EXPECT_EQ(parsedError.message, streamedError.message) << json;
+    }
+}
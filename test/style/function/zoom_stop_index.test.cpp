@@ -0,0 +1,59 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/style/function/zoom_stop_index.hpp>
+#include <mbgl/util/interpolate.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+
+using namespace mbgl;
+using namespace mbgl::style;
+
+TEST(ZoomStopIndex, Empty) {
+    ZoomStopIndex index { std::map<float, float>() };
+    EXPECT_EQ(0u, index.size());
+    EXPECT_EQ(0u, index.upperBound(0));
+    EXPECT_EQ(0u, index.upperBound(-1));
+}
+
+TEST(ZoomStopIndex, UpperBound) {
+    for (const std::vector<float>& zooms : std::vector<std::vector<float>> {
+        { 0 },
+        { 5, 10 },
+        { -2, 0.5, 0.75, 1, 12.25, 12.5, 12.75, 13 },
+        { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22 },
+        { 24, 30, 100 },
+        { -10, -5 },
+    }) {
+        std::map<float, float> stops;
+        for (float zoom : zooms) {
+            stops.emplace(zoom, zoom);
+        }
+        ZoomStopIndex index { stops };
+        ASSERT_EQ(zooms.size(), index.size());
+
+        std::vector<float> samples = zooms;
+        for (float zoom = -12; zoom <= 110; zoom += 0.125) {
+            samples.push_back(zoom);
+        }
+        samples.push_back(std::numeric_limits<float>::infinity());
+        samples.push_back(-std::numeric_limits<float>::infinity());
+
+        for (float zoom : samples) {
+            EXPECT_EQ(std::size_t(std::upper_bound(zooms.begin(), zooms.end(), zoom) - zooms.begin()),
+                      index.upperBound(zoom)) << zoom;
+        }
+    }
+}
+
+TEST(ZoomStopIndex, InterpolationFactor) {
+    for (float base : { 1.0f, 0.5f, 1.2f, 1.75f, 2.0f }) {
+        ZoomStopIndex index { std::map<float, float> { { 0, 0 }, { 6, 0 }, { 8.5, 0 }, { 22, 0 } }, base };
+        for (float zoom = 0; zoom <= 22; zoom += 0.1) {
+            const std::size_t i = std::max<std::size_t>(1, std::min<std::size_t>(index.upperBound(zoom), 3));
+            EXPECT_EQ(util::interpolationFactor(base, { index.zoom(i - 1), index.zoom(i) }, zoom),
+                      index.interpolationFactor(i, zoom)) << base << " " << zoom;
+        }
+    }
+}
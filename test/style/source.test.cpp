@@ -28,6 +28,7 @@
 #include <mbgl/util/logging.hpp>
 #include <mbgl/util/optional.hpp>
 #include <mbgl/util/range.hpp>
+#include <mbgl/util/tile_cover.hpp>
 
 #include <mbgl/map/transform.hpp>
 #include <mbgl/annotation/annotation_manager.hpp>
@@ -36,6 +37,9 @@
 #include <mbgl/text/glyph_manager.hpp>
 
 #include <cstdint>
+#include <limits>
+#include <map>
+#include <set>
 
 using namespace mbgl;
 
@@ -63,7 +67,10 @@ public:
         annotationManager,
         imageManager,
         glyphManager,
-        0
+        0,
+        {},
+        0,
+        RasterTextureFormat::RGBA
     };
 
     SourceTest() {
@@ -438,6 +445,101 @@ TEST(Source, VectorTileCancel) {
     test.run();
 }
 
+TEST(Source, VectorTilePrefetchTransition) {
+    SourceTest test;
+
+    std::map<std::string, Resource::Priority> requests;
+    test.fileSource.tileResponse = [&] (const Resource& resource) {
+        // All tiles are requested by the same update, so they're answered at once.
+        requests.emplace(resource.url, resource.priority);
+        test.end();
+        Response response;
+        response.noContent = true;
+        return response;
+    };
+
+    LineLayer layer("id", "source");
+    layer.setSourceLayer("water");
+
+    std::vector<Immutable<Layer::Impl>> layers {{ layer.baseImpl }};
+
+    Tileset tileset;
+    tileset.tiles = { "{z}/{x}/{y}" };
+
+    VectorSource source("source", tileset);
+    source.loadDescription(test.fileSource);
+
+    test.transform.setLatLngZoom({ 0, 0 }, 4);
+    const TransformState state = test.transform.getState();
+
+    CameraOptions camera;
+    camera.center = LatLng { 40, 40 };
+    camera.zoom = 6;
+    test.transform.flyTo(camera, AnimationOptions(Seconds(1)));
+    const std::vector<TransformState> prefetchStates =
+        test.transform.getTransitionStates(test.transform.getTransitionStart());
+    ASSERT_FALSE(prefetchStates.empty());
+
+    auto coveredTiles = [] (const TransformState& state_) {
+        std::set<std::string> urls;
+        const int32_t z = util::coveringZoomLevel(state_.getZoom(), SourceType::Vector, util::tileSize);
+        for (const auto& id : util::tileCover(state_, z)) {
+            urls.insert(util::toString(id.canonical.z) + "/" + util::toString(id.canonical.x) + "/" +
+                        util::toString(id.canonical.y));
+        }
+        return urls;
+    };
+
+    auto update = [&] (uint32_t budget) {
+        requests.clear();
+        TileParameters parameters {
+            1.0,
+            MapDebugOptions(),
+            state,
+            test.threadPool,
+            test.fileSource,
+            MapMode::Continuous,
+            test.annotationManager,
+            test.imageManager,
+            test.glyphManager,
+            0,
+            prefetchStates,
+            budget,
+            RasterTextureFormat::RGBA
+        };
+        auto renderSource = RenderSource::create(source.baseImpl);
+        renderSource->setObserver(&test.renderSourceObserver);
+        renderSource->update(source.baseImpl, layers, true, true, parameters);
+        test.run();
+    };
+
+    // The budget only limits tiles that aren't visible. The destination is prefetched first.
+    update(3);
+    const std::set<std::string> visible = coveredTiles(state);
+    const std::set<std::string> destination = coveredTiles(prefetchStates.front());
+    std::size_t prefetched = 0;
+    for (const auto& request : requests) {
+        if (request.second == Resource::Low) {
+            prefetched++;
+            EXPECT_TRUE(destination.count(request.first)) << request.first;
+        } else {
+            EXPECT_TRUE(visible.count(request.first)) << request.first;
+        }
+    }
+    EXPECT_EQ(3u, prefetched);
+    for (const auto& url : visible) {
+        EXPECT_TRUE(requests.count(url)) << url;
+    }
+
+    // Without a limit, the tiles at every sampled camera position are requested.
+    update(std::numeric_limits<uint32_t>::max());
+    for (const auto& prefetchState : prefetchStates) {
+        for (const auto& url : coveredTiles(prefetchState)) {
+            EXPECT_TRUE(requests.count(url)) << url;
+        }
+    }
+}
+
 TEST(Source, RasterTileAttribution) {
     SourceTest test;
 
@@ -0,0 +1,132 @@
+#include <mbgl/test/util.hpp>
+#include <mbgl/test/stub_file_source.hpp>
+
+#include <mbgl/style/style_cache.hpp>
+#include <mbgl/style/style_impl.hpp>
+#include <mbgl/style/layer_impl.hpp>
+#include <mbgl/style/layers/line_layer.hpp>
+#include <mbgl/util/run_loop.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+
+using namespace mbgl;
+using namespace mbgl::style;
+
+namespace {
+
+const std::string styleJSON = R"STYLE({
+    "version": 8,
+    "name": "Cached",
+    "sprite": "mapbox://sprites/mapbox/streets",
+    "sources": {
+        "streets": { "type": "vector", "tiles": ["fake"] }
+    },
+    "layers": [{
+        "id": "road",
+        "type": "line",
+        "source": "streets",
+        "source-layer": "road",
+        "filter": ["==", "class", "street"],
+        "paint": { "line-width": { "stops": [[10, 1], [16, 8]] } }
+    }, {
+        "id": "road-casing",
+        "ref": "road",
+        "paint": { "line-color": "#fff" }
+    }]
+})STYLE";
+
+class StyleCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        StyleCache::getInstance().clear();
+    }
+
+    void TearDown() override {
+        StyleCache::getInstance().clear();
+    }
+};
+
+} // namespace
+
+TEST_F(StyleCacheTest, Hit) {
+    auto& cache = StyleCache::getInstance();
+
+    Parser first;
+    ASSERT_FALSE(cache.parse(first, styleJSON, "mapbox://styles/test", std::string("1")));
+    EXPECT_EQ(1u, cache.size());
+
+    Parser second;
+    ASSERT_FALSE(cache.parse(second, styleJSON, "mapbox://styles/test", std::string("1")));
+    EXPECT_EQ(1u, cache.size());
+
+    // Everything but the layers is parsed again.
+    EXPECT_EQ("Cached", second.name);
+    EXPECT_EQ("mapbox://sprites/mapbox/streets", second.spriteURL);
+    ASSERT_EQ(1u, second.sources.size());
+    EXPECT_NE(first.sources[0].get(), second.sources[0].get());
+
+    // The layers share their implementations.
+    ASSERT_EQ(2u, second.layers.size());
+    for (std::size_t i = 0; i < first.layers.size(); i++) {
+        EXPECT_EQ(first.layers[i]->baseImpl, second.layers[i]->baseImpl);
+    }
+    EXPECT_EQ("road-casing", second.layers[1]->getID());
+    ASSERT_TRUE(second.layers[1]->is<LineLayer>());
+    EXPECT_EQ("road", second.layers[1]->as<LineLayer>()->getSourceLayer());
+}
+
+TEST_F(StyleCacheTest, Miss) {
+    auto& cache = StyleCache::getInstance();
+
+    Parser first;
+    ASSERT_FALSE(cache.parse(first, styleJSON, "mapbox://styles/test", std::string("1")));
+
+    // A changed ETag parses the style again.
+    Parser second;
+    ASSERT_FALSE(cache.parse(second, styleJSON, "mapbox://styles/test", std::string("2")));
+    EXPECT_EQ(2u, cache.size());
+    ASSERT_EQ(2u, second.layers.size());
+    EXPECT_NE(first.layers[0]->baseImpl, second.layers[0]->baseImpl);
+
+    // Styles without ETag or URL aren't cached.
+    Parser third;
+    ASSERT_FALSE(cache.parse(third, styleJSON, "mapbox://styles/test", {}));
+    Parser fourth;
+    ASSERT_FALSE(cache.parse(fourth, styleJSON, "", std::string("1")));
+    EXPECT_EQ(2u, cache.size());
+}
+
+TEST_F(StyleCacheTest, ParseError) {
+    Parser parser;
+    EXPECT_TRUE(StyleCache::getInstance().parse(parser, "[", "mapbox://styles/test", std::string("1")));
+    EXPECT_EQ(0u, StyleCache::getInstance().size());
+}
+
+TEST_F(StyleCacheTest, LoadURL) {
+    util::RunLoop loop;
+
+    ThreadPool threadPool{ 1 };
+    StubFileSource fileSource;
+    fileSource.styleResponse = [&](const Resource&) {
+        Response response;
+        response.data = std::make_shared<std::string>(styleJSON);
+        response.etag = std::string("1");
+        return response;
+    };
+    fileSource.spriteJSONResponse = [&](const Resource&) { return optional<Response>(); };
+    fileSource.spriteImageResponse = [&](const Resource&) { return optional<Response>(); };
+
+    Style::Impl first { threadPool, fileSource, 1.0 };
+    first.loadURL("mapbox://styles/test");
+    Style::Impl second { threadPool, fileSource, 1.0 };
+    second.loadURL("mapbox://styles/test");
+    while (first.getLayers().empty() || second.getLayers().empty()) {
+        loop.runOnce();
+    }
+
+    ASSERT_EQ(2u, second.getLayers().size());
+    EXPECT_EQ(first.getLayer("road")->baseImpl, second.getLayer("road")->baseImpl);
+
+    // Mutating a layer of one style leaves the other one alone.
+    second.getLayer("road")->as<LineLayer>()->setSourceLayer("path");
+    EXPECT_EQ("road", first.getLayer("road")->as<LineLayer>()->getSourceLayer());
+}
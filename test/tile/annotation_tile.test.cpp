@@ -11,6 +11,8 @@
 #include <mbgl/geometry/feature_index.hpp>
 #include <mbgl/annotation/annotation_manager.hpp>
 #include <mbgl/annotation/annotation_tile.hpp>
+#include <mbgl/annotation/line_annotation_impl.hpp>
+#include <mbgl/util/constants.hpp>
 #include <mbgl/renderer/image_manager.hpp>
 #include <mbgl/text/glyph_manager.hpp>
 #include <mbgl/renderer/backend_scope.hpp>
@@ -45,7 +47,10 @@ public:
         annotationManager,
         imageManager,
         glyphManager,
-        0
+        0,
+        {},
+        0,
+        RasterTextureFormat::RGBA
     };
 };
 
@@ -98,3 +103,24 @@ TEST(AnnotationTile, Issue8289) {
     EXPECT_TRUE(result.empty());
 }
 
+
+TEST(AnnotationTile, ShapeBounds) {
+    const LineAnnotationImpl shape(0, LineAnnotation { LineString<double> {{ -10, -10 }, { 10, 10 }} }, 18);
+
+    EXPECT_DOUBLE_EQ(0.5 - 10.0 / 360, shape.bounds.min_corner().get<0>());
+    EXPECT_DOUBLE_EQ(0.5 + 10.0 / 360, shape.bounds.max_corner().get<0>());
+    EXPECT_LT(shape.bounds.min_corner().get<1>(), 0.5);
+    EXPECT_GT(shape.bounds.max_corner().get<1>(), 0.5);
+
+    using boost::geometry::intersects;
+    EXPECT_TRUE(intersects(shape.bounds, ShapeAnnotationImpl::tileBounds({ 0, 0, 0 })));
+    EXPECT_TRUE(intersects(shape.bounds, ShapeAnnotationImpl::tileBounds({ 1, 0, 0 })));
+    EXPECT_TRUE(intersects(shape.bounds, ShapeAnnotationImpl::tileBounds({ 1, 1, 1 })));
+    EXPECT_FALSE(intersects(shape.bounds, ShapeAnnotationImpl::tileBounds({ 3, 0, 0 })));
+    EXPECT_FALSE(intersects(shape.bounds, ShapeAnnotationImpl::tileBounds({ 3, 7, 7 })));
+
+    // Tiles include a buffer of 255 units on each side.
+    const ShapeAnnotationBox tile = ShapeAnnotationImpl::tileBounds({ 1, 1, 0 });
+    EXPECT_DOUBLE_EQ(0.5 - 0.5 * 255 / util::EXTENT, tile.min_corner().get<0>());
+    EXPECT_DOUBLE_EQ(1.0 + 0.5 * 255 / util::EXTENT, tile.max_corner().get<0>());
+}
@@ -0,0 +1,72 @@
+#include <mbgl/test/util.hpp>
+#include <mbgl/test/stub_geometry_tile_feature.hpp>
+
+#include <mbgl/tile/decoded_geometry_tile_layer.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+class CountingFeature : public StubGeometryTileFeature {
+public:
+    CountingFeature(std::size_t& decodes_, uint64_t id_)
+        : StubGeometryTileFeature(FeatureIdentifier(id_), FeatureType::LineString,
+                                  { { { 0, 0 }, { 10, 10 } } }, PropertyMap { { "id", id_ } }),
+          decodes(decodes_) {
+    }
+
+    GeometryCollection getGeometries() const override {
+        decodes++;
+        return StubGeometryTileFeature::getGeometries();
+    }
+
+    std::size_t& decodes;
+};
+
+class CountingLayer : public GeometryTileLayer {
+public:
+    std::size_t featureCount() const override {
+        return 3;
+    }
+
+    std::unique_ptr<GeometryTileFeature> getFeature(std::size_t i) const override {
+        return std::make_unique<CountingFeature>(decodes, i);
+    }
+
+    std::string getName() const override {
+        return "roads";
+    }
+
+    mutable std::size_t decodes = 0;
+};
+
+} // namespace
+
+TEST(DecodedGeometryTileLayer, DecodesOnce) {
+    auto counting = std::make_unique<CountingLayer>();
+    const std::size_t& decodes = counting->decodes;
+
+    auto layer = std::make_shared<const DecodedGeometryTileLayer>(std::move(counting));
+    ASSERT_EQ(3u, layer->featureCount());
+    EXPECT_EQ("roads", layer->getName());
+    EXPECT_EQ(FeatureType::LineString, layer->getType(1));
+    EXPECT_EQ(FeatureIdentifier(uint64_t(1)), *layer->getID(1));
+    EXPECT_EQ(Value(uint64_t(2)), *layer->getFeature(2).getValue("id"));
+
+    // Geometries are decoded lazily, and only once.
+    EXPECT_EQ(0u, decodes);
+    EXPECT_EQ(&layer->getGeometries(0), &layer->getGeometries(0));
+    EXPECT_EQ(1u, decodes);
+
+    auto view = DecodedGeometryTileLayer::view(layer);
+    layer.reset();
+
+    ASSERT_EQ(3u, view->featureCount());
+    auto feature = view->getFeature(0);
+    EXPECT_EQ(2u, feature->getGeometries().at(0).size());
+    EXPECT_EQ(1u, decodes);
+    EXPECT_EQ(FeatureIdentifier(uint64_t(0)), *feature->getID());
+
+    view->getFeature(2)->getGeometries();
+    EXPECT_EQ(2u, decodes);
+}
@@ -41,7 +41,10 @@ public:
         annotationManager,
         imageManager,
         glyphManager,
-        0
+        0,
+        {},
+        0,
+        RasterTextureFormat::RGBA
     };
 };
 
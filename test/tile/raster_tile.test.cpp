@@ -37,7 +37,10 @@ public:
         annotationManager,
         imageManager,
         glyphManager,
-        0
+        0,
+        {},
+        0,
+        RasterTextureFormat::RGBA
     };
 };
 
@@ -0,0 +1,89 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/util/http_concurrency.hpp>
+
+using namespace mbgl;
+using namespace mbgl::http;
+
+using Reason = Response::Error::Reason;
+
+TEST(HttpConcurrency, Bounds) {
+    ConcurrencyLimit limit(2, 50, 20);
+    EXPECT_EQ(20u, limit.get());
+
+    limit.setMaximum(10);
+    EXPECT_EQ(10u, limit.get());
+
+    for (int i = 0; i < 100; i++) {
+        limit.completed(Milliseconds(10), Reason::Server);
+    }
+    EXPECT_EQ(2u, limit.get());
+}
+
+TEST(HttpConcurrency, AdditiveIncrease) {
+    ConcurrencyLimit limit(1, 4, 64);
+
+    // Each window of successful responses raises the limit by one.
+    for (int i = 0; i < 5; i++) {
+        limit.completed(Milliseconds(10), Reason::Success);
+    }
+    EXPECT_EQ(5u, limit.get());
+
+    for (int i = 0; i < 10000; i++) {
+        limit.completed(Milliseconds(10), Reason::Success);
+    }
+    EXPECT_EQ(64u, limit.get());
+}
+
+TEST(HttpConcurrency, MultiplicativeDecrease) {
+    ConcurrencyLimit limit(1, 20, 20);
+
+    // Errors that aren't caused by load don't affect the limit.
+    limit.completed(Milliseconds(10), Reason::NotFound);
+    EXPECT_EQ(20u, limit.get());
+
+    limit.completed(Milliseconds(10), Reason::Connection);
+    EXPECT_EQ(15u, limit.get());
+
+    // A burst of failures from the same window only decreases the limit once.
+    for (int i = 0; i < 14; i++) {
+        limit.completed(Milliseconds(10), Reason::RateLimit);
+    }
+    EXPECT_EQ(15u, limit.get());
+
+    limit.completed(Milliseconds(10), Reason::RateLimit);
+    EXPECT_EQ(11u, limit.get());
+}
+
+TEST(HttpConcurrency, Latency) {
+    ConcurrencyLimit limit(1, 20, 20);
+
+    for (int i = 0; i < 20; i++) {
+        limit.completed(Milliseconds(50), Reason::Success);
+    }
+    EXPECT_EQ(20u, limit.get());
+
+    // Slower, but within the tolerance for jitter.
+    limit.completed(Milliseconds(140), Reason::Success);
+    EXPECT_EQ(20u, limit.get());
+
+    limit.completed(Milliseconds(500), Reason::Success);
+    EXPECT_EQ(15u, limit.get());
+}
+
+TEST(HttpConcurrency, LargeResponses) {
+    ConcurrencyLimit limit(1, 20, 64);
+
+    // Traffic that keeps mixing small and large responses isn't congestion, even though the
+    // large ones take five times as long as the small ones.
+    const auto latency = [] (int i) { return Milliseconds(i % 4 ? 50 : 250); };
+    for (int i = 0; i < 40; i++) {
+        limit.completed(latency(i), Reason::Success);
+    }
+
+    for (int i = 0; i < 200; i++) {
+        const uint32_t previous = limit.get();
+        limit.completed(latency(i), Reason::Success);
+        ASSERT_LE(previous, limit.get()) << i;
+    }
+}
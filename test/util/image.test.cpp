@@ -2,8 +2,11 @@
 
 #include <mbgl/util/premultiply.hpp>
 #include <mbgl/util/image.hpp>
+#include <mbgl/util/image_buffer_pool.hpp>
 #include <mbgl/util/io.hpp>
 
+#include <cstring>
+
 using namespace mbgl;
 
 TEST(Image, PNGRoundTrip) {
@@ -86,6 +89,70 @@ TEST(Image, WebPTile) {
 }
 #endif // !defined(__ANDROID__) && !defined(__APPLE__) && !defined(QT_IMAGE_DECODERS)
 
+TEST(Image, JPEGTruncated) {
+    const std::string jpeg = util::read_file("test/fixtures/image/tile.jpeg");
+    EXPECT_THROW(decodeImage(jpeg.substr(0, jpeg.size() / 2)), std::runtime_error);
+}
+
+TEST(Image, PNGTruncated) {
+    const std::string png = util::read_file("test/fixtures/image/tile.png");
+    EXPECT_THROW(decodeImage(png.substr(0, png.size() / 2)), std::runtime_error);
+}
+
+TEST(Image, DecodePooled) {
+    for (const auto& path : { "test/fixtures/image/tile.png",
+                              "test/fixtures/image/tile.jpeg",
+                              "test/fixtures/resources/sprite.png" }) {
+        const std::string data = util::read_file(path);
+        const PremultipliedImage expected = decodeImage(data);
+
+        // Room for exactly one image.
+        ImageBufferPool pool(expected.bytes());
+
+        PremultipliedImage first = decodeImage(data, pool);
+        ASSERT_EQ(expected.size, first.size);
+        EXPECT_EQ(0, std::memcmp(expected.data.get(), first.data.get(), expected.bytes()));
+
+        // The released buffer is reused, and fully overwritten.
+        std::memset(first.data.get(), 0xAB, first.bytes());
+        const uint8_t* buffer = first.data.get();
+        pool.release(std::move(first.data), first.bytes());
+        EXPECT_EQ(1u, pool.size());
+
+        const PremultipliedImage second = decodeImage(data, pool);
+        // System decoders on some platforms allocate their own buffers and leave the pool alone.
+        if (pool.size() == 0) {
+            EXPECT_EQ(buffer, second.data.get());
+        }
+        ASSERT_EQ(expected.size, second.size);
+        EXPECT_EQ(0, std::memcmp(expected.data.get(), second.data.get(), expected.bytes()));
+    }
+}
+
+TEST(Image, ImageBufferPool) {
+    ImageBufferPool pool(56);
+
+    // The capacity is counted in bytes, so the second 16 byte buffer no longer fits.
+    pool.release(std::make_unique<uint8_t[]>(16), 16);
+    pool.release(std::make_unique<uint8_t[]>(32), 32);
+    pool.release(std::make_unique<uint8_t[]>(16), 16);
+    EXPECT_EQ(2u, pool.size());
+    EXPECT_EQ(48u, pool.bytes());
+    pool.release(std::make_unique<uint8_t[]>(8), 8);
+    EXPECT_EQ(3u, pool.size());
+    EXPECT_EQ(56u, pool.bytes());
+
+    // Buffers are only handed out for the exact size they were released with.
+    EXPECT_NE(nullptr, pool.acquire(64));
+    EXPECT_EQ(3u, pool.size());
+    EXPECT_NE(nullptr, pool.acquire(16));
+    EXPECT_EQ(2u, pool.size());
+    EXPECT_NE(nullptr, pool.acquire(32));
+    EXPECT_NE(nullptr, pool.acquire(8));
+    EXPECT_EQ(0u, pool.size());
+    EXPECT_EQ(0u, pool.bytes());
+}
+
 TEST(Image, Resize) {
     AlphaImage image({0, 0});
 
@@ -163,3 +230,70 @@ TEST(Image, Premultiply) {
     EXPECT_EQ(0u, rgba.size.width);
     EXPECT_EQ(0u, rgba.size.height);
 }
+
+TEST(Image, PremultiplyExhaustive) {
+    // Every color and alpha combination, at odd offsets so that both vectorized blocks and
+    // trailing pixels are covered.
+    for (const uint32_t width : { 256u, 255u, 257u }) {
+        UnassociatedImage rgba({ width, 256 });
+        for (uint32_t a = 0; a < 256; a++) {
+            for (uint32_t x = 0; x < width; x++) {
+                uint8_t* pixel = rgba.data.get() + (a * width + x) * 4;
+                pixel[0] = x;
+                pixel[1] = 255 - x;
+                pixel[2] = x * 7;
+                pixel[3] = x % 5 == 0 ? 255 : a;
+            }
+        }
+
+        const UnassociatedImage original = rgba.clone();
+        const PremultipliedImage image = util::premultiply(std::move(rgba));
+        for (std::size_t i = 0; i < image.bytes(); i += 4) {
+            const uint32_t a = original.data[i + 3];
+            ASSERT_EQ((original.data[i + 0] * a + 127) / 255, image.data[i + 0]);
+            ASSERT_EQ((original.data[i + 1] * a + 127) / 255, image.data[i + 1]);
+            ASSERT_EQ((original.data[i + 2] * a + 127) / 255, image.data[i + 2]);
+            ASSERT_EQ(a, image.data[i + 3]);
+        }
+    }
+}
+
+TEST(Image, UnpremultiplyExhaustive) {
+    for (const uint32_t width : { 256u, 255u, 257u }) {
+        PremultipliedImage image({ width, 256 });
+        for (uint32_t a = 0; a < 256; a++) {
+            for (uint32_t x = 0; x < width; x++) {
+                uint8_t* pixel = image.data.get() + (a * width + x) * 4;
+                // Includes invalid colors that exceed alpha, whose results wrap around.
+                pixel[0] = x;
+                pixel[1] = 255 - x;
+                pixel[2] = x * 7;
+                pixel[3] = x < 8 ? 255 : x < 16 ? 0 : a;
+            }
+        }
+
+        const PremultipliedImage original = image.clone();
+        const UnassociatedImage rgba = util::unpremultiply(std::move(image));
+        for (std::size_t i = 0; i < rgba.bytes(); i += 4) {
+            const uint8_t a = original.data[i + 3];
+            for (std::size_t c = 0; c < 3; c++) {
+                const uint8_t expected = a ? (255 * original.data[i + c] + (a / 2)) / a : original.data[i + c];
+                ASSERT_EQ(expected, rgba.data[i + c]);
+            }
+            ASSERT_EQ(a, rgba.data[i + 3]);
+        }
+    }
+}
+
+TEST(Image, FlipRows) {
+    for (const uint8_t height : { 0, 1, 2, 5 }) {
+        std::vector<uint8_t> data(height * 3);
+        for (std::size_t i = 0; i < data.size(); i++) {
+            data[i] = i;
+        }
+        util::flipRows(data.data(), 3, height);
+        for (std::size_t i = 0; i < data.size(); i++) {
+            EXPECT_EQ((height - 1 - i / 3) * 3 + i % 3, data[i]);
+        }
+    }
+}
@@ -0,0 +1,127 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/image_encoder.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+
+#include <cstring>
+#include <future>
+#include <random>
+
+using namespace mbgl;
+
+namespace {
+
+PremultipliedImage randomImage(const Size size, const uint32_t colors) {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<uint32_t> distribution(0, colors - 1);
+
+    PremultipliedImage image(size);
+    for (std::size_t i = 0; i < image.bytes(); i += 4) {
+        // Opaque pixels round-trip through unpremultiplication without loss.
+        const uint32_t color = distribution(generator);
+        image.data[i + 0] = color * 53;
+        image.data[i + 1] = color * 101;
+        image.data[i + 2] = color * 197 + color / 256;
+        image.data[i + 3] = 255;
+    }
+    return image;
+}
+
+uint8_t colorType(const std::string& png) {
+    // Signature, IHDR length and type, width, height and bit depth precede the color type.
+    return uint8_t(png.at(8 + 8 + 4 + 4 + 1));
+}
+
+} // namespace
+
+TEST(ImageEncoder, PNGStrips) {
+    ThreadPool threadPool(4);
+    const auto image = randomImage({ 97, 61 }, 1 << 24);
+
+    ImageEncoderOptions options;
+    options.stripHeight = 7;
+    const std::string png = encodeImage(image, options, threadPool);
+    EXPECT_EQ(6u, colorType(png));
+
+    const auto decoded = decodeImage(png);
+    ASSERT_EQ(image.size, decoded.size);
+    EXPECT_EQ(0, std::memcmp(image.data.get(), decoded.data.get(), image.bytes()));
+}
+
+TEST(ImageEncoder, PNGSingleRow) {
+    ThreadPool threadPool(4);
+    const auto image = randomImage({ 5, 1 }, 1 << 24);
+
+    const auto decoded = decodeImage(encodeImage(image, {}, threadPool));
+    ASSERT_EQ(image.size, decoded.size);
+    EXPECT_EQ(0, std::memcmp(image.data.get(), decoded.data.get(), image.bytes()));
+}
+
+TEST(ImageEncoder, PNGAlpha) {
+    ThreadPool threadPool(4);
+    PremultipliedImage image({ 2, 1 });
+    const uint8_t pixels[8] = { 128, 0, 0, 128, 0, 0, 0, 0 };
+    std::memcpy(image.data.get(), pixels, sizeof(pixels));
+
+    for (const auto encoding : { ImageEncoding::PNG, ImageEncoding::PalettedPNG }) {
+        ImageEncoderOptions options;
+        options.encoding = encoding;
+        const auto decoded = decodeImage(encodeImage(image, options, threadPool));
+        ASSERT_EQ(image.size, decoded.size);
+        EXPECT_EQ(0, std::memcmp(image.data.get(), decoded.data.get(), image.bytes()));
+    }
+}
+
+TEST(ImageEncoder, PalettedPNG) {
+    ThreadPool threadPool(4);
+    const auto image = randomImage({ 128, 128 }, 200);
+
+    ImageEncoderOptions options;
+    options.encoding = ImageEncoding::PalettedPNG;
+    options.stripHeight = 16;
+    const std::string png = encodeImage(image, options, threadPool);
+    EXPECT_EQ(3u, colorType(png));
+    EXPECT_LT(png.size(), encodePNG(image).size());
+
+    const auto decoded = decodeImage(png);
+    ASSERT_EQ(image.size, decoded.size);
+    EXPECT_EQ(0, std::memcmp(image.data.get(), decoded.data.get(), image.bytes()));
+}
+
+TEST(ImageEncoder, PalettedPNGTooManyColors) {
+    ThreadPool threadPool(4);
+    const auto image = randomImage({ 64, 64 }, 1 << 24);
+
+    ImageEncoderOptions options;
+    options.encoding = ImageEncoding::PalettedPNG;
+    const std::string png = encodeImage(image, options, threadPool);
+    EXPECT_EQ(6u, colorType(png));
+
+    const auto decoded = decodeImage(png);
+    ASSERT_EQ(image.size, decoded.size);
+    EXPECT_EQ(0, std::memcmp(image.data.get(), decoded.data.get(), image.bytes()));
+}
+
+TEST(ImageEncoder, Async) {
+    ThreadPool threadPool(4);
+    ImageEncoder encoder(threadPool, {});
+
+    std::vector<std::future<std::string>> results;
+    for (uint32_t i = 1; i <= 4; i++) {
+        auto promise = std::make_shared<std::promise<std::string>>();
+        results.push_back(promise->get_future());
+        encoder.encode(randomImage({ 32 * i, 32 }, 1 << 24), [promise](std::exception_ptr error, std::string data) {
+            if (error) {
+                promise->set_exception(error);
+            } else {
+                promise->set_value(std::move(data));
+            }
+        });
+    }
+
+    for (uint32_t i = 1; i <= 4; i++) {
+        const auto decoded = decodeImage(results[i - 1].get());
+        EXPECT_EQ(Size(32 * i, 32), decoded.size);
+    }
+}
@@ -8,6 +8,8 @@
 
 #include <mbgl/util/offscreen_texture.hpp>
 
+#include <cstring>
+
 using namespace mbgl;
 
 TEST(OffscreenTexture, EmptyRed) {
@@ -171,3 +173,45 @@ void main() {
     image = view.readStillImage();
     test::checkImage("test/fixtures/offscreen_texture/render-to-fbo-composited", image, 0, 0.1);
 }
+
+TEST(OffscreenTexture, AsyncReadback) {
+    HeadlessBackend backend;
+    BackendScope scope { backend };
+    auto& context = backend.getContext();
+    OffscreenView view(context, { 64, 32 });
+    view.bind();
+
+    // Clear only the bottom half to make sure that rows come out in the same order as with a
+    // synchronous read.
+    context.clear(Color::red(), {}, {});
+    MBGL_CHECK_ERROR(glScissor(0, 0, 64, 16));
+    context.scissorTest = true;
+    context.clear(Color::black(), {}, {});
+    context.scissorTest = false;
+
+    const auto expected = view.readStillImage();
+    auto first = view.readStillImageAsync();
+
+    context.clear(Color::white(), {}, {});
+    auto second = view.readStillImageAsync();
+
+    // The first read is copied out as soon as the second one has been queued, before the
+    // framebuffer is cleared again.
+    context.clear(Color::black(), {}, {});
+    const auto image = first.get();
+    ASSERT_EQ(expected.size, image.size);
+    EXPECT_EQ(0, std::memcmp(expected.data.get(), image.data.get(), expected.bytes()));
+
+    // Waiting on a read that is still pending copies it out instead of blocking.
+    const auto white = second.get();
+    for (size_t i = 0; i < white.bytes(); i++) {
+        ASSERT_EQ(255, white.data[i]);
+    }
+
+    auto third = view.readStillImageAsync();
+    view.finishReads();
+    const auto black = third.get();
+    ASSERT_EQ(expected.size, black.size);
+    EXPECT_EQ(0, black.data[0]);
+    EXPECT_EQ(255, black.data[3]);
+}
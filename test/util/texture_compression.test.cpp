@@ -0,0 +1,162 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/util/texture_compression.hpp>
+
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+using namespace mbgl;
+
+namespace {
+
+PremultipliedImage opaqueImage(const Size size) {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<uint32_t> distribution(0, 255);
+
+    PremultipliedImage image(size);
+    for (std::size_t i = 0; i < image.bytes(); i += 4) {
+        image.data[i + 0] = distribution(generator);
+        image.data[i + 1] = distribution(generator);
+        image.data[i + 2] = distribution(generator);
+        image.data[i + 3] = 255;
+    }
+    return image;
+}
+
+uint16_t readUInt16(const uint8_t* data) {
+    return uint16_t(data[0] | (data[1] << 8));
+}
+
+std::array<uint32_t, 3> expand565(uint16_t color) {
+    const uint32_t r = (color >> 11) & 0x1F;
+    const uint32_t g = (color >> 5) & 0x3F;
+    const uint32_t b = color & 0x1F;
+    return {{ (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2) }};
+}
+
+// Decodes DXT1 blocks as specified in EXT_texture_compression_s3tc.
+PremultipliedImage decodeDXT1(const std::vector<uint8_t>& data, const Size size) {
+    PremultipliedImage image(size);
+    const uint32_t blocksX = (size.width + 3) / 4;
+    for (uint32_t y = 0; y < size.height; y++) {
+        for (uint32_t x = 0; x < size.width; x++) {
+            const uint8_t* block = data.data() + ((y / 4) * blocksX + x / 4) * 8;
+            const uint16_t color0 = readUInt16(block);
+            const uint16_t color1 = readUInt16(block + 2);
+            const uint32_t bits = readUInt16(block + 4) | (uint32_t(readUInt16(block + 6)) << 16);
+            const uint32_t index = (bits >> (2 * ((y % 4) * 4 + x % 4))) & 3;
+            const auto c0 = expand565(color0);
+            const auto c1 = expand565(color1);
+            uint8_t* pixel = image.data.get() + (y * size.width + x) * 4;
+            for (int c = 0; c < 3; c++) {
+                uint32_t value;
+                switch (index) {
+                case 0: value = c0[c]; break;
+                case 1: value = c1[c]; break;
+                case 2: value = color0 > color1 ? (2 * c0[c] + c1[c]) / 3 : (c0[c] + c1[c]) / 2; break;
+                default: value = color0 > color1 ? (c0[c] + 2 * c1[c]) / 3 : 0; break;
+                }
+                pixel[c] = uint8_t(value);
+            }
+            pixel[3] = 255;
+        }
+    }
+    return image;
+}
+
+} // namespace
+
+TEST(TextureCompression, Opaque) {
+    PremultipliedImage image = opaqueImage({ 5, 3 });
+    EXPECT_TRUE(util::isOpaque(image));
+
+    image.data[4 * 14 + 3] = 254;
+    EXPECT_FALSE(util::isOpaque(image));
+}
+
+TEST(TextureCompression, RGB565) {
+    PremultipliedImage image({ 4, 1 });
+    const uint8_t pixels[16] = {
+        255, 255, 255, 255,
+        0, 0, 0, 255,
+        255, 0, 0, 255,
+        132, 130, 8, 255,
+    };
+    std::memcpy(image.data.get(), pixels, sizeof(pixels));
+
+    const std::vector<uint8_t> encoded = util::encodeRGB565(image);
+    ASSERT_EQ(8u, encoded.size());
+
+    uint16_t result[4];
+    std::memcpy(result, encoded.data(), sizeof(result));
+    EXPECT_EQ(0xFFFF, result[0]);
+    EXPECT_EQ(0x0000, result[1]);
+    EXPECT_EQ(0xF800, result[2]);
+    EXPECT_EQ((16 << 11) | (32 << 5) | 1, result[3]);
+
+    // Every channel round-trips to within half a quantization step.
+    const auto decoded = expand565(result[3]);
+    EXPECT_NEAR(132, decoded[0], 4);
+    EXPECT_NEAR(130, decoded[1], 2);
+    EXPECT_NEAR(8, decoded[2], 4);
+}
+
+TEST(TextureCompression, DXT1SolidBlock) {
+    PremultipliedImage image({ 4, 4 });
+    for (std::size_t i = 0; i < image.bytes(); i += 4) {
+        image.data[i + 0] = 255;
+        image.data[i + 1] = 0;
+        image.data[i + 2] = 0;
+        image.data[i + 3] = 255;
+    }
+
+    const std::vector<uint8_t> encoded = util::encodeDXT1(image);
+    ASSERT_EQ(8u, encoded.size());
+    EXPECT_EQ(0xF800, readUInt16(encoded.data()));
+    EXPECT_EQ(0xF800, readUInt16(encoded.data() + 2));
+
+    const auto decoded = decodeDXT1(encoded, image.size);
+    EXPECT_EQ(0, std::memcmp(image.data.get(), decoded.data.get(), image.bytes()));
+}
+
+TEST(TextureCompression, DXT1Gradient) {
+    // A horizontal gradient between two colors that are exact in RGB565 is reproduced closely.
+    PremultipliedImage image({ 8, 8 });
+    for (uint32_t y = 0; y < 8; y++) {
+        for (uint32_t x = 0; x < 8; x++) {
+            uint8_t* pixel = image.data.get() + (y * 8 + x) * 4;
+            pixel[0] = uint8_t(x * 255 / 7);
+            pixel[1] = uint8_t(x * 255 / 7);
+            pixel[2] = uint8_t(x * 255 / 7);
+            pixel[3] = 255;
+        }
+    }
+
+    const std::vector<uint8_t> encoded = util::encodeDXT1(image);
+    ASSERT_EQ(4u * 8, encoded.size());
+
+    const auto decoded = decodeDXT1(encoded, image.size);
+    for (std::size_t i = 0; i < image.bytes(); i++) {
+        EXPECT_NEAR(image.data[i], decoded.data[i], 24) << "byte " << i;
+    }
+}
+
+TEST(TextureCompression, DXT1PartialBlocks) {
+    const auto image = opaqueImage({ 5, 7 });
+
+    const std::vector<uint8_t> encoded = util::encodeDXT1(image);
+    EXPECT_EQ(2u * 2 * 8, encoded.size());
+
+    // Each block uses colors between the extremes of its pixels, which random data spans widely;
+    // it still keeps the average error well below that of a flat block.
+    const auto decoded = decodeDXT1(encoded, image.size);
+    uint64_t error = 0;
+    for (std::size_t i = 0; i < image.bytes(); i++) {
+        error += std::abs(int(image.data[i]) - int(decoded.data[i]));
+    }
+    EXPECT_LT(error / image.bytes(), 64u);
+
+    EXPECT_TRUE(util::encodeDXT1(PremultipliedImage()).empty());
+}
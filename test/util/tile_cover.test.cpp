@@ -4,6 +4,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <map>
+#include <set>
+
 using namespace mbgl;
 
 TEST(TileCover, Empty) {
@@ -84,3 +88,72 @@ TEST(TileCover, SanFranciscoZ0Wrapped) {
     EXPECT_EQ((std::vector<UnwrappedTileID>{ { 0, 1, 0 } }),
               util::tileCover(sanFranciscoWrapped, 0));
 }
+
+// Tile IDs can't be reassigned, so the tiles are ordered in a set rather than sorted.
+static std::set<UnwrappedTileID> enumerate(util::TileCover cover) {
+    std::set<UnwrappedTileID> result;
+    while (auto tile = cover.next()) {
+        result.insert(*tile);
+    }
+    return result;
+}
+
+TEST(TileCover, LazyMatchesTileCover) {
+    for (const auto& bounds : { LatLngBounds::world(), LatLngBounds::empty(), sanFrancisco, sanFranciscoWrapped,
+                                LatLngBounds::hull({ 86, -180 }, { 90, 180 }) }) {
+        for (int32_t z = 0; z <= 8; z++) {
+            const auto tiles = util::tileCover(bounds, z);
+            const std::set<UnwrappedTileID> expected(tiles.begin(), tiles.end());
+
+            const util::TileCover cover(bounds, z);
+            EXPECT_EQ(expected.size(), cover.count());
+            EXPECT_EQ(expected, enumerate(cover));
+        }
+    }
+}
+
+TEST(TileCover, LazyCountLarge) {
+    // Counting doesn't enumerate, so it's cheap even for huge covers.
+    EXPECT_EQ(uint64_t(1) << 40, util::TileCover(LatLngBounds::world(), 20).count());
+}
+
+namespace {
+
+// Counts the tiles of each zoom level in a cover of the area around New York at z15.
+std::map<int32_t, std::size_t> lodCover(const Size size, const double pitch) {
+    Transform transform;
+    transform.resize(size);
+    transform.setLatLng({ 40.7, -74 });
+    transform.setZoom(15);
+    transform.setPitch(pitch * M_PI / 180.0);
+
+    const auto ideal = util::tileCover(transform.getState(), 15);
+    const auto lod = util::tileCover(transform.getState(), 15, 0);
+
+    // Every ideal tile is covered by exactly one tile of the level-of-detail cover.
+    for (const auto& id : ideal) {
+        EXPECT_EQ(1, std::count_if(lod.begin(), lod.end(), [&](const UnwrappedTileID& tile) {
+            return id == tile || id.isChildOf(tile);
+        }));
+    }
+
+    std::map<int32_t, std::size_t> counts;
+    for (const auto& tile : lod) {
+        counts[tile.canonical.z]++;
+    }
+    return counts;
+}
+
+} // namespace
+
+TEST(TileCover, PitchLOD) {
+    using Counts = std::map<int32_t, std::size_t>;
+
+    // Without pitch, all tiles appear at the same size.
+    EXPECT_EQ((Counts{ { 15, 9 } }), lodCover({ 1024, 768 }, 0));
+    EXPECT_EQ((Counts{ { 15, 20 } }), lodCover({ 2048, 2048 }, 0));
+
+    EXPECT_EQ((Counts{ { 14, 1 }, { 15, 21 } }), lodCover({ 1024, 768 }, 60));
+    EXPECT_EQ((Counts{ { 15, 46 } }), lodCover({ 2048, 2048 }, 45));
+    EXPECT_EQ((Counts{ { 14, 6 }, { 15, 74 } }), lodCover({ 2048, 2048 }, 60));
+}